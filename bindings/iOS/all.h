@@ -139,6 +139,7 @@
 #import <VerovioFramework/ligature.h>
 #import <VerovioFramework/linkinginterface.h>
 #import <VerovioFramework/lv.h>
+#import <VerovioFramework/mappedfile.h>
 #import <VerovioFramework/mdiv.h>
 #import <VerovioFramework/measure.h>
 #import <VerovioFramework/mensur.h>
@@ -180,6 +181,7 @@
 #import <VerovioFramework/plistinterface.h>
 #import <VerovioFramework/positioninterface.h>
 #import <VerovioFramework/preparedatafunctor.h>
+#import <VerovioFramework/profiler.h>
 #import <VerovioFramework/proport.h>
 #import <VerovioFramework/rdg.h>
 #import <VerovioFramework/ref.h>
@@ -203,6 +205,7 @@
 #import <VerovioFramework/slur.h>
 #import <VerovioFramework/smufl.h>
 #import <VerovioFramework/space.h>
+#import <VerovioFramework/spatialindex.h>
 #import <VerovioFramework/staff.h>
 #import <VerovioFramework/staffdef.h>
 #import <VerovioFramework/staffgrp.h>
@@ -226,6 +229,7 @@
 #import <VerovioFramework/text.h>
 #import <VerovioFramework/textdirinterface.h>
 #import <VerovioFramework/textelement.h>
+#import <VerovioFramework/threadpool.h>
 #import <VerovioFramework/tie.h>
 #import <VerovioFramework/timeinterface.h>
 #import <VerovioFramework/timemap.h>
@@ -18,6 +18,9 @@
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
+%ignore vrv::Toolkit::SetCString( std::string && );
+%ignore vrv::Toolkit::GetMEI( const std::string &, std::ostream & );
+%ignore vrv::Toolkit::RenderToSVG( int, bool, std::ostream & );
 
 %module verovio
 %include "std_string.i"
@@ -18,9 +18,47 @@
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
+%ignore vrv::Toolkit::SetCString( std::string && );
+%ignore vrv::Toolkit::GetMEI( const std::string &, std::ostream & );
+%ignore vrv::Toolkit::RenderToSVG( int, bool, std::ostream & );
 
 %feature("autodoc", "1");
 
+// Release the GIL in the methods loading, laying out, or rendering the data so that separate toolkit instances can
+// be used concurrently from Python threads. A toolkit instance must not be used by several threads at the same time.
+%nothread;
+%thread vrv::Toolkit::Toolkit;
+%thread vrv::Toolkit::ConvertHumdrumToHumdrum;
+%thread vrv::Toolkit::ConvertHumdrumToMIDI;
+%thread vrv::Toolkit::ConvertMEIToHumdrum;
+%thread vrv::Toolkit::Edit;
+%thread vrv::Toolkit::GetDescriptiveFeatures;
+%thread vrv::Toolkit::GetHumdrum;
+%thread vrv::Toolkit::GetHumdrumFile;
+%thread vrv::Toolkit::GetMEI;
+%thread vrv::Toolkit::LoadData;
+%thread vrv::Toolkit::LoadFile;
+%thread vrv::Toolkit::LoadZipDataBase64;
+%thread vrv::Toolkit::LoadZipDataBuffer;
+%thread vrv::Toolkit::RedoLayout;
+%thread vrv::Toolkit::RedoPagePitchPosLayout;
+%thread vrv::Toolkit::RenderData;
+%thread vrv::Toolkit::RenderToExpansionMap;
+%thread vrv::Toolkit::RenderToExpansionMapFile;
+%thread vrv::Toolkit::RenderToMIDI;
+%thread vrv::Toolkit::RenderToMIDIData;
+%thread vrv::Toolkit::RenderToMIDIFile;
+%thread vrv::Toolkit::RenderToPAE;
+%thread vrv::Toolkit::RenderToPAEFile;
+%thread vrv::Toolkit::RenderToSVG;
+%thread vrv::Toolkit::RenderToSVGFile;
+%thread vrv::Toolkit::RenderToTimemap;
+%thread vrv::Toolkit::RenderToTimemapFile;
+%thread vrv::Toolkit::SaveFile;
+%thread vrv::Toolkit::Select;
+%thread vrv::Toolkit::ValidatePAE;
+%thread vrv::Toolkit::ValidatePAEFile;
+
 // Because we transform the strings to dictionaries, we need this module
 %pythonbegin %{
     import json
@@ -71,6 +109,13 @@ def getElementAttr(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::GetElementsAtPoint
+%feature("shadow") vrv::Toolkit::GetElementsAtPoint(int, int, int) %{
+def getElementsAtPoint(toolkit, page_no: int, x: int, y: int) -> list:
+    """Return array of IDs of elements drawn at a point of a page."""
+    return json.loads($action(toolkit, page_no, x, y))
+%}
+
 // Toolkit::GetElementsAtTime
 %feature("shadow") vrv::Toolkit::GetElementsAtTime(int) %{
 def getElementsAtTime(toolkit, millisec: int) -> dict:
@@ -78,6 +123,13 @@ def getElementsAtTime(toolkit, millisec: int) -> dict:
     return json.loads($action(toolkit, millisec))
 %}
 
+// Toolkit::GetElementsInRect
+%feature("shadow") vrv::Toolkit::GetElementsInRect(int, const std::string &) %{
+def getElementsInRect(toolkit, page_no: int, rect: dict) -> list:
+    """Return array of IDs of elements drawn in a rectangle of a page."""
+    return json.loads($action(toolkit, page_no, json.dumps(rect)))
+%}
+
 // Toolkit::GetExpansionIdsForElement
 %feature("shadow") vrv::Toolkit::GetExpansionIdsForElement(const std::string &) %{
 def getExpansionIdsForElement(toolkit, xml_id: str) -> dict:
@@ -124,6 +176,13 @@ def redoLayout(toolkit, options: Optional[dict] = None) -> None:
     return $action(toolkit, json.dumps(options))
 %}
 
+// Toolkit::RequiresRedoLayout
+%feature("shadow") vrv::Toolkit::RequiresRedoLayout(const std::string &) const %{
+def requiresRedoLayout(toolkit, options: dict) -> bool:
+    """Check if changing the options requires the layout to be redone."""
+    return $action(toolkit, json.dumps(options))
+%}
+
 // Toolkit::RenderData
 %feature("shadow") vrv::Toolkit::RenderData(const std::string &, const std::string &) %{
 def renderData(toolkit, data, options: dict) -> str:
@@ -145,6 +204,13 @@ def renderToExpansionMapFile(toolkit, filename: str) -> bool:
     return $action(toolkit, filename)
 %}
 
+// Toolkit::RenderToMIDIData
+%feature("shadow") vrv::Toolkit::RenderToMIDIData() %{
+def renderToMIDIData(toolkit) -> bytes:
+    """Render the document to MIDI as bytes."""
+    return $action(toolkit)
+%}
+
 // Toolkit::RenderToTimemap
 %feature("shadow") vrv::Toolkit::RenderToTimemap(const std::string & = "") %{
 def renderToTimemap(toolkit, options: Optional[dict] = None) -> list:
@@ -195,8 +261,13 @@ def validatePAE(toolkit, data: Union[str, dict]) -> dict:
     return json.loads($action(toolkit, data))
 %}
 
-%module(package="verovio") verovio
+%module(package="verovio", threads="1") verovio
 %include "std_string.i"
+
+// Return binary data as bytes
+%typemap(out) std::vector<unsigned char> {
+    $result = PyBytes_FromStringAndSize(reinterpret_cast<const char *>((&$1)->data()), (&$1)->size());
+}
 %include "../../include/vrv/toolkit.h"
 %include "../../include/vrv/toolkitdef.h"
 
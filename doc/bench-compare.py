@@ -0,0 +1,43 @@
+# Compare two verovio-bench JSON results and report the stages that regressed
+# Ex. python3 bench-compare.py baseline.json current.json --threshold 5
+# The script exits with 1 when at least one stage regressed above the threshold
+import argparse
+import json
+import sys
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Compare two verovio-bench results')
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    # Regression threshold in percent
+    parser.add_argument('--threshold', type=float, default=5.0)
+    # Statistic compared (min is the least noisy on a busy machine)
+    parser.add_argument('--stat', choices=['min', 'median', 'mean'], default='median')
+    args = parser.parse_args()
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.current) as f:
+        current = json.load(f)
+
+    regressions = []
+    print(f'{"group":<14}{"stage":<14}{"baseline (ms)":>16}{"current (ms)":>16}{"change":>10}')
+    for group, group_results in sorted(current['groups'].items()):
+        if group not in baseline['groups']:
+            print(f'{group:<14}(not in baseline)')
+            continue
+        for stage, stats in group_results['stages'].items():
+            before = baseline['groups'][group]['stages'].get(stage, {}).get(args.stat)
+            after = stats.get(args.stat)
+            if before is None or after is None:
+                continue
+            change = (after - before) / before * 100.0 if before > 0 else 0.0
+            flag = ''
+            if change > args.threshold:
+                flag = ' *'
+                regressions.append((group, stage, change))
+            print(f'{group:<14}{stage:<14}{before * 1000:>16.2f}{after * 1000:>16.2f}{change:>+9.1f}%{flag}')
+
+    if regressions:
+        print(f'\n{len(regressions)} stage(s) regressed by more than {args.threshold}%')
+        sys.exit(1)
@@ -0,0 +1,211 @@
+# Generate the synthetic corpus used by verovio-bench
+# The files are deterministic for a given seed so that results remain comparable between builds
+# Ex. python3 bench-corpus.py ./bench-corpus
+import argparse
+import os
+import random
+
+STEPS = 'cdefgab'
+
+
+def rand_measure(rnd, octave, count=8):
+    # A measure of eighth notes as (pname, oct, accid) tuples
+    return [(rnd.choice(STEPS), octave + rnd.choice([-1, 0, 0, 1]), rnd.random() < 0.1) for _ in range(count)]
+
+
+def mei_header(title, staff_defs):
+    return ('<?xml version="1.0" encoding="UTF-8"?>\n'
+            '<mei xmlns="http://www.music-encoding.org/ns/mei" meiversion="5.0.0-dev">'
+            f'<meiHead><fileDesc><titleStmt><title>{title}</title></titleStmt><pubStmt/></fileDesc></meiHead>'
+            '<music><body><mdiv><score><scoreDef><staffGrp>' + ''.join(staff_defs) +
+            '</staffGrp></scoreDef><section>\n')
+
+
+MEI_FOOTER = '</section></score></mdiv></body></music></mei>\n'
+
+
+def orchestral_mei(rnd, staves, measures):
+    # Many staves with beams, slurs, hairpins, dynamics and lyrics on the first staff
+    staff_defs = []
+    for s in range(1, staves + 1):
+        clef = 'clef.shape="G" clef.line="2"' if s % 2 else 'clef.shape="F" clef.line="4"'
+        staff_defs.append(f'<staffDef n="{s}" lines="5" {clef} key.sig="2s" meter.count="4" meter.unit="4"/>')
+    out = [mei_header('Orchestral', staff_defs)]
+    nid = 0
+    for m in range(1, measures + 1):
+        out.append(f'<measure n="{m}">')
+        ctrl = []
+        for s in range(1, staves + 1):
+            ids = []
+            out.append(f'<staff n="{s}"><layer n="1"><beam>')
+            for k, (pname, octave, accid) in enumerate(rand_measure(rnd, 4 if s % 2 else 3)):
+                nid += 1
+                ids.append(f'n{nid}')
+                accid = ' accid="s"' if accid else ''
+                syl = '<verse n="1"><syl>la</syl></verse>' if s == 1 else ''
+                out.append(f'<note xml:id="n{nid}" dur="8" pname="{pname}" oct="{octave}"{accid}>{syl}</note>')
+                if k == 3:
+                    out.append('</beam><beam>')
+            out.append('</beam></layer></staff>')
+            ctrl.append(f'<slur startid="#{ids[0]}" endid="#{ids[5]}"/>')
+            ctrl.append(f'<hairpin form="cres" staff="{s}" tstamp="1" tstamp2="0m+4"/>')
+            ctrl.append(f'<dynam staff="{s}" tstamp="1">p</dynam>')
+        out += ctrl
+        out.append('</measure>\n')
+    out.append(MEI_FOOTER)
+    return ''.join(out)
+
+
+def piano_mei(rnd, measures):
+    # Two staves with two layers and dense chords
+    staff_defs = ['<staffDef n="1" lines="5" clef.shape="G" clef.line="2" key.sig="3f" meter.count="4" meter.unit="4"/>',
+                  '<staffDef n="2" lines="5" clef.shape="F" clef.line="4" key.sig="3f" meter.count="4" meter.unit="4"/>']
+    out = [mei_header('Piano', staff_defs)]
+    for m in range(1, measures + 1):
+        out.append(f'<measure n="{m}">')
+        for s, octave in ((1, 5), (2, 3)):
+            out.append(f'<staff n="{s}">')
+            for layer, stem in ((1, 'up'), (2, 'down')):
+                out.append(f'<layer n="{layer}">')
+                for _ in range(4):
+                    out.append(f'<chord dur="4" stem.dir="{stem}">')
+                    for pname, oct_, accid in rand_measure(rnd, octave - layer + 1, rnd.randint(2, 4)):
+                        accid = ' accid="n"' if accid else ''
+                        out.append(f'<note pname="{pname}" oct="{oct_}"{accid}/>')
+                    out.append('</chord>')
+                out.append('</layer>')
+            out.append('</staff>')
+        out.append(f'<pedal dir="down" staff="2" tstamp="1"/><pedal dir="up" staff="2" tstamp="4.5"/>')
+        out.append('</measure>\n')
+    out.append(MEI_FOOTER)
+    return ''.join(out)
+
+
+def repeats_mei(rnd, sections, measures):
+    # Sections repeated with da capo and dal segno in the expansion 'expansion-bench'
+    # Ex. verovio-bench --options '{"expand": "expansion-bench", "expandShared": true}' ./bench-corpus
+    staff_defs = ['<staffDef n="1" lines="5" clef.shape="G" clef.line="2" meter.count="4" meter.unit="4"/>',
+                  '<staffDef n="2" lines="5" clef.shape="F" clef.line="4" meter.count="4" meter.unit="4"/>']
+    out = [mei_header('Repeats', staff_defs)]
+    # Each section repeated, then da capo and dal segno (from the middle section)
+    plist = [f'#s{s}' for s in range(1, sections + 1) for _ in range(2)]
+    plist += [f'#s{s}' for s in range(1, sections + 1)] + [f'#s{s}' for s in range(sections // 2 + 1, sections + 1)]
+    out.append(f'<expansion xml:id="expansion-bench" plist="{" ".join(plist)}"/>\n')
+    nid = 0
+    for s in range(1, sections + 1):
+        out.append(f'<section xml:id="s{s}">')
+        for m in range(1, measures + 1):
+            out.append(f'<measure xml:id="s{s}m{m}" n="{m}">')
+            for n, octave in ((1, 4), (2, 3)):
+                out.append(f'<staff n="{n}"><layer n="1"><beam>')
+                for pname, oct_, accid in rand_measure(rnd, octave):
+                    nid += 1
+                    accid = ' accid="f"' if accid else ''
+                    out.append(f'<note xml:id="n{nid}" dur="8" pname="{pname}" oct="{oct_}"{accid}/>')
+                out.append('</beam></layer></staff>')
+            out.append(f'<slur startid="#n{nid - 7}" endid="#n{nid}"/>')
+            out.append('</measure>\n')
+        out.append('</section>')
+    out.append(MEI_FOOTER)
+    return ''.join(out)
+
+
+def kern_pitch(pname, octave):
+    if octave >= 4:
+        return pname * (octave - 3)
+    return pname.upper() * (4 - octave)
+
+
+def humdrum_kern(rnd, spines, measures):
+    # A long **kern score with eighth notes in every spine
+    lines = ['\t'.join(['**kern'] * spines),
+             '\t'.join(['*clefF4' if s % 2 == 0 else '*clefG2' for s in range(spines)]),
+             '\t'.join(['*k[b-]'] * spines),
+             '\t'.join(['*M4/4'] * spines)]
+    for m in range(1, measures + 1):
+        lines.append('\t'.join([f'={m}'] * spines))
+        notes = [rand_measure(rnd, 3 if s % 2 == 0 else 4) for s in range(spines)]
+        for k in range(8):
+            tokens = []
+            for s in range(spines):
+                pname, octave, accid = notes[s][k]
+                beam = 'L' if k % 4 == 0 else 'J' if k % 4 == 3 else ''
+                tokens.append(f'8{kern_pitch(pname, octave)}{"#" if accid else ""}{beam}')
+            lines.append('\t'.join(tokens))
+    lines.append('\t'.join(['=='] * spines))
+    lines.append('\t'.join(['*-'] * spines))
+    return '\n'.join(lines) + '\n'
+
+
+def musicxml(rnd, parts, measures):
+    # A partwise MusicXML score with one staff per part
+    out = ['<?xml version="1.0" encoding="UTF-8"?>\n',
+           '<!DOCTYPE score-partwise PUBLIC "-//Recordare//DTD MusicXML 4.0 Partwise//EN" '
+           '"http://www.musicxml.org/dtds/partwise.dtd">\n',
+           '<score-partwise version="4.0"><part-list>']
+    for p in range(1, parts + 1):
+        out.append(f'<score-part id="P{p}"><part-name>Part {p}</part-name></score-part>')
+    out.append('</part-list>\n')
+    for p in range(1, parts + 1):
+        out.append(f'<part id="P{p}">')
+        for m in range(1, measures + 1):
+            out.append(f'<measure number="{m}">')
+            if m == 1:
+                clef = '<sign>G</sign><line>2</line>' if p % 2 else '<sign>F</sign><line>4</line>'
+                out.append('<attributes><divisions>2</divisions><key><fifths>-1</fifths></key>'
+                           f'<time><beats>4</beats><beat-type>4</beat-type></time><clef>{clef}</clef></attributes>')
+            for pname, octave, accid in rand_measure(rnd, 4 if p % 2 else 3):
+                alter = '<alter>1</alter>' if accid else ''
+                out.append(f'<note><pitch><step>{pname.upper()}</step>{alter}<octave>{octave}</octave></pitch>'
+                           '<duration>1</duration><type>eighth</type></note>')
+            out.append('</measure>\n')
+        out.append('</part>\n')
+    out.append('</score-partwise>\n')
+    return ''.join(out)
+
+
+def pae_incipit(rnd, measures):
+    # A short Plaine & Easie incipit
+    octaves = {3: ',', 4: "'", 5: "''"}
+
+    def notes(count):
+        return ''.join(octaves[min(max(octave, 3), 5)] + ('x' if accid else '') + pname.upper()
+                       for pname, octave, accid in rand_measure(rnd, 4, count))
+
+    # Four eighth notes and two quarter notes per measure
+    data = ['8' + notes(4) + '4' + notes(2) for _ in range(measures)]
+    return f'@clef:G-2\n@keysig:bB\n@timesig:4/4\n@data:{"/".join(data)}//\n'
+
+
+def write(path, content):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(content)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Generate the verovio-bench corpus')
+    parser.add_argument('output_dir')
+    parser.add_argument('--seed', type=int, default=1)
+    # Scale the size of the files (number of measures)
+    parser.add_argument('--scale', type=float, default=1.0)
+    parser.add_argument('--incipits', type=int, default=2000)
+    args = parser.parse_args()
+
+    rnd = random.Random(args.seed)
+
+    def size(n):
+        return max(1, int(n * args.scale))
+
+    write(os.path.join(args.output_dir, 'orchestral', 'orchestral-24x100.mei'), orchestral_mei(rnd, 24, size(100)))
+    write(os.path.join(args.output_dir, 'orchestral', 'orchestral-12x200.mei'), orchestral_mei(rnd, 12, size(200)))
+    write(os.path.join(args.output_dir, 'piano', 'piano-400.mei'), piano_mei(rnd, size(400)))
+    # With a generator of its own for the other files to remain the same as without it
+    write(os.path.join(args.output_dir, 'repeats', 'repeats-8x25.mei'),
+          repeats_mei(random.Random(args.seed), 8, size(25)))
+    write(os.path.join(args.output_dir, 'humdrum', 'kern-4x1000.krn'), humdrum_kern(rnd, 4, size(1000)))
+    write(os.path.join(args.output_dir, 'musicxml', 'musicxml-16x200.musicxml'), musicxml(rnd, 16, size(200)))
+    for i in range(args.incipits):
+        write(os.path.join(args.output_dir, 'pae', f'incipit-{i:04d}.pae'), pae_incipit(rnd, rnd.randint(2, 6)))
+
+    print(f'Corpus written to {args.output_dir}')
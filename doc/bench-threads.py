@@ -0,0 +1,115 @@
+# Stress test and throughput benchmark of the Python toolkit used from several threads
+# Each thread uses its own toolkit and the outputs are checked against the ones of a sequential run
+# This script it expected to be run from ./bindings/python
+# Ex. python3 ../../doc/bench-threads.py ./bench-corpus --threads 4 --repeat 3
+# The script exits with 1 when the output of at least one file differs from the sequential one
+import argparse
+import hashlib
+import os
+import queue
+import sys
+import threading
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+benchOptions = {
+    'breaks': 'auto',
+    'pageHeight': 2970,
+    'pageWidth': 2100,
+    'scale': 40
+}
+
+
+def render(tk, inputFile):
+    # Load and render a file to all the outputs and return a digest for each of them
+    tk.resetXmlIdSeed(1)
+    if not tk.loadFile(inputFile):
+        return {'load': None}
+    digests = {}
+    svg = hashlib.sha1()
+    for page in range(1, tk.getPageCount() + 1):
+        svg.update(tk.renderToSVG(page).encode('utf-8'))
+    digests['svg'] = svg.hexdigest()
+    # The MEI header has the date of the conversion
+    mei = tk.getMEI({'removeIds': True})
+    mei = mei[mei.find('<music'):]
+    digests['mei'] = hashlib.sha1(mei.encode('utf-8')).hexdigest()
+    digests['midi'] = hashlib.sha1(tk.renderToMIDI().encode('utf-8')).hexdigest()
+    return digests
+
+
+def run(files, threadCount, repeat):
+    # Process the files repeat times with threadCount threads and return the elapsed time and the digests
+    tasks = queue.Queue()
+    for _ in range(repeat):
+        for inputFile in files:
+            tasks.put(inputFile)
+    results = {}
+    lock = threading.Lock()
+
+    def worker():
+        tk = verovio.toolkit()
+        tk.setOptions(benchOptions)
+        while True:
+            try:
+                inputFile = tasks.get_nowait()
+            except queue.Empty:
+                return
+            digests = render(tk, inputFile)
+            with lock:
+                results.setdefault(inputFile, []).append(digests)
+
+    threads = [threading.Thread(target=worker) for _ in range(threadCount)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return time.perf_counter() - start, results
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Render files with verovio toolkits in several threads')
+    parser.add_argument('inputs', nargs='+', help='Files or directories with the files to render')
+    parser.add_argument('--threads', type=int, default=os.cpu_count() or 4)
+    # Number of times each file is rendered in each run
+    parser.add_argument('--repeat', type=int, default=2)
+    args = parser.parse_args()
+
+    files = []
+    for item in args.inputs:
+        if os.path.isdir(item):
+            files += sorted(os.path.join(item, f) for f in os.listdir(item) if not f.startswith('.'))
+        else:
+            files.append(item)
+    if not files:
+        print('No input file')
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+
+    sequentialTime, expected = run(files, 1, args.repeat)
+    concurrentTime, results = run(files, args.threads, args.repeat)
+
+    mismatches = []
+    for inputFile in files:
+        reference = expected[inputFile][0]
+        for digests in expected[inputFile] + results.get(inputFile, []):
+            for output, digest in reference.items():
+                if digests.get(output) != digest and (inputFile, output) not in mismatches:
+                    mismatches.append((inputFile, output))
+
+    count = len(files) * args.repeat
+    print(f'{"threads":<10}{"time (s)":>12}{"files/s":>12}{"speedup":>10}')
+    print(f'{1:<10}{sequentialTime:>12.2f}{count / sequentialTime:>12.2f}{1.0:>10.2f}')
+    print(f'{args.threads:<10}{concurrentTime:>12.2f}{count / concurrentTime:>12.2f}'
+          f'{sequentialTime / concurrentTime:>10.2f}')
+
+    if mismatches:
+        print(f'\nOutput with {args.threads} threads differs for:')
+        for inputFile, output in mismatches:
+            print(f'  {inputFile} ({output})')
+        sys.exit(1)
@@ -35,8 +35,13 @@ if __name__ == '__main__':
     parser.add_argument('test_suite_dir')
     parser.add_argument('output_dir')
     parser.add_argument('--shortlist', nargs='?', default='')
+    # Number of threads for checking that the concurrent layout is identical to the sequential one
+    parser.add_argument('--threads', type=int, default=0)
     args = parser.parse_args()
 
+    # list of files for which the concurrent layout differs
+    threadMismatches = []
+
     # version of the toolkit
     tk = verovio.toolkit(False)
     print(f'Verovio {tk.getVersion()}')
@@ -103,11 +108,36 @@ if __name__ == '__main__':
             tk.loadFile(inputFile)
             # render to SVG
             svgString = tk.renderToSVG(1)
+            # render again with threads and compare with the sequential output
+            if args.threads > 1:
+                tk.setOptions({'xmlIdSeed': options['xmlIdSeed'], 'threads': args.threads})
+                tk.loadFile(inputFile)
+                if tk.renderToSVG(1) != svgString:
+                    print(f'Output with {args.threads} threads differs for {item2}')
+                    threadMismatches.append(os.path.join(item1, item2))
+                tk.setOptions({'threads': 0})
             svgString = svgString.replace(
                 "overflow=\"inherit\"", "overflow=\"visible\"")
             ET.ElementTree(ET.fromstring(svgString)).write(svgFile)
             cairosvg.svg2png(bytestring=svgString, scale=2, write_to=pngFile)
             # create time map
             tk.renderToTimemapFile(timeMapFile)
+            # render narrow pages for having elements spanning over several systems, which are processed in order
+            if args.threads > 1:
+                allPages = []
+                for threads in (0, args.threads):
+                    tk.setOptions({'xmlIdSeed': options['xmlIdSeed'], 'pageWidth': 1000, 'threads': threads})
+                    tk.loadFile(inputFile)
+                    allPages.append([tk.renderToSVG(p) for p in range(1, tk.getPageCount() + 1)])
+                if allPages[0] != allPages[1]:
+                    print(f'Output of narrow pages with {args.threads} threads differs for {item2}')
+                    threadMismatches.append(os.path.join(item1, item2) + ' (narrow pages)')
+                tk.setOptions({'threads': 0})
             tk.resetOptions()
             options.clear()
+
+    if threadMismatches:
+        print('Output with threads differs for:')
+        for item in threadMismatches:
+            print(f'  {item}')
+        sys.exit(1)
@@ -0,0 +1,95 @@
+# Test of the editor transactions of the Python toolkit
+# Each file is loaded with a transposition, edited in a transaction that is rolled back, and the pitches, the MEI
+# and the SVG are checked against the ones before the transaction
+# The editor toolkit is available only in builds without Humdrum support (cmake -DNO_HUMDRUM_SUPPORT=ON)
+# This script it expected to be run from ./bindings/python
+# Ex. python3 ../../doc/test-transactions.py ../../doc/importer.mei --transpose M2
+# The script exits with 1 when the document of at least one file is not restored
+import argparse
+import os
+import re
+import sys
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+
+def pitches(mei):
+    # Return the pitch attributes of the notes in document order
+    notes = re.findall(r'<note [^>]*>', mei)
+    return [' '.join(re.findall(r'(?:pname|oct|accid\.ges)="[^"]*"', note)) for note in notes]
+
+
+def music(mei):
+    # The MEI header has the date of the conversion
+    return mei[mei.find('<music'):]
+
+
+def layout(svg):
+    # The IDs of the elements that are not encoded (e.g., the stems or the systems) are generated again when the
+    # document is restored, and the IDs of the glyph definitions change for each rendering
+    return re.sub(r'(#[0-9A-F]{4,5})-[0-9a-z]+"', r'\1"', re.sub(r' id="[^"]*"', '', svg))
+
+
+def test(tk, inputFile, transpose, editCount):
+    # Return the list of the failures, i.e., mostly the outputs that are not restored after the rollback
+    tk.setOptions({'transpose': transpose})
+    tk.resetXmlIdSeed(1)
+    if not tk.loadFile(inputFile):
+        return ['not loaded']
+    svg = layout(tk.renderToSVG(1))
+    mei = tk.getMEI({'scoreBased': True})
+    noteIds = re.findall(r'<note xml:id="([^"]+)"', mei)
+    if not noteIds:
+        return []
+
+    tk.edit({'action': 'begin'})
+    for noteId in noteIds[::max(1, len(noteIds) // editCount)]:
+        tk.edit({'action': 'keyDown', 'param': {'elementId': noteId, 'key': 38, 'shiftKey': False, 'ctrlKey': False}})
+    edited = tk.getMEI({'scoreBased': True})
+    tk.edit({'action': 'rollback'})
+
+    failures = []
+    if pitches(edited) == pitches(mei):
+        failures.append('edits not applied')
+    restored = tk.getMEI({'scoreBased': True})
+    if pitches(restored) != pitches(mei):
+        failures.append('pitches not restored')
+    if music(restored) != music(mei):
+        failures.append('MEI not restored')
+    if layout(tk.renderToSVG(1)) != svg:
+        failures.append('SVG not restored')
+    return failures
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Roll back transactions with verovio and check the documents')
+    parser.add_argument('inputs', nargs='+', help='Files or directories with the files to test')
+    parser.add_argument('--transpose', default='M2')
+    # Number of notes edited in each transaction
+    parser.add_argument('--edits', type=int, default=10)
+    args = parser.parse_args()
+
+    files = []
+    for item in args.inputs:
+        if os.path.isdir(item):
+            files += sorted(os.path.join(item, f) for f in os.listdir(item) if not f.startswith('.'))
+        else:
+            files.append(item)
+    if not files:
+        print('No input file')
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+    tk = verovio.toolkit()
+
+    failed = False
+    for inputFile in files:
+        failures = test(tk, inputFile, args.transpose, args.edits)
+        if failures:
+            print(f'{inputFile}: {", ".join(failures)}')
+            failed = True
+    if failed:
+        sys.exit(1)
+    print(f'{len(files)} file(s) restored')
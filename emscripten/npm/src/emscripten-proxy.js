@@ -24,6 +24,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *editInfo(Toolkit *ic)
     mapping.editInfo = VerovioModule.cwrap("vrvToolkit_editInfo", "string", ["number"]);
 
+    // char *getABCTuneIndex(Toolkit *ic)
+    mapping.getABCTuneIndex = VerovioModule.cwrap("vrvToolkit_getABCTuneIndex", "string", ["number"]);
+
     // char *getAvailableOptions(Toolkit *ic)
     mapping.getAvailableOptions = VerovioModule.cwrap("vrvToolkit_getAvailableOptions", "string", ["number"]);
 
@@ -36,9 +39,15 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getElementAttr(Toolkit *ic, const char *xmlId)
     mapping.getElementAttr = VerovioModule.cwrap("vrvToolkit_getElementAttr", "string", ["number", "string"]);
 
+    // char *getElementsAtPoint(Toolkit *ic, int pageNo, int x, int y)
+    mapping.getElementsAtPoint = VerovioModule.cwrap("vrvToolkit_getElementsAtPoint", "string", ["number", "number", "number", "number"]);
+
     // char *getElementsAtTime(Toolkit *ic, int time)
     mapping.getElementsAtTime = VerovioModule.cwrap("vrvToolkit_getElementsAtTime", "string", ["number", "number"]);
 
+    // char *getElementsInRect(Toolkit *ic, int pageNo, const char *rect)
+    mapping.getElementsInRect = VerovioModule.cwrap("vrvToolkit_getElementsInRect", "string", ["number", "number", "string"]);
+
     // char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
     mapping.getExpansionIdsForElement = VerovioModule.cwrap("vrvToolkit_getExpansionIdsForElement", "string", ["number", "string"]);
 
@@ -66,6 +75,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getOptions(Toolkit *ic)
     mapping.getOptions = VerovioModule.cwrap("vrvToolkit_getOptions", "string", ["number"]);
 
+    // char *getProfile(Toolkit *ic)
+    mapping.getProfile = VerovioModule.cwrap("vrvToolkit_getProfile", "string", ["number"]);
+
     // int getPageCount(Toolkit *ic)
     mapping.getPageCount = VerovioModule.cwrap("vrvToolkit_getPageCount", "number", ["number"]);
 
@@ -99,6 +111,9 @@ function getToolkitFunction(VerovioModule, method) {
     // void redoPagePitchPosLayout(Toolkit *ic)
     mapping.redoPagePitchPosLayout = VerovioModule.cwrap("vrvToolkit_redoPagePitchPosLayout", null, ["number"]);
 
+    // bool requiresRedoLayout(Toolkit *ic, const char *options)
+    mapping.requiresRedoLayout = VerovioModule.cwrap("vrvToolkit_requiresRedoLayout", "number", ["number", "string"]);
+
     // char *renderData(Toolkit *ic, const char *data, const char *options)
     mapping.renderData = VerovioModule.cwrap("vrvToolkit_renderData", "string", ["number", "string", "string"]);
 
@@ -108,6 +123,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToMIDI(Toolkit *ic, const char *rendering_options)
     mapping.renderToMIDI = VerovioModule.cwrap("vrvToolkit_renderToMIDI", "string", ["number", "string"]);
 
+    // const unsigned char *renderToMIDIData(Toolkit *ic, const char *rendering_options, size_t *length)
+    mapping.renderToMIDIData = VerovioModule.cwrap("vrvToolkit_renderToMIDIData", "number", ["number", "string", "number"]);
+
     // char *renderToPAE(Toolkit *ic)
     mapping.renderToPAE = VerovioModule.cwrap("vrvToolkit_renderToPAE", "string");
 
@@ -120,6 +138,9 @@ function getToolkitFunction(VerovioModule, method) {
     // void resetOptions(Toolkit *ic)
     mapping.resetOptions = VerovioModule.cwrap("vrvToolkit_resetOptions", null, ["number"]);
 
+    // void resetProfile(Toolkit *ic)
+    mapping.resetProfile = VerovioModule.cwrap("vrvToolkit_resetProfile", null, ["number"]);
+
     // void resetXmlIdSeed(Toolkit *ic, int seed) 
     mapping.resetXmlIdSeed = VerovioModule.cwrap("vrvToolkit_resetXmlIdSeed", null, ["number", "number"]);
 
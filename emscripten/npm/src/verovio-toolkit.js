@@ -26,6 +26,10 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.editInfo(this.ptr));
     }
 
+    getABCTuneIndex() {
+        return JSON.parse(this.proxy.getABCTuneIndex(this.ptr));
+    }
+
     getAvailableOptions() {
         return JSON.parse(this.proxy.getAvailableOptions(this.ptr));
     }
@@ -42,10 +46,18 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.getElementAttr(this.ptr, xmlId));
     }
 
+    getElementsAtPoint(pageNo, x, y) {
+        return JSON.parse(this.proxy.getElementsAtPoint(this.ptr, pageNo, x, y));
+    }
+
     getElementsAtTime(millisec) {
         return JSON.parse(this.proxy.getElementsAtTime(this.ptr, millisec));
     }
 
+    getElementsInRect(pageNo, rect) {
+        return JSON.parse(this.proxy.getElementsInRect(this.ptr, pageNo, JSON.stringify(rect)));
+    }
+
     getExpansionIdsForElement(xmlId) {
         return JSON.parse(this.proxy.getExpansionIdsForElement(this.ptr, xmlId));
     }
@@ -96,6 +108,10 @@ export class VerovioToolkit {
         }
     }
 
+    getProfile() {
+        return JSON.parse(this.proxy.getProfile(this.ptr));
+    }
+
     getPageCount() {
         return this.proxy.getPageCount(this.ptr);
     }
@@ -146,6 +162,10 @@ export class VerovioToolkit {
         this.proxy.redoPagePitchPosLayout(this.ptr);
     }
 
+    requiresRedoLayout(options) {
+        return this.proxy.requiresRedoLayout(this.ptr, JSON.stringify(options));
+    }
+
     renderData(data, options) {
         return this.proxy.renderData(this.ptr, data, JSON.stringify(options));
     }
@@ -158,6 +178,15 @@ export class VerovioToolkit {
         return this.proxy.renderToMIDI(this.ptr, JSON.stringify(options));
     }
 
+    renderToMIDIData(options = {}) {
+        var lengthPtr = this.VerovioModule._malloc(4);
+        var dataPtr = this.proxy.renderToMIDIData(this.ptr, JSON.stringify(options), lengthPtr);
+        var length = new Uint32Array(this.VerovioModule.HEAPU8.buffer, lengthPtr, 1)[0];
+        this.VerovioModule._free(lengthPtr);
+        // Copy the data since the toolkit buffer is reused by the next call
+        return this.VerovioModule.HEAPU8.slice(dataPtr, dataPtr + length);
+    }
+
     renderToPAE() {
         return this.proxy.renderToPAE(this.ptr);
     }
@@ -174,6 +203,10 @@ export class VerovioToolkit {
         this.proxy.resetOptions(this.ptr);
     }
 
+    resetProfile() {
+        this.proxy.resetProfile(this.ptr);
+    }
+
     resetXmlIdSeed(seed) {
         return this.proxy.resetXmlIdSeed(this.ptr, seed);
     }
@@ -33,6 +33,7 @@ public:
      * Abstract base implementation
      */
     bool ImplementsEndInterface() const override { return false; }
+    bool IsThreadSafe() const override { return true; }
 
     /*
      * Functor interface
@@ -33,11 +33,15 @@ public:
      * Abstract base implementation
      */
     bool ImplementsEndInterface() const override { return false; }
+    bool IsThreadSafe() const override { return true; }
 
     /*
-     * Check existence of cross-staff slurs
+     * Getter and setter for the existence of cross-staff slurs
      */
+    ///@{
     bool HasCrossStaffSlurs() const { return m_crossStaffSlurs; }
+    void SetCrossStaffSlurs(bool crossStaffSlurs) { m_crossStaffSlurs = crossStaffSlurs; }
+    ///@}
 
     /*
      * Functor interface
@@ -15,6 +15,7 @@
 namespace vrv {
 
 #define BEZIER_APPROXIMATION 50.0
+#define BEZIER_TABLE_SIZE 16
 
 class BeamDrawingInterface;
 class Doc;
@@ -218,6 +219,14 @@ public:
      */
     static int CalcBezierAtPosition(const Point bezier[4], int x);
 
+    /**
+     * Calculate the y positions of a bezier for a set of x positions.
+     * For curves with an increasing x, the parameter is looked up in a table sampled once for all the positions and
+     * refined with a fixed number of Newton steps. The loop has no data dependent branch and can be vectorized.
+     * Other curves are evaluated position by position with CalcBezierAtPosition.
+     */
+    static std::vector<int> CalcBezierAtPositions(const Point bezier[4], const std::vector<int> &positions);
+
     /**
      * Calculate linear interpolation between two points at time t
      */
@@ -34,6 +34,7 @@ public:
      * Abstract base implementation
      */
     bool ImplementsEndInterface() const override { return true; }
+    bool IsThreadSafe() const override { return true; }
 
     /*
      * Functor interface
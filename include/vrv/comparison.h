@@ -503,6 +503,31 @@ private:
     std::string m_id;
 };
 
+//----------------------------------------------------------------------------
+// ObjectSetComparison
+//----------------------------------------------------------------------------
+
+/**
+ * This class evaluates if the object is of a certain ClassId and is one of a set of objects
+ */
+class ObjectSetComparison : public ClassIdComparison {
+
+public:
+    ObjectSetComparison(ClassId classId, const std::set<const Object *> &objects) : ClassIdComparison(classId)
+    {
+        m_objects = objects;
+    }
+
+    bool operator()(const Object *object) override
+    {
+        if (!MatchesType(object)) return false;
+        return (m_objects.count(object) > 0);
+    }
+
+private:
+    std::set<const Object *> m_objects;
+};
+
 //----------------------------------------------------------------------------
 // VisibleStaffDefOrGrpObject
 //----------------------------------------------------------------------------
@@ -323,6 +323,15 @@ public:
 private:
     void AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend);
 
+    /**
+     * Reset the extent before calculating it for caching and merge a cached extent into the one of the caller.
+     * The width and the height are replaced and the ascent and the descent are maximized as when calculated directly.
+     */
+    ///@{
+    void InitTextExtend(TextExtend *extend) const;
+    void MergeTextExtend(const TextExtend &cached, TextExtend *extend) const;
+    ///@}
+
 public:
     //
 protected:
@@ -8,6 +8,12 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <atomic>
+#include <mutex>
+#include <set>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "expansionmap.h"
 #include "facsimile.h"
@@ -27,6 +33,7 @@ class Glyph;
 class Pages;
 class Page;
 class Score;
+class ThreadPool;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
@@ -78,9 +85,20 @@ public:
      */
     ///@{
     const Resources &GetResources() const { return m_resources; }
-    Resources &GetResourcesForModification() { return m_resources; }
+    Resources &GetResourcesForModification()
+    {
+        this->ResetScaledGlyphMetrics(false);
+        return m_resources;
+    }
     ///@}
 
+    /**
+     * Getter for the thread pool used for processing systems concurrently.
+     * Return NULL when the threads option is lower than 2.
+     * The pool is created lazily and re-created when the option value changes.
+     */
+    ThreadPool *GetThreadPool();
+
     /**
      * Generate a document scoreDef when none is provided.
      * This only looks at the content first system of the document.
@@ -201,6 +219,12 @@ public:
     FontInfo *GetFingeringFont(int staffSize);
     ///@}
 
+    /**
+     * Get the lyric font point size for a staff size.
+     * Unlike GetDrawingLyricFont, it does not change the member font and can be used when processing systems concurrently.
+     */
+    int GetDrawingLyricFontSize(int staffSize) const { return m_drawingLyricFontSize * staffSize / 100; }
+
     /**
      * Get the ratio between the lyric font size and the music font size.
      * This is used when the music font is used within text.
@@ -246,6 +270,12 @@ public:
      */
     void ExportMIDI(smf::MidiFile *midiFile);
 
+    /**
+     * Export the document to Standard MIDI File data.
+     * The events are sorted and encoded directly, which gives the same data as smf::MidiFile::write.
+     */
+    void ExportMIDI(std::vector<unsigned char> &midiData);
+
     /**
      * Extract a timemap from the document to a JSON string.
      * Run trough all the layers and fill the timemap file content.
@@ -287,6 +317,19 @@ public:
      */
     void PrepareData();
 
+    /**
+     * Prepare the document data after editing.
+     * Only the measures marked as changed and the ones depending on them are prepared again, unless the option
+     * --prepare-data is set to full. The entire document is prepared when the changes cannot be limited to measures.
+     */
+    void PrepareChangedData();
+
+    /**
+     * Mark the measure of an object as changed for the next call to Doc::PrepareChangedData.
+     * Must be called before the object is modified or deleted.
+     */
+    void MarkDataChanged(const Object *object);
+
     /**
      * Casts off the entire document.
      * Starting from a single system, create and fill pages and systems.
@@ -433,8 +476,12 @@ public:
 
     /**
      * Return true if the document has been cast off already.
+     * Set it for a document imported with the pages of a cast-off document.
      */
+    ///@{
     bool IsCastOff() const { return m_isCastOff; }
+    void SetCastOff(bool isCastOff) { m_isCastOff = isCastOff; }
+    ///@}
 
     /**
      * @name Methods for managing a selection.
@@ -467,16 +514,80 @@ public:
     ///@}
 
 private:
+    /**
+     * The metrics of a SMuFL glyph scaled for a staff size and a grace size.
+     * m_isSet is false for a code point without glyph.
+     */
+    struct ScaledGlyphMetrics {
+        int m_x;
+        int m_y;
+        int m_width;
+        int m_height;
+        int m_advX;
+        bool m_isSet;
+    };
+
+    /**
+     * The table of the scaled metrics of all the SMuFL code points for a staff size and a grace size.
+     * The font size and the grace factor are the ones used for scaling the metrics.
+     */
+    struct ScaledGlyphMetricTable {
+        int m_fontSize;
+        double m_graceFactor;
+        std::vector<ScaledGlyphMetrics> m_metrics;
+    };
+
     /**
      * Calculates the music font size according to the m_interlDefin reference value.
      */
     int CalcMusicFontSize();
 
+    /**
+     * Scale a glyph value (in font units) with the music font size, the staff size and the grace size.
+     */
+    int ScaleGlyphValue(int value, const Glyph *glyph, int staffSize, bool graceSize) const;
+
+    /**
+     * Return the scaled metrics of a SMuFL glyph, or NULL when no table can be used.
+     * The table of the staff size and grace size is built on the first call and can be shared between threads.
+     */
+    const ScaledGlyphMetrics *GetScaledGlyphMetrics(char32_t code, int staffSize, bool graceSize) const;
+
+    /**
+     * Delete the tables of scaled glyph metrics.
+     * Only the tables with another font size or grace factor than the current ones are deleted with outdatedOnly.
+     * Must not be called while the tables are used by other threads.
+     */
+    void ResetScaledGlyphMetrics(bool outdatedOnly);
+
+    /**
+     * Prepare the document data for the measures matching the comparison (all of them when NULL)
+     */
+    void PrepareData(Comparison *measureComparison);
+
     /**
      * Generate the measure indices
      */
     void PrepareMeasureIndices();
 
+    /**
+     * Process the functor in the order of the expansion when its repeated elements are shared.
+     * The system-level objects are processed one by one, which means that the document, the pages and the systems
+     * are not visited. Process the document otherwise.
+     */
+    ///@{
+    void ProcessInExpansionOrder(Functor &functor);
+    void ProcessInExpansionOrder(ConstFunctor &functor) const;
+    ///@}
+
+    /**
+     * Return the page-level and system-level objects of the document in the order of the shared expansion
+     */
+    ///@{
+    std::vector<Object *> GetObjectsInExpansionOrder();
+    std::vector<const Object *> GetObjectsInExpansionOrder() const;
+    ///@}
+
 public:
     Page *m_selectionPreceding;
     Page *m_selectionFollowing;
@@ -545,6 +656,20 @@ private:
      */
     Resources m_resources;
 
+    /**
+     * The thread pool (owned, NULL if not used).
+     */
+    ThreadPool *m_threadPool;
+
+    /**
+     * The tables of scaled glyph metrics by staff size and grace size (owned, NULL until used).
+     * The mutex protects the creation of the tables.
+     */
+    ///@{
+    mutable std::vector<std::atomic<ScaledGlyphMetricTable *>> m_scaledGlyphMetrics;
+    mutable std::mutex m_scaledGlyphMetricsMutex;
+    ///@}
+
     /**
      * @name Holds a pointer to the current score/scoreDef.
      * Set by Doc::GetCurrentScoreDef or explicitly through Doc::SetCurrentScoreDef
@@ -602,6 +727,17 @@ private:
      */
     bool m_dataPreparationDone;
 
+    /**
+     * @name The changes since the last data preparation (see Doc::MarkDataChanged)
+     * The measures and the ranges of measure indices depending on each other are the ones of the last preparation.
+     */
+    ///@{
+    std::set<const Object *> m_changedMeasures;
+    bool m_fullPreparationNeeded;
+    ListOfConstObjects m_dependencyMeasures;
+    std::vector<std::pair<int, int>> m_dependencyRanges;
+    ///@}
+
     /**
      * A flag to indicate that the timemap has been calculated.  The
      * timemap needs to be prepared before MIDI files or timemap JSON files
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <string>
 #include <utility>
+#include <vector>
 
 //--------------------------------------------------------------------------------
 
@@ -32,9 +33,20 @@ public:
         m_doc = doc;
         m_view = view;
         m_editInfo.reset();
+        m_isInTransaction = false;
+        m_transactionNeedsPrepareData = false;
+        m_transactionNeedsLayOut = false;
+        m_isPageBasedData = false;
     }
     virtual ~EditorToolkit() {}
 
+    /**
+     * Perform an editor action, including the transaction ones ("begin", "commit" and "rollback").
+     * The action is parsed by ParseEditorAction and added to the current transaction, which is aborted if the action
+     * fails.
+     */
+    bool PerformAction(const std::string &json_editorAction);
+
     /**
      * In child classes, this parses the provided editor action and then performs the correct action.
      */
@@ -44,10 +56,81 @@ public:
      */
     virtual std::string EditInfo() { return m_editInfo.json(); }
 
+    /**
+     * @name Transactions grouping editor actions.
+     * Within a transaction, the preparation of the data and the layout of the page are deferred to the commit and
+     * done once. When the transaction is aborted, the MEI of the document saved at its beginning is made available
+     * for the document to be restored by the toolkit.
+     */
+    ///@{
+    bool BeginTransaction();
+    bool CommitTransaction();
+    void AbortTransaction();
+    bool IsInTransaction() const { return m_isInTransaction; }
+    bool HasRollbackData() const { return !m_rollbackData.empty(); }
+    std::string TakeRollbackData();
+    ///@}
+
+    /**
+     * Set if the document was loaded from page-based MEI.
+     * It is then saved as page-based MEI at the beginning of a transaction because its score-based MEI output does
+     * not keep its structure.
+     */
+    void SetPageBasedData(bool isPageBasedData) { m_isPageBasedData = isPageBasedData; }
+
+protected:
+    /**
+     * Prepare the data and optionally lay out the drawing page after an edit.
+     * Within a transaction, this is done once when committing it.
+     */
+    void UpdateDoc(bool layOut);
+
+    /**
+     * Set the information on the last editor function used
+     */
+    virtual void SetEditInfo(const jsonxx::Object &editInfo) { m_editInfo = editInfo; }
+
+    /**
+     * Called when committing a transaction, before the deferred work is done
+     */
+    virtual void OnCommitTransaction() {}
+
+    /**
+     * Reset the data kept by the editor on the objects of the document (e.g., when it is restored)
+     */
+    virtual void ResetDocCaches() {}
+
+private:
+    /**
+     * Add the IDs of the elements given in the action and in the edit info to the transaction
+     */
+    void AddAffectedIds(const jsonxx::Object &action);
+
+    /**
+     * Return the edit info completed with the IDs of the elements affected by the last transaction
+     */
+    jsonxx::Object GetTransactionInfo(jsonxx::Object info) const;
+
+public:
+    //
 protected:
     Doc *m_doc;
     View *m_view;
     jsonxx::Object m_editInfo;
+
+private:
+    /** The transaction status and the work deferred to the commit */
+    bool m_isInTransaction;
+    bool m_transactionNeedsPrepareData;
+    bool m_transactionNeedsLayOut;
+    /** The document was loaded from page-based MEI */
+    bool m_isPageBasedData;
+    /** The IDs of the elements affected by the last transaction, in the order of the actions */
+    std::vector<std::string> m_transactionIds;
+    /** The MEI of the document at the beginning of the transaction */
+    std::string m_transactionSnapshot;
+    /** The MEI to restore after a transaction was aborted */
+    std::string m_rollbackData;
 };
 } // namespace vrv
 
@@ -61,6 +61,11 @@ protected:
     bool Set(std::string &elementId, std::string const &attribute, std::string const &value);
     ///@}
 
+    /**
+     * The data is prepared when committing a transaction, as with the commit action
+     */
+    void OnCommitTransaction() override { this->UpdateDoc(false); }
+
     bool InsertNote(Object *object);
 
     bool DeleteNote(Note *note);
@@ -16,6 +16,7 @@
 
 #include "doc.h"
 #include "editortoolkit.h"
+#include "spatialindex.h"
 #include "view.h"
 #include "zone.h"
 
@@ -29,7 +30,7 @@ namespace vrv {
 
 class EditorToolkitNeume : public EditorToolkit {
 public:
-    EditorToolkitNeume(Doc *doc, View *view) : EditorToolkit(doc, view) {}
+    EditorToolkitNeume(Doc *doc, View *view) : EditorToolkit(doc, view) { m_staffIndexIsValid = false; }
     bool ParseEditorAction(const std::string &json_editorAction);
     virtual std::string EditInfo() { return m_infoObject.json(); };
 
@@ -85,10 +86,31 @@ protected:
     ///@{
     bool AdjustPitchFromPosition(Object *obj, Clef *clef = NULL);
     bool AdjustClefLineFromPosition(Clef *clef, Staff *staff = NULL);
+    Staff *FindClosestStaff(int x, int y);
     ///@}
 
+    void SetEditInfo(const jsonxx::Object &editInfo) override { m_infoObject = editInfo; }
+    void ResetDocCaches() override { m_staffIndexIsValid = false; }
+
 private:
+    /**
+     * @name Methods for the spatial index of the staff zones.
+     * The index is built lazily and kept up-to-date by the actions moving, adding or removing staves.
+     */
+    ///@{
+    void BuildStaffIndex();
+    void InsertInStaffIndex(Staff *staff);
+    void UpdateStaffIndex(Staff *staff);
+    ///@}
+
     jsonxx::Object m_infoObject;
+    /** The spatial index of the staff zones and a flag indicating that it is up-to-date */
+    SpatialIndex m_staffIndex;
+    bool m_staffIndexIsValid;
+    /** The largest absolute slope of the staves in the index */
+    double m_staffIndexMaxSlope;
+    /** The bounds of the boxes in the index */
+    int m_staffIndexX1, m_staffIndexY1, m_staffIndexX2, m_staffIndexY2;
 };
 
 //--------------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #define __VRV_EXPANSION_MAP_H__
 
 #include <map>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
@@ -40,11 +41,31 @@ public:
 
     /**
      * Expand expansion recursively
+     * With shared, the repeated elements are not cloned and only their expanded IDs and their position are stored
      */
-    void Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &existingList, Object *prevSection);
+    void Expand(
+        const xsdAnyURI_List &expansionList, xsdAnyURI_List &existingList, Object *prevSection, bool shared = false);
 
     std::vector<std::string> GetExpansionIDsForElement(const std::string &xmlId);
 
+    /**
+     * Return the ID of the element for the given repeat (1-based, in the playback order) in a shared expansion.
+     * Return the notated ID if the element was not repeated that often.
+     */
+    std::string GetRepeatID(const std::string &xmlId, int repeat) const;
+
+    /**
+     * Check if the expansion has repeated elements that are shared and not cloned
+     */
+    bool HasSharedRepeats() const { return !m_sharedRepeats.empty(); }
+
+    /**
+     * Return the positions of the objects (in the document order) in the order of the shared expansion.
+     * The objects of a repeated element are inserted again after the element it follows in the expansion.
+     * The objects are expected to be system-level objects, with the milestone ends of the repeated elements.
+     */
+    std::vector<int> GetSharedPlaybackOrder(const std::vector<const Object *> &objects) const;
+
     /**
      * Write the currentexpansionMap to a JSON string
      */
@@ -60,11 +81,20 @@ private:
     /** Ads an id string to an original/notated id */
     bool AddExpandedIDToExpansionMap(const std::string &origXmlId, std::string newXmlId);
 
+    /** Return the last object of an element, i.e., its milestone end in a page-based document */
+    static const Object *GetLastObject(const Object *object);
+
 public:
     /** The expansion map indicates which xmlId has been repeated (expanded) elsewhere */
     std::map<std::string, std::vector<std::string>> m_map;
 
 private:
+    /**
+     * The IDs of the repeated elements of a shared expansion with the element they follow, in the expansion order.
+     * They are IDs and not pointers because the objects can be replaced after the expansion, e.g., when the document
+     * is restored after a transaction was rolled back.
+     */
+    std::vector<std::pair<std::string, std::string>> m_sharedRepeats;
 };
 
 } // namespace vrv
@@ -95,7 +95,7 @@ public:
      * @name Get and set the drawing object IDs
      */
     ///@{
-    void ResetDrawingObjectIDs();
+    static void ResetDrawingObjectIDs();
     ///@}
 
     /**
@@ -320,6 +320,19 @@ public:
     char m_spanningType;
 };
 
+//----------------------------------------------------------------------------
+// CurveAdjustment
+//----------------------------------------------------------------------------
+/**
+ * The adjustments of a curve on the left and right hand side of a spanned element.
+ * Discard is true if the element already fits.
+ */
+struct CurveAdjustment {
+    int left;
+    int right;
+    bool discard;
+};
+
 //----------------------------------------------------------------------------
 // FloatingCurvePositioner
 //----------------------------------------------------------------------------
@@ -382,6 +395,14 @@ public:
         bool &discard, int margin = 0, bool horizontalOverlap = true) const;
     ///@}
 
+    /**
+     * Calculate the left and right adjustments for all the spanned elements at once.
+     * This is equivalent to calling CalcDirectionalLeftRightAdjustment for each of them, but the thick bezier is
+     * calculated only once and evaluated for all the bounding boxes with BoundingBox::CalcBezierAtPositions.
+     * Discarded spanned elements get no adjustment.
+     */
+    std::vector<CurveAdjustment> CalcSpannedElementAdjustments(int margin) const;
+
     /**
      * @name Getters for the current parameters
      */
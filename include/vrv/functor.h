@@ -75,6 +75,23 @@ public:
      */
     virtual bool ImplementsEndInterface() const = 0;
 
+    /**
+     * Return true if copies of the functor can process distinct systems concurrently (see Page::ProcessSystems).
+     * The functor must then not add, remove or modify children, and must not build lists lazily.
+     */
+    virtual bool IsThreadSafe() const { return false; }
+
+    /**
+     * Getters/Setters for profiling the processing (see ProfilerScope)
+     */
+    ///@{
+    int GetProcessDepth() const { return m_processDepth; }
+    void SetProcessDepth(int depth) { m_processDepth = depth; }
+    long GetVisitCount() const { return m_visitCount; }
+    void IncreaseVisitCount() { ++m_visitCount; }
+    void ResetVisitCount() { m_visitCount = 0; }
+    ///@}
+
 private:
     //
 public:
@@ -88,6 +105,9 @@ private:
     bool m_visibleOnly = true;
     // The direction stack
     std::stack<bool> m_direction;
+    // The nesting level of Object::Process and the number of visited objects when profiling
+    int m_processDepth = 0;
+    long m_visitCount = 0;
 };
 
 //----------------------------------------------------------------------------
@@ -72,6 +72,12 @@ public:
     // read
     virtual bool Import(std::string const &data) { return true; }
 
+    /**
+     * Import the data from a buffer that is not copied into a string first.
+     * Importers that cannot read from a buffer get it copied and passed to Import.
+     */
+    virtual bool ImportBuffer(const char *data, size_t length) { return this->Import(std::string(data, length)); }
+
     /**
      * Getter for layoutInformation flag that is set to true during import
      * if layout information is found (and not to be ignored).
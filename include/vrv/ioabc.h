@@ -37,6 +37,22 @@ class Slur;
 class Staff;
 class Tie;
 
+//----------------------------------------------------------------------------
+// ABCTune
+//----------------------------------------------------------------------------
+
+/**
+ * The position of a tune in an ABC collection.
+ * A tune starts with its X: field and ends before the X: field of the next one.
+ */
+struct ABCTune {
+    int m_n = 0; // X:
+    std::string m_title; // first T:
+    size_t m_offset = 0;
+    size_t m_length = 0;
+    int m_line = 0;
+};
+
 //----------------------------------------------------------------------------
 // ABCInput
 //----------------------------------------------------------------------------
@@ -49,12 +65,40 @@ public:
 
     bool Import(const std::string &abc) override;
 
+    /**
+     * Return the tunes of the last import
+     */
+    const std::vector<ABCTune> &GetTunes() const { return m_tunes; }
+
 #ifndef NO_ABC_SUPPORT
 
+    /**
+     * Find the tunes of an ABC collection by scanning the X: and T: fields.
+     * The data is not copied and the content of the tunes is not parsed.
+     */
+    static std::vector<ABCTune> SplitTunes(const std::string &abc);
+
 private:
     // function declarations:
 
     void ParseABC(std::istream &infile);
+    void ParseTunes(std::istream &infile);
+
+    /**
+     * Read the file header, i.e., the information fields before the first tune, which apply to every tune.
+     * AddFileHeaderField keeps the line when it is an information field not specific to a tune.
+     */
+    ///@{
+    void ReadFileHeader(std::istream &infile);
+    void AddFileHeaderField(const std::string &line);
+    ///@}
+
+    /**
+     * Import the tunes of a collection concurrently with the thread pool of the document.
+     * Each tune is parsed in a document of its own and its mdiv is then moved to the document.
+     * The ids then come from a seed drawn for each tune and differ from the ones of the sequential parsing.
+     */
+    void ImportCollection(const std::string &abc);
 
     // parsing functions
     int SetBarLine(const std::string &musicCode, int index);
@@ -107,6 +151,9 @@ private:
     };
 
     std::string m_filename;
+    std::vector<ABCTune> m_tunes;
+    // the information fields of the file header with their line number
+    std::vector<std::pair<std::string, int>> m_fileHeader;
     Mdiv *m_mdiv = NULL;
     Clef *m_clef = NULL;
     KeySig *m_key = NULL;
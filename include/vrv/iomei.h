@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <stack>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -193,8 +194,12 @@ public:
 
     /**
      * The main method for exporting the file to MEI.
+     * Without output stream the file is written to the stringstream member.
      */
+    ///@{
     bool Export();
+    bool Export(std::ostream &output);
+    ///@}
 
     /**
      * The main method for writing objects.
@@ -209,6 +214,11 @@ public:
      */
     std::string GetOutput();
 
+    /**
+     * Write the output directly to the output stream.
+     */
+    bool GetOutput(std::ostream &output);
+
     /**
      * @name Setter and getter for score-based MEI output
      */
@@ -602,8 +612,40 @@ public:
     virtual ~MEIInput();
 
     bool Import(const std::string &mei) override;
+    bool ImportBuffer(const char *data, size_t length) override;
+
+    /**
+     * Setter for the expansion of the score-based MEI according to the expand option.
+     * It is disabled for data in which the expansion was already applied.
+     */
+    void SetExpandExpansions(bool expandExpansions) { m_expandExpansions = expandExpansions; }
 
 private:
+    /**
+     * The children contexts in which elements are read through MEIInput::s_elementReaders.
+     * The values are flags because a reader is shared by several contexts.
+     */
+    enum ChildrenContext {
+        CHILDREN_FB = 1 << 0,
+        CHILDREN_LAYER = 1 << 1,
+        CHILDREN_LAYERDEF = 1 << 2,
+        CHILDREN_MEASURE = 1 << 3,
+        CHILDREN_METERSIGGRP = 1 << 4,
+        CHILDREN_RUNNING = 1 << 5,
+        CHILDREN_SCOREDEF = 1 << 6,
+        CHILDREN_STAFF = 1 << 7,
+        CHILDREN_STAFFDEF = 1 << 8,
+        CHILDREN_STAFFGRP = 1 << 9,
+        CHILDREN_SYMBOLDEF = 1 << 10,
+        CHILDREN_TEXT = 1 << 11,
+        CHILDREN_TUNING = 1 << 12
+    };
+
+    /**
+     * A method reading an element and adding it to the parent
+     */
+    typedef bool (MEIInput::*ElementReader)(Object *parent, pugi::xml_node element);
+
     bool ReadDoc(pugi::xml_node root);
     bool ReadIncipits(pugi::xml_node root);
 
@@ -852,6 +894,12 @@ private:
      */
     bool IsEditorialElementName(std::string elementName);
 
+    /**
+     * Return the reader registered in MEIInput::s_elementReaders for the element name within the children context.
+     * Return NULL if the element is not read with a table reader in that context.
+     */
+    ElementReader GetElementReader(const std::string &elementName, ChildrenContext context) const;
+
     /**
      * Normalize attributes of xmlElement, removing white spaces if necessary
      */
@@ -931,6 +979,16 @@ private:
      */
     bool m_hasScoreDef;
 
+    /**
+     * A flag indicating that the XML nodes of the score are removed from the XML tree once read
+     */
+    bool m_discardReadNodes;
+
+    /**
+     * A flag indicating that the expansion is applied when reading score-based MEI
+     */
+    bool m_expandExpansions;
+
     /**
      * Check if an element is allowed within a given parent
      */
@@ -955,6 +1013,11 @@ private:
      * A static array for storing the implemented editorial elements
      */
     static const std::vector<std::string> s_editorialElementNames;
+
+    /**
+     * A static table with the reader of each element name and the children contexts (flags) it is read in
+     */
+    static const std::unordered_map<std::string, std::pair<ElementReader, int>> s_elementReaders;
 };
 
 } // namespace vrv
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        mappedfile.h
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_MAPPEDFILE_H__
+#define __VRV_MAPPEDFILE_H__
+
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// MappedFile
+//----------------------------------------------------------------------------
+
+/**
+ * This class gives a read-only view on the content of a file.
+ * The file is memory-mapped when possible and read into a buffer otherwise (Windows, Emscripten).
+ * The content remains valid until the file is closed or the object destroyed.
+ */
+class MappedFile {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ///@}
+
+    /**
+     * Open the file and map its content.
+     * Return false if the file cannot be opened or read.
+     */
+    bool Open(const std::string &filename);
+
+    /**
+     * Unmap the content of the file
+     */
+    void Close();
+
+    /**
+     * @name Getters for the content of the file
+     */
+    ///@{
+    const char *GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+    ///@}
+
+private:
+    //
+public:
+    //
+private:
+    /** The content of the file */
+    const char *m_data;
+    size_t m_size;
+    /** A flag indicating that m_data is memory-mapped (and not pointing to m_buffer) */
+    bool m_isMapped;
+    /** The buffer the file is read into when it is not memory-mapped */
+    std::vector<char> m_buffer;
+
+}; // class MappedFile
+
+} // namespace vrv
+
+#endif // __VRV_MAPPEDFILE_H__
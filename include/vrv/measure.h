@@ -298,7 +298,10 @@ public:
     /**
      * Read only access to m_scoreTimeOffset
      */
+    ///@{
     double GetLastTimeOffset() const { return m_scoreTimeOffset.back(); }
+    double GetScoreTimeOffset(int repeat) const;
+    ///@}
 
     /**
      * Return the real time offset in milliseconds
@@ -16,6 +16,7 @@ class MidiFile;
 
 namespace vrv {
 
+class ExpansionMap;
 class FeatureExtractor;
 class Timemap;
 
@@ -132,6 +133,8 @@ private:
     double m_tempoAdjustment;
     // The factor for multibar rests
     int m_multiRestFactor;
+    // The measures visited so far, which are visited for each repeat in a shared expansion
+    std::set<const Measure *> m_visitedMeasures;
 };
 
 //----------------------------------------------------------------------------
@@ -205,12 +208,22 @@ public:
     const std::map<const Note *, double> &GetDeferredNotes() const { return m_deferredNotes; }
     ///@}
 
+    /**
+     * Return true if the tracks can be generated independently from each other.
+     * This is not the case with beat repeats (reading back the events of the track), sameas links (processed
+     * from the layer of the linking element) or several scores (each one set as current score when processed).
+     */
+    bool HasIndependentTracks() const { return (!m_hasTrackDependencies && (m_scoreCount < 2)); }
+
     /*
      * Functor interface
      */
     ///@{
     FunctorCode VisitArpeg(const Arpeg *arpeg) override;
+    FunctorCode VisitBeatRpt(const BeatRpt *beatRpt) override;
+    FunctorCode VisitLayerElement(const LayerElement *layerElement) override;
     FunctorCode VisitMeasure(const Measure *measure) override;
+    FunctorCode VisitScore(const Score *score) override;
     ///@}
 
 protected:
@@ -224,6 +237,10 @@ private:
     double m_currentTempo;
     // Deferred notes which start slightly later
     std::map<const Note *, double> m_deferredNotes;
+    // Flag indicating that the generation of a track depends on other tracks
+    bool m_hasTrackDependencies;
+    // The number of scores in the document
+    int m_scoreCount;
 };
 
 //----------------------------------------------------------------------------
@@ -357,6 +374,8 @@ private:
     bool m_cueExclusion;
     // Tablature held notes indexed by (course - 1)
     std::vector<MIDIHeldNote> m_heldNotes;
+    // The number of times each measure was visited, i.e., its current repeat in a shared expansion
+    std::map<const Measure *, int> m_measureRepeats;
 };
 
 //----------------------------------------------------------------------------
@@ -386,6 +405,11 @@ public:
      */
     void SetCueExclusion(bool cueExclusion) { m_cueExclusion = cueExclusion; }
 
+    /*
+     * Set the expansion map for the IDs of the repeats in a shared expansion
+     */
+    void SetExpansionMap(const ExpansionMap *expansionMap) { m_expansionMap = expansionMap; }
+
     /*
      * Functor interface
      */
@@ -417,6 +441,12 @@ private:
     bool m_cueExclusion;
     // The timemap
     Timemap *m_timemap;
+    // The expansion map (if any)
+    const ExpansionMap *m_expansionMap;
+    // The number of times each measure was visited, i.e., its current repeat in a shared expansion
+    std::map<const Measure *, int> m_measureRepeats;
+    // The repeat of the current measure
+    int m_currentRepeat;
 };
 
 //----------------------------------------------------------------------------
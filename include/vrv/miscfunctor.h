@@ -12,6 +12,8 @@
 
 namespace vrv {
 
+class SpatialIndex;
+
 //----------------------------------------------------------------------------
 // ApplyPPUFactorFunctor
 //----------------------------------------------------------------------------
@@ -112,14 +114,155 @@ private:
     std::vector<ClassId> m_excludeClasses;
 };
 
+//----------------------------------------------------------------------------
+// GetPreparedDataFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class describes the data set by Doc::PrepareData for each object (one line per object).
+ * It is used for comparing the data prepared for the changed measures only with the one prepared for the entire
+ * document. The elements pointed to are given by their ID and timestamps by their measure and time.
+ */
+class GetPreparedDataFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    GetPreparedDataFunctor();
+    virtual ~GetPreparedDataFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Getter for the description of the prepared data
+     */
+    const std::vector<std::string> &GetPreparedData() const { return m_preparedData; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(const Object *object) override;
+    ///@}
+
+protected:
+    //
+private:
+    /**
+     * Return the ID of an object, or the measure and the time of a timestamp
+     */
+    std::string GetReference(const Object *object) const;
+
+public:
+    //
+private:
+    // The description of the prepared data by object
+    std::vector<std::string> m_preparedData;
+};
+
+//----------------------------------------------------------------------------
+// InitDataDependenciesFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class collects the ranges of measures (by index) that have to be prepared together.
+ * With prepared data, the ranges are given by the pointers set by Doc::PrepareData from one measure to another.
+ * Otherwise, only the references encoded in the measures processed when collecting data (e.g., @startid or @tstamp2)
+ * are resolved when processing the document.
+ * In both cases, the ranges also cover the lyric connectors and the sequences of mRpt.
+ */
+class InitDataDependenciesFunctor : public ConstFunctor, public CollectAndProcess {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    InitDataDependenciesFunctor(bool fromPreparedData);
+    virtual ~InitDataDependenciesFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return true; }
+
+    /*
+     * Getter for the ranges of measure indices
+     */
+    const std::vector<std::pair<int, int>> &GetRanges() const { return m_ranges; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitDocEnd(const Doc *doc) override;
+    FunctorCode VisitDot(const Dot *dot) override;
+    FunctorCode VisitLayer(const Layer *layer) override;
+    FunctorCode VisitLayerEnd(const Layer *layer) override;
+    FunctorCode VisitMeasure(const Measure *measure) override;
+    FunctorCode VisitMeasureEnd(const Measure *measure) override;
+    FunctorCode VisitMRpt(const MRpt *mRpt) override;
+    FunctorCode VisitObject(const Object *object) override;
+    FunctorCode VisitSyl(const Syl *syl) override;
+    FunctorCode VisitTurn(const Turn *turn) override;
+    ///@}
+
+protected:
+    //
+private:
+    /**
+     * Add the range from the current measure to the measure of the object
+     */
+    void AddRangeTo(const Object *object);
+
+    /**
+     * Add a range of measure indices - nothing is added when they are the same or one is not set (0)
+     */
+    void AddRange(int index1, int index2);
+
+    /**
+     * Collect a reference to the element with the ID of the URI
+     */
+    void AddReference(const std::string &uri);
+
+public:
+    //
+private:
+    // The ranges are collected from the prepared data
+    bool m_fromPreparedData;
+    // The index of the current measure (0 outside measures) and of the last measure
+    int m_currentIndex;
+    int m_lastIndex;
+    // The staff and layer @n of the current layer, and if it has a mRpt
+    std::pair<int, int> m_currentLayerN;
+    bool m_currentLayerHasMRpt;
+    // The measure index where the current sequence of mRpt starts, by staff/layer @n
+    std::map<std::pair<int, int>, int> m_mRptStarts;
+    // The measure index of the syl with a forward connector, by staff/layer/verse @n
+    std::map<std::tuple<int, int, int>, int> m_sylStarts;
+    // The references collected with the measure index of the element referring to them
+    std::vector<std::pair<int, std::string>> m_references;
+    // The measure index of the element with the IDs referred to (0 when not found yet)
+    std::map<std::string, int> m_referenceIndices;
+    // The ranges of measure indices
+    std::vector<std::pair<int, int>> m_ranges;
+};
+
 //----------------------------------------------------------------------------
 // InitProcessingListsFunctor
 //----------------------------------------------------------------------------
 
 /**
  * This class builds a tree of ints (IntTree) with the staff/layer/verse numbers.
+ * It also indexes the layers by staff/layer numbers in document order, which makes it possible to process one
+ * staff/layer (or staff/layer/verse) stream without traversing the whole tree with filters.
  */
-class InitProcessingListsFunctor : public ConstFunctor {
+class InitProcessingListsFunctor : public Functor {
 public:
     /**
      * @name Constructors, destructors
@@ -142,12 +285,21 @@ public:
     const IntTree &GetVerseTree() const { return m_verseTree; }
     ///@}
 
+    /**
+     * Return the layers with the staff/layer numbers in document order.
+     * Processing them one by one is equivalent to processing the tree filtered by staff and layer for the functors
+     * that visit only the content of the layers.
+     * The index is built by each run of the functor and is valid only until the tree is modified. It is not kept on
+     * the Doc because the tree is edited between the runs and PrepareData can be limited to the changed measures.
+     */
+    const std::vector<Layer *> &GetLayers(int staffN, int layerN) const;
+
     /*
      * Functor interface
      */
     ///@{
-    FunctorCode VisitLayer(const Layer *layer) override;
-    FunctorCode VisitVerse(const Verse *verse) override;
+    FunctorCode VisitLayer(Layer *layer) override;
+    FunctorCode VisitVerse(Verse *verse) override;
     ///@}
 
 protected:
@@ -161,6 +313,50 @@ private:
     IntTree m_layerTree;
     // The IntTree for staff/layer/verse
     IntTree m_verseTree;
+    // The layers by staff/layer
+    std::map<std::pair<int, int>, std::vector<Layer *>> m_layers;
+};
+
+//----------------------------------------------------------------------------
+// InitSpatialIndexFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills a spatial index with the bounding boxes of the objects drawn on a page.
+ * Floating objects are added with the bounding boxes of their positioners, one for each system.
+ */
+class InitSpatialIndexFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    InitSpatialIndexFunctor(SpatialIndex *spatialIndex);
+    virtual ~InitSpatialIndexFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(const Object *object) override;
+    FunctorCode VisitSystem(const System *system) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The spatial index being filled
+    SpatialIndex *m_spatialIndex;
 };
 
 //----------------------------------------------------------------------------
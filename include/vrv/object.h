@@ -666,6 +666,12 @@ public:
 
     static void SeedID(uint32_t seed = 0);
 
+    /**
+     * Draw a seed from the id generator of the calling thread.
+     * Seeding another thread with it keeps the ids reproducible when objects are created concurrently.
+     */
+    static uint32_t GenerateSeed();
+
     static std::string GenerateHashID();
 
     static uint32_t Hash(uint32_t number, bool reverse = false);
@@ -994,9 +1000,14 @@ public:
      */
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
-public:
-    static thread_local MapOfStrConstructors s_ctorsRegistry;
-    static thread_local MapOfStrClassIds s_classIdsRegistry;
+private:
+    /**
+     * The registers are filled by the ClassRegistrar at static initialization and are only read afterwards.
+     * They are members of the static instance so that they are initialized before the first registration and
+     * shared by all the threads.
+     */
+    MapOfStrConstructors m_ctorsRegistry;
+    MapOfStrClassIds m_classIdsRegistry;
 };
 
 //----------------------------------------------------------------------------
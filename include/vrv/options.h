@@ -78,6 +78,8 @@ enum option_MULTIRESTSTYLE {
     MULTIRESTSTYLE_symbols
 };
 
+enum option_PREPAREDATA { PREPAREDATA_full = 0, PREPAREDATA_incremental, PREPAREDATA_validate };
+
 enum option_SYSTEMDIVIDER { SYSTEMDIVIDER_none = 0, SYSTEMDIVIDER_auto, SYSTEMDIVIDER_left, SYSTEMDIVIDER_left_right };
 
 enum option_SMUFLTEXTFONT { SMUFLTEXTFONT_embedded = 0, SMUFLTEXTFONT_linked, SMUFLTEXTFONT_none };
@@ -98,6 +100,7 @@ public:
     {
         m_shortOption = 0;
         m_isCmdOnly = false;
+        m_isRenderOnly = false;
     }
     virtual ~Option() {}
     virtual void CopyTo(Option *option) = 0;
@@ -123,6 +126,13 @@ public:
     char GetShortOption() const { return m_shortOption; }
     bool IsCmdOnly() const { return m_isCmdOnly; }
 
+    /**
+     * Flag the option as changing only the rendering (and not the layout) of the data.
+     * See Toolkit::RequiresRedoLayout
+     */
+    void SetRenderOnly(bool isRenderOnly) { m_isRenderOnly = isRenderOnly; }
+    bool IsRenderOnly() const { return m_isRenderOnly; }
+
     /**
      * Return a JSON object for the option
      */
@@ -143,6 +153,7 @@ public:
     static const std::map<int, std::string> s_header;
     static const std::map<int, std::string> s_multiRestStyle;
     static const std::map<int, std::string> s_pedalStyle;
+    static const std::map<int, std::string> s_prepareData;
     static const std::map<int, std::string> s_systemDivider;
     static const std::map<int, std::string> s_smuflTextFont;
 
@@ -156,6 +167,8 @@ private:
     char m_shortOption;
     /* a flag indicating that the option is available only on the command line */
     bool m_isCmdOnly;
+    /* a flag indicating that the option does not change the layout */
+    bool m_isRenderOnly;
 };
 
 //----------------------------------------------------------------------------
@@ -595,7 +608,9 @@ public:
     OptionBool m_standardOutput;
     OptionBool m_help;
     OptionBool m_allPages;
+    OptionString m_batch;
     OptionString m_inputFrom;
+    OptionInt m_batchJobs;
     OptionString m_logLevel;
     OptionString m_outfile;
     OptionInt m_page;
@@ -620,6 +635,7 @@ public:
     OptionBool m_condenseTempoPages;
     OptionBool m_evenNoteSpacing;
     OptionString m_expand;
+    OptionBool m_expandShared;
     OptionIntMap m_footer;
     OptionIntMap m_header;
     OptionBool m_humType;
@@ -644,7 +660,9 @@ public:
     OptionInt m_pageMarginTop;
     OptionInt m_pageWidth;
     OptionIntMap m_pedalStyle;
+    OptionIntMap m_prepareData;
     OptionBool m_preserveAnalyticalMarkup;
+    OptionBool m_profile;
     OptionBool m_removeIds;
     OptionBool m_scaleToPageSize;
     OptionBool m_showRuntime;
@@ -656,8 +674,10 @@ public:
     OptionBool m_svgViewBox;
     OptionBool m_svgHtml5;
     OptionBool m_svgFormatRaw;
+    OptionBool m_svgPageCache;
     OptionBool m_svgRemoveXlink;
     OptionArray m_svgAdditionalAttribute;
+    OptionInt m_threads;
     OptionDbl m_unit;
     OptionBool m_useFacsimile;
     OptionBool m_usePgFooterForAll;
@@ -8,6 +8,8 @@
 #ifndef __VRV_PAGE_H__
 #define __VRV_PAGE_H__
 
+#include <functional>
+
 #include "object.h"
 #include "scoredef.h"
 
@@ -175,6 +177,16 @@ private:
      */
     bool IsJustificationRequired(const Doc *doc);
 
+    /**
+     * Process a functor working system by system on the page.
+     * With a thread pool (--threads) and a thread safe functor, consecutive systems are processed concurrently with a
+     * copy of the functor each and the merge function is called for each copy in the system order. Systems with
+     * elements spanning over several systems are processed in the document order with the functor itself, which keeps
+     * the result identical to the sequential processing. Other functors are processed with Object::Process.
+     */
+    template <class FUNCTOR>
+    void ProcessSystems(FUNCTOR &functor, const std::function<void(const FUNCTOR &)> &merge = nullptr);
+
     //
 public:
     /** Page width (MEI scoredef@page.width). Saved if != -1 */
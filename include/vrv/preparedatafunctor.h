@@ -43,7 +43,6 @@ public:
      */
     ///@{
     FunctorCode VisitChord(Chord *chord) override;
-    FunctorCode VisitFloatingObject(FloatingObject *floatingObject) override;
     FunctorCode VisitKeySig(KeySig *keySig) override;
     FunctorCode VisitRunningElement(RunningElement *runningElement) override;
     FunctorCode VisitScore(Score *score) override;
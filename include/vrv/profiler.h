@@ -0,0 +1,159 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        profiler.h
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_PROFILER_H__
+#define __VRV_PROFILER_H__
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+class FunctorBase;
+
+/**
+ * The categories of the timings collected by the profiler
+ */
+enum ProfilerCategory { PROFILER_TOOLKIT = 0, PROFILER_IO, PROFILER_LAYOUT, PROFILER_FUNCTOR, PROFILER_CATEGORY_COUNT };
+
+/**
+ * The counters collected by the profiler
+ */
+enum ProfilerCounter {
+    PROFILER_OBJECTS_VISITED = 0,
+    PROFILER_OBJECTS_CREATED,
+    PROFILER_ALIGNMENTS_CREATED,
+    PROFILER_COUNTER_COUNT
+};
+
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+/**
+ * This class collects timings and counters for the whole process.
+ * It is enabled with the --profile option and returns its report as a JSON string.
+ * It stays enabled as long as one toolkit (or the caller) has enabled it and not disabled it.
+ * The timings are grouped by category and name and accumulate until the profiler is reset.
+ * Each timing has its total time and its self time, which excludes the nested timings of the same category.
+ * All the methods can be called from several threads.
+ */
+class Profiler {
+public:
+    /**
+     * @name Enable or disable the profiler
+     * The calls are counted and each call to Enable has to be matched by a call to Disable.
+     */
+    ///@{
+    static void Enable() { s_enabledCount.fetch_add(1, std::memory_order_relaxed); }
+    static void Disable() { s_enabledCount.fetch_sub(1, std::memory_order_relaxed); }
+    static bool IsEnabled() { return (s_enabledCount.load(std::memory_order_relaxed) > 0); }
+    ///@}
+
+    /**
+     * Clear all the timings and counters
+     */
+    static void Reset();
+
+    /**
+     * Add a timing (in seconds) to the entry of the category with the given name
+     */
+    static void AddTiming(
+        ProfilerCategory category, const std::string &name, double seconds, double selfSeconds, long visits = 0);
+
+    /**
+     * Increase a counter when the profiler is enabled
+     */
+    static void Count(ProfilerCounter counter)
+    {
+        if (IsEnabled()) s_counters[counter].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Return the report as a JSON string
+     */
+    static std::string GetReport();
+
+private:
+    /**
+     * A timing entry
+     */
+    struct Timing {
+        long calls = 0;
+        double seconds = 0.0;
+        double selfSeconds = 0.0;
+        long visits = 0;
+    };
+
+public:
+    //
+private:
+    /** The number of times the profiler is enabled */
+    static std::atomic<int> s_enabledCount;
+    /** The counters */
+    static std::atomic<long> s_counters[PROFILER_COUNTER_COUNT];
+    /** The mutex protecting the timings */
+    static std::mutex s_mutex;
+    /** The timings by category and name */
+    static std::map<std::string, Timing> s_timings[PROFILER_CATEGORY_COUNT];
+
+}; // class Profiler
+
+//----------------------------------------------------------------------------
+// ProfilerScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class measures the time spent in a scope and adds it to the profiler when it is destroyed.
+ * Nothing is measured when the profiler is disabled.
+ * With a functor, only the outermost call to Object::Process is measured and the functor class gives the name.
+ * The time of a scope is subtracted from the self time of the enclosing scope of the same category in the thread.
+ */
+class ProfilerScope {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    ProfilerScope(ProfilerCategory category, const char *name);
+    ProfilerScope(FunctorBase &functor);
+    ~ProfilerScope();
+    ProfilerScope(const ProfilerScope &) = delete;
+    ProfilerScope &operator=(const ProfilerScope &) = delete;
+    ///@}
+
+private:
+    //
+public:
+    //
+private:
+    /** The functor being profiled (if any) */
+    FunctorBase *m_functor;
+    /** The category and name of the timing */
+    ProfilerCategory m_category;
+    const char *m_name;
+    /** True if the scope is measured */
+    bool m_active;
+    /** The start time */
+    std::chrono::time_point<std::chrono::steady_clock> m_start;
+    /** The enclosing measured scope and the time of the nested scopes of the same category */
+    ProfilerScope *m_parent;
+    double m_nestedSeconds;
+
+    /** The innermost measured scope of the thread */
+    static thread_local ProfilerScope *s_current;
+
+}; // class ProfilerScope
+
+} // namespace vrv
+
+#endif // __VRV_PROFILER_H__
@@ -8,6 +8,9 @@
 #ifndef __VRV_RESOURCES_H__
 #define __VRV_RESOURCES_H__
 
+#include <array>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 //----------------------------------------------------------------------------
@@ -31,6 +34,8 @@ public:
     using GlyphTable = std::unordered_map<char32_t, Glyph>;
     using GlyphNameTable = std::unordered_map<std::string, char32_t>;
     using GlyphTextMap = std::map<StyleAttributes, GlyphTable>;
+    using AsciiGlyphTable = std::array<const Glyph *, 128>;
+    using AsciiGlyphTextMap = std::map<StyleAttributes, AsciiGlyphTable>;
 
     /**
      * @name Constructors, destructors, and other standard methods
@@ -44,8 +49,8 @@ public:
      * @name Setters and getters
      */
     ///@{
-    static std::string GetDefaultPath() { return s_defaultPath; }
-    static void SetDefaultPath(const std::string &path) { s_defaultPath = path; }
+    static std::string GetDefaultPath();
+    static void SetDefaultPath(const std::string &path);
 
     std::string GetPath() const { return m_path; }
     void SetPath(const std::string &path) { m_path = path; }
@@ -91,6 +96,23 @@ public:
     const Glyph *GetTextGlyph(char32_t code) const;
     ///@}
 
+    /**
+     * Text extent cache.
+     * The extents are cached by string, point size, text style and typeSize flag (or SMuFL flag).
+     * The cache is reset whenever a music or text font is loaded.
+     * Access is thread-safe since the layout can be calculated concurrently.
+     */
+    ///@{
+    /** Look for an extent previously calculated for the string in the current text style */
+    bool GetCachedTextExtent(
+        const std::u32string &text, int pointSize, bool isSmufl, bool typeSize, TextExtend &extend) const;
+    /** Store the extent calculated for the string in the current text style */
+    void SetCachedTextExtent(
+        const std::u32string &text, int pointSize, bool isSmufl, bool typeSize, const TextExtend &extend) const;
+    /** Empty the text extent cache */
+    void ResetTextExtentCache();
+    ///@}
+
     /**
      * Static method that converts unicode music code points to SMuFL equivalent.
      * Return the parameter char if nothing can be converted.
@@ -100,6 +122,37 @@ public:
 private:
     bool LoadFont(const std::string &fontName, bool withFallback = true);
 
+    /** Return the style of the text font actually used for the current style */
+    StyleAttributes GetUsedTextStyle() const;
+    /** Update the pointer to the ASCII glyph table of the current style */
+    void UpdateCurrentAsciiGlyphs() const;
+
+    /**
+     * The key of the text extent cache.
+     * The style is the one actually used (the default style for SMuFL extents)
+     */
+    struct TextExtentKey {
+        std::u32string m_text;
+        int m_pointSize;
+        StyleAttributes m_style;
+        bool m_isSmufl;
+        bool m_typeSize;
+
+        bool operator==(const TextExtentKey &other) const
+        {
+            return (m_pointSize == other.m_pointSize) && (m_style == other.m_style) && (m_isSmufl == other.m_isSmufl)
+                && (m_typeSize == other.m_typeSize) && (m_text == other.m_text);
+        }
+    };
+
+    struct TextExtentKeyHash {
+        size_t operator()(const TextExtentKey &key) const;
+    };
+
+    using TextExtentCache = std::unordered_map<TextExtentKey, TextExtend, TextExtentKeyHash>;
+
+    TextExtentKey MakeTextExtentKey(const std::u32string &text, int pointSize, bool isSmufl, bool typeSize) const;
+
 private:
     /** The font name of the font that is currently loaded */
     std::string m_fontName;
@@ -110,6 +163,13 @@ private:
     /** A text font used for bounding box calculations */
     GlyphTextMap m_textFont;
     mutable StyleAttributes m_currentStyle;
+    /** Flat tables of the ASCII text glyphs for each text style */
+    AsciiGlyphTextMap m_asciiTextGlyphs;
+    /** The ASCII table of the current text style (NULL if no text font is loaded) */
+    mutable const AsciiGlyphTable *m_currentAsciiGlyphs;
+    /** The text extent cache and the mutex for accessing it */
+    mutable TextExtentCache m_textExtentCache;
+    mutable std::shared_mutex m_textExtentCacheMutex;
     /**
      * A map of glyph name / code
      */
@@ -119,8 +179,12 @@ private:
     // Static members //
     //----------------//
 
-    /** The default path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
-    static thread_local std::string s_defaultPath;
+    /**
+     * The default path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML
+     * Shared by all the threads, e.g., when it is set once by a binding and toolkits are created in other threads
+     */
+    static std::string s_defaultPath;
+    static std::mutex s_defaultPathMutex;
 
     /** The default font style */
     static const StyleAttributes k_defaultStyle;
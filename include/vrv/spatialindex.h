@@ -0,0 +1,151 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        spatialindex.h
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_SPATIALINDEX_H__
+#define __VRV_SPATIALINDEX_H__
+
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+class Object;
+
+//----------------------------------------------------------------------------
+// SpatialIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class is a packed R-tree over the boxes of objects.
+ * The boxes are first added and the tree is then packed with the Sort-Tile-Recursive algorithm.
+ * Boxes added or removed once the tree is built are kept aside and the tree is packed again when they become too
+ * many, so the index can be maintained when objects move.
+ * The coordinate system is the one of the boxes inserted (e.g., the logical one for the layout).
+ */
+class SpatialIndex {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SpatialIndex();
+    virtual ~SpatialIndex() = default;
+    ///@}
+
+    /**
+     * Remove all the boxes
+     */
+    void Reset();
+
+    /**
+     * Add the box of an object.
+     * An object can be added with several boxes.
+     */
+    void Insert(const Object *object, int x1, int y1, int x2, int y2);
+
+    /**
+     * Remove all the boxes of an object.
+     */
+    void Remove(const Object *object);
+
+    /**
+     * Pack the tree for the boxes inserted.
+     */
+    void Build();
+
+    /**
+     * @name Getters
+     */
+    ///@{
+    bool IsBuilt() const { return m_isBuilt; }
+    int GetSize() const { return (int)m_entries.size() - m_removedCount; }
+    ///@}
+
+    /**
+     * Return the objects with a box containing the point.
+     * The objects are ordered by box area, starting with the smallest one.
+     */
+    std::vector<const Object *> FindAtPoint(int x, int y) const;
+
+    /**
+     * Return the objects with a box intersecting the rectangle (or contained in it).
+     * The objects are ordered from left to right.
+     */
+    std::vector<const Object *> FindInRect(int x1, int y1, int x2, int y2, bool contained = false) const;
+
+private:
+    /**
+     * A rectangle with x1 <= x2 and y1 <= y2
+     */
+    struct Rect {
+        int m_x1;
+        int m_y1;
+        int m_x2;
+        int m_y2;
+
+        bool Intersects(const Rect &other) const
+        {
+            return (m_x1 <= other.m_x2) && (other.m_x1 <= m_x2) && (m_y1 <= other.m_y2) && (other.m_y1 <= m_y2);
+        }
+        bool Contains(const Rect &other) const
+        {
+            return (m_x1 <= other.m_x1) && (other.m_x2 <= m_x2) && (m_y1 <= other.m_y1) && (other.m_y2 <= m_y2);
+        }
+        long long GetArea() const { return (long long)(m_x2 - m_x1) * (long long)(m_y2 - m_y1); }
+    };
+
+    /**
+     * A box of an object (leaf level of the tree)
+     */
+    struct Entry {
+        Rect m_rect;
+        const Object *m_object;
+    };
+
+    /**
+     * A node covering the children in [m_first, m_first + m_count) in the level below
+     */
+    struct Node {
+        Rect m_rect;
+        int m_first;
+        int m_count;
+    };
+
+    /**
+     * The number of boxes added since the tree was packed
+     */
+    int GetUnpackedCount() const { return (int)m_entries.size() - m_packedCount; }
+
+    /**
+     * Sort the items in tiles and return the nodes grouping them by NODE_CAPACITY
+     */
+    template <class ITEM> std::vector<Node> PackLevel(std::vector<ITEM> &items) const;
+
+    /**
+     * Visit the entries with a rectangle intersecting the query and call the visitor on them
+     */
+    template <class VISITOR> void Search(const Rect &query, VISITOR visitor) const;
+
+public:
+    //
+private:
+    /** The boxes, reordered when the tree is built; removed boxes have no object */
+    std::vector<Entry> m_entries;
+    /** The number of boxes packed in the tree, the other ones are searched linearly */
+    int m_packedCount;
+    /** The number of boxes removed */
+    int m_removedCount;
+    /** The levels of nodes, from the one grouping the entries up to the root one */
+    std::vector<std::vector<Node>> m_levels;
+    /** A flag indicating that the tree is up-to-date */
+    bool m_isBuilt;
+};
+
+} // namespace vrv
+
+#endif // __VRV_SPATIALINDEX_H__
@@ -73,6 +73,23 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * Write the SVG to the output stream as it is serialized, without building a string.
+     * Add the xml tag if necessary. The SVG is then not kept and cannot be retrieved with GetStringSVG.
+     */
+    void WriteSVG(std::ostream &output, bool xml_declaration = false);
+
+    /**
+     * @name Size of the svg root element as written in Commit()
+     * The size is in px (or in mm with mmOutput) and is the base size when one is given.
+     * The attributes are width and height, or viewBox, as serialized in the output.
+     */
+    ///@{
+    static std::pair<double, double> GetRootSize(
+        int width, int height, double userScale, bool mmOutput, std::pair<int, int> baseSize = { 0, 0 });
+    static std::string GetRootSizeAttributes(std::pair<double, double> rootSize, bool mmOutput, bool viewBox);
+    ///@}
+
     /**
      * @name Drawing methods
      */
@@ -279,10 +296,10 @@ private:
     void IncludeTextFont(const std::string &fontname, const Resources *resources);
 
     /**
-     * Flush the data to the internal buffer.
+     * Flush the data to the output stream.
      * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs
      */
-    void Commit(bool xml_declaration);
+    void Commit(bool xml_declaration, std::ostream &output);
 
     void WriteLine(std::string);
 
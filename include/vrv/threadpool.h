@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.h
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_THREADPOOL_H__
+#define __VRV_THREADPOOL_H__
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds a fixed set of worker threads for running independent tasks concurrently.
+ * The tasks of a run are identified by their index and the calling thread takes part in the run.
+ * With a thread count of 0 or 1 tasks are run sequentially.
+ */
+class ThreadPool {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    ThreadPool(int threadCount);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ///@}
+
+    /**
+     * Return the number of threads running tasks (including the calling thread)
+     */
+    int GetThreadCount() const { return (int)m_workers.size() + 1; }
+
+    /**
+     * Run the task for every index in [0, taskCount) and return once all of them are done.
+     * The order in which the indexes are processed is not defined.
+     */
+    void Run(int taskCount, const std::function<void(int)> &task);
+
+private:
+    /**
+     * The loop of the worker threads
+     */
+    void WorkerLoop();
+
+    /**
+     * Process the tasks of the current run until none is left.
+     * Must be called with the lock held.
+     */
+    void ProcessTasks(std::unique_lock<std::mutex> &lock);
+
+public:
+    //
+private:
+    /** The worker threads */
+    std::vector<std::thread> m_workers;
+    /** The mutex protecting the state below */
+    std::mutex m_mutex;
+    /** Condition for waking up the workers when a run starts */
+    std::condition_variable m_runCondition;
+    /** Condition for waking up the calling thread when a run is done */
+    std::condition_variable m_doneCondition;
+    /** The task of the current run (NULL when idle) */
+    const std::function<void(int)> *m_task;
+    /** The number of tasks and the next one to process for the current run */
+    int m_taskCount;
+    int m_nextTask;
+    /** The number of tasks still being processed */
+    int m_pendingTasks;
+    /** A counter incremented for every run */
+    unsigned long m_generation;
+    /** A flag for stopping the workers */
+    bool m_stop;
+
+}; // class ThreadPool
+
+} // namespace vrv
+
+#endif // __VRV_THREADPOOL_H__
@@ -9,11 +9,13 @@
 #define __VRV_TOOLKIT_H__
 
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
 #include "doc.h"
 #include "docselection.h"
+#include "spatialindex.h"
 #include "toolkitdef.h"
 #include "view.h"
 
@@ -22,7 +24,9 @@
 namespace vrv {
 
 class EditorToolkit;
+class Input;
 class RuntimeClock;
+class SvgDeviceContext;
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
@@ -96,6 +100,22 @@ public:
      */
     std::string GetLog();
 
+    /**
+     * Get the profiling report collected since the last reset.
+     *
+     * The profiling is enabled with the --profile option. The report is a JSON object with the timings (calls and
+     * seconds) of the toolkit methods, the input and output stages, the layout stages and the functors, followed by
+     * counters.
+     *
+     * @return The report as a JSON string
+     */
+    std::string GetProfile() const;
+
+    /**
+     * Reset the profiling report.
+     */
+    void ResetProfile();
+
     /**
      * Return the version number.
      *
@@ -126,6 +146,7 @@ public:
      * Load a file from the file system.
      *
      * Previously convert UTF16 files to UTF8 or extract files from MusicXML compressed files.
+     * The file is opened once and memory-mapped when possible, and MEI and MusicXML files are read without copy.
      *
      * @remark nojs
      *
@@ -144,6 +165,20 @@ public:
      */
     bool LoadData(const std::string &data);
 
+    /**
+     * Load data passed as a buffer without copying it into a string first.
+     *
+     * The buffer is read directly by the MEI and MusicXML importers and copied for the other formats.
+     * It has to remain valid only during the call.
+     *
+     * @remark nojs
+     *
+     * @param data A buffer with the data (e.g., MEI data) to be loaded
+     * @param length The size of the data buffer
+     * @return True if the data was successfully loaded
+     */
+    bool LoadData(const char *data, size_t length);
+
     /**
      * Load a MusicXML compressed file passed as base64 encoded string.
      *
@@ -186,6 +221,18 @@ public:
      */
     std::string ValidatePAE(const std::string &data);
 
+    /**
+     * Return the index of the tunes of the ABC data loaded.
+     *
+     * Each tune of a collection starts with an X: field and is loaded in an mdiv of its own.
+     * A tune can be loaded on its own by passing its byte range of the data to Toolkit::LoadData.
+     * The index is empty when the data loaded is not ABC.
+     *
+     * @return A stringified JSON array of objects with the number (X:), the title, the offset and the length of
+     * the tunes
+     */
+    std::string GetABCTuneIndex() const;
+
     /**
      * Return the number of pages in the loaded document.
      *
@@ -315,6 +362,10 @@ public:
     /**
      * Edit the MEI data.
      *
+     * The actions "begin" and "commit" group the actions between them in a transaction.
+     * The preparation of the data and the layout are then done once with the commit, and the document is restored
+     * when an action fails (or with the action "rollback"). The edit info lists the IDs of the elements affected.
+     *
      * @param editorAction The editor actions as a stringified JSON object
      * @return True if the edit action was successfully applied
      **/
@@ -351,6 +402,8 @@ public:
     /**
      * Render a page to SVG.
      *
+     * With svgPageCache, the page is kept and rendering it again with another scale only rescales it.
+     *
      * @param pageNo The page to render (1-based)
      * @param xmlDeclaration True for including the xml declaration in the SVG output
      * @return The SVG page as a string
@@ -375,6 +428,15 @@ public:
      */
     std::string RenderToMIDI();
 
+    /**
+     * Render the document to MIDI as binary data.
+     *
+     * This avoids the base64 encoding and decoding of RenderToMIDI.
+     *
+     * @return The bytes of the MIDI file
+     */
+    std::vector<unsigned char> RenderToMIDIData();
+
     /**
      * Render a document to MIDI and save it to the file.
      *
@@ -545,6 +607,35 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * Return array of IDs of elements drawn at a point of a page.
+     *
+     * The coordinates are the ones of the SVG returned by RenderToSVG with the current options
+     * (including the scale), with the origin at the top left corner of the page.
+     * The elements are found with the bounding boxes calculated for the layout, using a spatial index
+     * built when a page is first queried.
+     *
+     * @param pageNo The page number (1-based)
+     * @param x The x coordinate
+     * @param y The y coordinate
+     * @return A stringified JSON array of IDs, starting with the element with the smallest bounding box
+     */
+    std::string GetElementsAtPoint(int pageNo, int x, int y);
+
+    /**
+     * Return array of IDs of elements drawn in a rectangle of a page.
+     *
+     * The coordinates are the ones of GetElementsAtPoint.
+     *
+     * @param pageNo The page number (1-based)
+     * @param jsonRect A stringified JSON object with the rectangle
+     * x: number; y: number; the top left corner of the rectangle;
+     * width: number; height: number;
+     * contained: true or false; false by default - only elements entirely within the rectangle
+     * @return A stringified JSON array of IDs, ordered from left to right
+     */
+    std::string GetElementsInRect(int pageNo, const std::string &jsonRect);
+
     /**
      * Return the page on which the element is the ID (\@xml:id) is rendered
      *
@@ -622,14 +713,26 @@ public:
     /**
      * Redo the layout of the loaded data.
      *
-     * This can be called once the rendering option were changed, for example with a new page (sceen) height or a new
-     * zoom level.
+     * This can be called once the rendering option were changed, for example with a new page (sceen) height.
+     * A new zoom level (scale) does not require it unless scaleToPageSize is set (see RequiresRedoLayout()).
      *
      * @param jsonOptions A stringified JSON object with the action options
      * resetCache: true or false; true by default;
      */
     void RedoLayout(const std::string &jsonOptions = "");
 
+    /**
+     * Check if changing the options requires the layout to be redone.
+     *
+     * Options changing only the rendering (e.g., the scale or the SVG output options) do not require it and the
+     * pages can be rendered again directly.
+     * Options used when loading the data still require the data to be loaded again.
+     *
+     * @param jsonOptions A stringified JSON object with the options that would be set
+     * @return True if RedoLayout() has to be called after setting the options
+     */
+    bool RequiresRedoLayout(const std::string &jsonOptions) const;
+
     /**
      * Redo the layout of the pitch postitions of the current drawing page.
      *
@@ -674,15 +777,40 @@ public:
      */
     void SetCString(const std::string &data);
 
+    /**
+     * Move the data to the cstring internal buffer without copying it.
+     *
+     * @ingroup nodoc
+     */
+    void SetCString(std::string &&data);
+
     /**
      * Return the content of the cstring internal buffer.
      *
-     * Return "[unspecified]" if the buffer has not been allocated.
+     * The pointer remains valid until the next call to SetCString.
      *
      * @ingroup nodoc
      */
     const char *GetCString();
 
+    /**
+     * Render a page to SVG and write it to the output stream as it is serialized.
+     *
+     * Page number is 1-based.
+     *
+     * @ingroup nodoc
+     */
+    bool RenderToSVG(int pageNo, bool xmlDeclaration, std::ostream &output);
+
+    /**
+     * Write the MEI to the output stream as it is serialized.
+     *
+     * See GetMEI for the JSON options.
+     *
+     * @ingroup nodoc
+     */
+    bool GetMEI(const std::string &jsonOptions, std::ostream &output);
+
     /**
      * Write the Humdrum buffer to the outputstream.
      *
@@ -763,10 +891,9 @@ protected:
 
 private:
     bool SetFont(const std::string &fontName);
-    bool IsUTF16(const std::string &filename);
-    bool LoadUTF16File(const std::string &filename);
-    bool IsZip(const std::string &filename);
-    bool LoadZipFile(const std::string &filename);
+    bool IsUTF16(const char *data, size_t length) const;
+    bool LoadUTF16Data(const char *data, size_t length);
+    bool IsZip(const char *data, size_t length) const;
     bool LoadZipData(const std::vector<unsigned char> &bytes);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
@@ -778,6 +905,71 @@ private:
      */
     std::string GetOptions(bool defaultValues) const;
 
+    /**
+     * Reset the data previously loaded before loading new data.
+     * Also seed the generator for the XML IDs with the checksum of the data if required.
+     */
+    void ResetLoadedData(const char *data, size_t length);
+
+    /**
+     * Process the document once the data has been imported (header and footer, transposition, preparation and
+     * cast-off). The input is deleted.
+     */
+    bool ProcessImportedData(Input *input, FileFormat inputFormat);
+
+    /**
+     * Generate the page header and footer and the measure numbers that are not encoded, according to the options.
+     * They are not written in the MEI output.
+     */
+    void GenerateImplicitElements();
+
+    /**
+     * Set the SVG options on the device context before rendering a page.
+     */
+    void InitSvgDeviceContext(SvgDeviceContext &svg);
+
+    /**
+     * Render a page from the SVG page cache, or return false if the page is not cached
+     */
+    bool RenderCachedSVG(int pageNo, bool xmlDeclaration, std::string &output);
+
+    /**
+     * Set the size and the scale of the device context for the current page according to the options.
+     */
+    void InitDeviceContextSize(DeviceContext *deviceContext);
+
+    /**
+     * Clear the cached SVG pages and the spatial indexes when the data, the layout or the options change
+     */
+    void ResetPageCaches();
+
+    /**
+     * Enable or disable the profiler for this toolkit according to the profile option
+     */
+    void EnableProfiler(bool enable);
+
+    /**
+     * Restore the document from the MEI saved by the editor toolkit when a transaction was rolled back.
+     * The document is laid out again unless its pages were saved, and the drawing page and the selection are kept.
+     */
+    void RestoreEditedData();
+
+    /**
+     * Cast off the document according to the breaks option, as when the layout is redone.
+     */
+    void CastOffWithBreaks();
+
+    /**
+     * Lay out the page (0-based) and return its spatial index, which is built if necessary.
+     * The page becomes the drawing page.
+     */
+    const SpatialIndex &GetPageSpatialIndex(int pageIdx);
+
+    /**
+     * Convert a point of the SVG of the current drawing page to logical coordinates.
+     */
+    Point ToPageLogicalPoint(double x, double y);
+
 public:
     //
 private:
@@ -792,20 +984,53 @@ private:
     /**
      * The C buffer string.
      */
-    char *m_cString;
+    std::string m_cString;
+
+    /**
+     * The Humdrum buffer, owned by each instance so that toolkits can be used concurrently.
+     */
+    char *m_humdrumBuffer;
+
+    /**
+     * The tune index (JSON) of the ABC data loaded
+     */
+    std::string m_abcTuneIndex;
 
     EditorToolkit *m_editorToolkit;
 
+    /**
+     * True if the profiler was enabled by this toolkit
+     */
+    bool m_profilerEnabled;
+
+    /**
+     * A page rendered with svgPageCache, split around the size attributes of the svg root element.
+     * The width and height are the ones of the drawing, before applying the scale.
+     */
+    struct SvgCachedPage {
+        std::string m_head;
+        std::string m_tail;
+        int m_width;
+        int m_height;
+        std::pair<int, int> m_baseSize;
+    };
+
+    /**
+     * The pages rendered with svgPageCache, by page index and xml declaration.
+     * Cleared whenever the data, the layout or the options change.
+     */
+    std::map<std::pair<int, bool>, SvgCachedPage> m_svgPageCache;
+
+    /**
+     * The spatial indexes of the pages queried with GetElementsAtPoint or GetElementsInRect, by page index.
+     * Cleared with the SVG page cache.
+     */
+    std::map<int, SpatialIndex> m_spatialIndexes;
+
 #ifndef NO_RUNTIME
     /** Measuring runtime */
     RuntimeClock *m_runtimeClock;
 #endif
-
-    //----------------//
-    // Static members //
-    //----------------//
-
-    static char *m_humdrumBuffer;
 };
 
 } // namespace vrv
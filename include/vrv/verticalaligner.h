@@ -87,6 +87,12 @@ public:
      */
     void FindAllPositionerPointingTo(ArrayOfFloatingPositioners *positioners, const FloatingObject *object);
 
+    /**
+     * Check if the system has positioners of elements spanning over several systems.
+     * Such systems cannot be processed independently from each other.
+     */
+    bool HasCrossSystemPositioners() const;
+
     /**
      * Find all the intersection points with a vertical line (top to bottom)
      */
@@ -196,7 +202,10 @@ public:
     /**
      * Retrieve all FloatingPositioner.
      */
+    ///@{
     const ArrayOfFloatingPositioners &GetFloatingPositioners() { return m_floatingPositioners; }
+    const ArrayOfFloatingPositioners &GetFloatingPositioners() const { return m_floatingPositioners; }
+    ///@}
 
     /**
      * Look for the first FloatingPositioner corresponding to the FloatingObject of the ClassId.
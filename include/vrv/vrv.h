@@ -8,6 +8,7 @@
 #ifndef __VRV_H__
 #define __VRV_H__
 
+#include <atomic>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
@@ -41,9 +42,12 @@ void LogWarning(const char *fmt, ...);
 
 /**
  * Member and functions specific to logging that uses a vector of string to buffer the logs.
+ * The buffer is shared by all the threads and should be accessed through LogBufferToString and ClearLogBuffer.
  */
 extern std::vector<std::string> logBuffer;
 bool LogBufferContains(const std::string &s);
+std::string LogBufferToString();
+void ClearLogBuffer();
 void LogString(std::string message, LogLevel level);
 
 /**
@@ -129,8 +133,8 @@ std::string ToCamelCase(const std::string &s);
 /**
  *
  */
-extern LogLevel logLevel;
-extern bool loggingToBuffer;
+extern std::atomic<LogLevel> logLevel;
+extern std::atomic<bool> loggingToBuffer;
 
 /**
  * Functions for logging in milliseconds the elapsed time of an
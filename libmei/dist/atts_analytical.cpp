@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttHarmAnl::ResetHarmAnl()
 bool AttHarmAnl::ReadHarmAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHarmAnlForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToHarmAnlForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -79,10 +89,19 @@ void AttHarmonicFunction::ResetHarmonicFunction()
 bool AttHarmonicFunction::ReadHarmonicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToStr(element.attribute("deg").value()));
-        if (removeAttr) element.remove_attribute("deg");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "deg")) {
+                    this->SetDeg(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -119,10 +138,19 @@ void AttIntervalHarmonic::ResetIntervalHarmonic()
 bool AttIntervalHarmonic::ReadIntervalHarmonic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToStr(element.attribute("inth").value()));
-        if (removeAttr) element.remove_attribute("inth");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'i':
+                if (!std::strcmp(name, "inth")) {
+                    this->SetInth(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -159,10 +187,19 @@ void AttIntervalMelodic::ResetIntervalMelodic()
 bool AttIntervalMelodic::ReadIntervalMelodic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToStr(element.attribute("intm").value()));
-        if (removeAttr) element.remove_attribute("intm");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'i':
+                if (!std::strcmp(name, "intm")) {
+                    this->SetIntm(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -199,10 +236,19 @@ void AttKeySigAnl::ResetKeySigAnl()
 bool AttKeySigAnl::ReadKeySigAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        if (removeAttr) element.remove_attribute("mode");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "mode")) {
+                    this->SetMode(StrToMode(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -241,20 +287,29 @@ void AttKeySigDefaultAnl::ResetKeySigDefaultAnl()
 bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalGestural(element.attribute("key.accid").value()));
-        if (removeAttr) element.remove_attribute("key.accid");
-        hasAttribute = true;
-    }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        if (removeAttr) element.remove_attribute("key.mode");
-        hasAttribute = true;
-    }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        if (removeAttr) element.remove_attribute("key.pname");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'k':
+                if (!std::strcmp(name, "key.accid")) {
+                    this->SetKeyAccid(StrToAccidentalGestural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "key.mode")) {
+                    this->SetKeyMode(StrToMode(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "key.pname")) {
+                    this->SetKeyPname(StrToPitchname(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -309,10 +364,19 @@ void AttMelodicFunction::ResetMelodicFunction()
 bool AttMelodicFunction::ReadMelodicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        if (removeAttr) element.remove_attribute("mfunc");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "mfunc")) {
+                    this->SetMfunc(StrToMelodicfunction(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -349,10 +413,19 @@ void AttPitchClass::ResetPitchClass()
 bool AttPitchClass::ReadPitchClass(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToInt(element.attribute("pclass").value()));
-        if (removeAttr) element.remove_attribute("pclass");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "pclass")) {
+                    this->SetPclass(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -389,10 +462,19 @@ void AttSolfa::ResetSolfa()
 bool AttSolfa::ReadSolfa(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        if (removeAttr) element.remove_attribute("psolfa");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "psolfa")) {
+                    this->SetPsolfa(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
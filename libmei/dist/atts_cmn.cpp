@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttArpegLog::ResetArpegLog()
 bool AttArpegLog::ReadArpegLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        if (removeAttr) element.remove_attribute("order");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "order")) {
+                    this->SetOrder(StrToArpegLogOrder(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -79,10 +89,19 @@ void AttBTremLog::ResetBTremLog()
 bool AttBTremLog::ReadBTremLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBTremLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToBTremLogForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -119,10 +138,19 @@ void AttBeamPresent::ResetBeamPresent()
 bool AttBeamPresent::ReadBeamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        if (removeAttr) element.remove_attribute("beam");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "beam")) {
+                    this->SetBeam(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -162,25 +190,38 @@ void AttBeamRend::ResetBeamRend()
 bool AttBeamRend::ReadBeamRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamRendForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToBeamplace(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
-    }
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBoolean(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
-        hasAttribute = true;
-    }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        if (removeAttr) element.remove_attribute("slope");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToBeamRendForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToBeamplace(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "slash")) {
+                    this->SetSlash(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "slope")) {
+                    this->SetSlope(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -244,10 +285,19 @@ void AttBeamSecondary::ResetBeamSecondary()
 bool AttBeamSecondary::ReadBeamSecondary(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        if (removeAttr) element.remove_attribute("breaksec");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "breaksec")) {
+                    this->SetBreaksec(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -284,10 +334,19 @@ void AttBeamedWith::ResetBeamedWith()
 bool AttBeamedWith::ReadBeamedWith(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToNeighboringlayer(element.attribute("beam.with").value()));
-        if (removeAttr) element.remove_attribute("beam.with");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "beam.with")) {
+                    this->SetBeamWith(StrToNeighboringlayer(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -325,15 +384,24 @@ void AttBeamingLog::ResetBeamingLog()
 bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        if (removeAttr) element.remove_attribute("beam.group");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        if (removeAttr) element.remove_attribute("beam.rests");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "beam.group")) {
+                    this->SetBeamGroup(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "beam.rests")) {
+                    this->SetBeamRests(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -379,10 +447,19 @@ void AttBeatRptLog::ResetBeatRptLog()
 bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beatdef")) {
-        this->SetBeatdef(StrToDbl(element.attribute("beatdef").value()));
-        if (removeAttr) element.remove_attribute("beatdef");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "beatdef")) {
+                    this->SetBeatdef(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -419,10 +496,19 @@ void AttBracketSpanLog::ResetBracketSpanLog()
 bool AttBracketSpanLog::ReadBracketSpanLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "func")) {
+                    this->SetFunc(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -459,10 +545,19 @@ void AttCutout::ResetCutout()
 bool AttCutout::ReadCutout(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        if (removeAttr) element.remove_attribute("cutout");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "cutout")) {
+                    this->SetCutout(StrToCutoutCutout(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -499,10 +594,19 @@ void AttExpandable::ResetExpandable()
 bool AttExpandable::ReadExpandable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        if (removeAttr) element.remove_attribute("expand");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "expand")) {
+                    this->SetExpand(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -539,10 +643,19 @@ void AttFTremLog::ResetFTremLog()
 bool AttFTremLog::ReadFTremLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFTremLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToFTremLogForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -579,10 +692,19 @@ void AttGlissPresent::ResetGlissPresent()
 bool AttGlissPresent::ReadGlissPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        if (removeAttr) element.remove_attribute("gliss");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'g':
+                if (!std::strcmp(name, "gliss")) {
+                    this->SetGliss(StrToGlissando(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -619,10 +741,19 @@ void AttGraceGrpLog::ResetGraceGrpLog()
 bool AttGraceGrpLog::ReadGraceGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attach")) {
-        this->SetAttach(StrToGraceGrpLogAttach(element.attribute("attach").value()));
-        if (removeAttr) element.remove_attribute("attach");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "attach")) {
+                    this->SetAttach(StrToGraceGrpLogAttach(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -660,15 +791,24 @@ void AttGraced::ResetGraced()
 bool AttGraced::ReadGraced(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        if (removeAttr) element.remove_attribute("grace");
-        hasAttribute = true;
-    }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        if (removeAttr) element.remove_attribute("grace.time");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'g':
+                if (!std::strcmp(name, "grace")) {
+                    this->SetGrace(StrToGrace(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "grace.time")) {
+                    this->SetGraceTime(StrToPercent(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -715,15 +855,26 @@ void AttHairpinLog::ResetHairpinLog()
 bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        if (removeAttr) element.remove_attribute("niente");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToHairpinLogForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'n':
+                if (!std::strcmp(name, "niente")) {
+                    this->SetNiente(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -775,40 +926,61 @@ void AttHarpPedalLog::ResetHarpPedalLog()
 bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarpPedalLogC(element.attribute("c").value()));
-        if (removeAttr) element.remove_attribute("c");
-        hasAttribute = true;
-    }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarpPedalLogD(element.attribute("d").value()));
-        if (removeAttr) element.remove_attribute("d");
-        hasAttribute = true;
-    }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarpPedalLogE(element.attribute("e").value()));
-        if (removeAttr) element.remove_attribute("e");
-        hasAttribute = true;
-    }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarpPedalLogF(element.attribute("f").value()));
-        if (removeAttr) element.remove_attribute("f");
-        hasAttribute = true;
-    }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarpPedalLogG(element.attribute("g").value()));
-        if (removeAttr) element.remove_attribute("g");
-        hasAttribute = true;
-    }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarpPedalLogA(element.attribute("a").value()));
-        if (removeAttr) element.remove_attribute("a");
-        hasAttribute = true;
-    }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarpPedalLogB(element.attribute("b").value()));
-        if (removeAttr) element.remove_attribute("b");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "a")) {
+                    this->SetA(StrToHarpPedalLogA(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'b':
+                if (!std::strcmp(name, "b")) {
+                    this->SetB(StrToHarpPedalLogB(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'c':
+                if (!std::strcmp(name, "c")) {
+                    this->SetC(StrToHarpPedalLogC(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'd':
+                if (!std::strcmp(name, "d")) {
+                    this->SetD(StrToHarpPedalLogD(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'e':
+                if (!std::strcmp(name, "e")) {
+                    this->SetE(StrToHarpPedalLogE(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "f")) {
+                    this->SetF(StrToHarpPedalLogF(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'g':
+                if (!std::strcmp(name, "g")) {
+                    this->SetG(StrToHarpPedalLogG(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -899,10 +1071,19 @@ void AttLvPresent::ResetLvPresent()
 bool AttLvPresent::ReadLvPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        if (removeAttr) element.remove_attribute("lv");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lv")) {
+                    this->SetLv(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -940,15 +1121,26 @@ void AttMeasureLog::ResetMeasureLog()
 bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        if (removeAttr) element.remove_attribute("left");
-        hasAttribute = true;
-    }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        if (removeAttr) element.remove_attribute("right");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "left")) {
+                    this->SetLeft(StrToBarrendition(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "right")) {
+                    this->SetRight(StrToBarrendition(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -994,10 +1186,19 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
 bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "func")) {
+                    this->SetFunc(StrToMeterSigGrpLogFunc(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1035,15 +1236,24 @@ void AttNumberPlacement::ResetNumberPlacement()
 bool AttNumberPlacement::ReadNumberPlacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToStaffrelBasic(element.attribute("num.place").value()));
-        if (removeAttr) element.remove_attribute("num.place");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        if (removeAttr) element.remove_attribute("num.visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "num.place")) {
+                    this->SetNumPlace(StrToStaffrelBasic(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "num.visible")) {
+                    this->SetNumVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1089,10 +1299,19 @@ void AttNumbered::ResetNumbered()
 bool AttNumbered::ReadNumbered(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "num")) {
+                    this->SetNum(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1129,10 +1348,19 @@ void AttOctaveLog::ResetOctaveLog()
 bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        if (removeAttr) element.remove_attribute("coll");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "coll")) {
+                    this->SetColl(StrToOctaveLogColl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1170,15 +1398,26 @@ void AttPedalLog::ResetPedalLog()
 bool AttPedalLog::ReadPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dir")) {
+                    this->SetDir(StrToPedalLogDir(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "func")) {
+                    this->SetFunc(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1224,10 +1463,19 @@ void AttPianoPedals::ResetPianoPedals()
 bool AttPianoPedals::ReadPianoPedals(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPedalstyle(element.attribute("pedal.style").value()));
-        if (removeAttr) element.remove_attribute("pedal.style");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "pedal.style")) {
+                    this->SetPedalStyle(StrToPedalstyle(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1264,10 +1512,19 @@ void AttRehearsal::ResetRehearsal()
 bool AttRehearsal::ReadRehearsal(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        if (removeAttr) element.remove_attribute("reh.enclose");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "reh.enclose")) {
+                    this->SetRehEnclose(StrToRehearsalRehenclose(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1304,10 +1561,19 @@ void AttScoreDefVisCmn::ResetScoreDefVisCmn()
 bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        if (removeAttr) element.remove_attribute("grid.show");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'g':
+                if (!std::strcmp(name, "grid.show")) {
+                    this->SetGridShow(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1345,15 +1611,24 @@ void AttSlurRend::ResetSlurRend()
 bool AttSlurRend::ReadSlurRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        if (removeAttr) element.remove_attribute("slur.lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToLinewidth(element.attribute("slur.lwidth").value()));
-        if (removeAttr) element.remove_attribute("slur.lwidth");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "slur.lform")) {
+                    this->SetSlurLform(StrToLineform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "slur.lwidth")) {
+                    this->SetSlurLwidth(StrToLinewidth(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1399,10 +1674,19 @@ void AttStemsCmn::ResetStemsCmn()
 bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToNeighboringlayer(element.attribute("stem.with").value()));
-        if (removeAttr) element.remove_attribute("stem.with");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "stem.with")) {
+                    this->SetStemWith(StrToNeighboringlayer(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1440,15 +1724,24 @@ void AttTieRend::ResetTieRend()
 bool AttTieRend::ReadTieRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        if (removeAttr) element.remove_attribute("tie.lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToLinewidth(element.attribute("tie.lwidth").value()));
-        if (removeAttr) element.remove_attribute("tie.lwidth");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tie.lform")) {
+                    this->SetTieLform(StrToLineform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "tie.lwidth")) {
+                    this->SetTieLwidth(StrToLinewidth(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1494,10 +1787,19 @@ void AttTremMeasured::ResetTremMeasured()
 bool AttTremMeasured::ReadTremMeasured(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unitdur")) {
-        this->SetUnitdur(StrToDuration(element.attribute("unitdur").value()));
-        if (removeAttr) element.remove_attribute("unitdur");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'u':
+                if (!std::strcmp(name, "unitdur")) {
+                    this->SetUnitdur(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
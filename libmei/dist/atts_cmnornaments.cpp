@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,15 +41,26 @@ void AttMordentLog::ResetMordentLog()
 bool AttMordentLog::ReadMordentLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        if (removeAttr) element.remove_attribute("long");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToMordentLogForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "long")) {
+                    this->SetLong(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -94,10 +106,19 @@ void AttOrnamPresent::ResetOrnamPresent()
 bool AttOrnamPresent::ReadOrnamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        if (removeAttr) element.remove_attribute("ornam");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "ornam")) {
+                    this->SetOrnam(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -135,15 +156,24 @@ void AttOrnamentAccid::ResetOrnamentAccid()
 bool AttOrnamentAccid::ReadOrnamentAccid(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalWritten(element.attribute("accidupper").value()));
-        if (removeAttr) element.remove_attribute("accidupper");
-        hasAttribute = true;
-    }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalWritten(element.attribute("accidlower").value()));
-        if (removeAttr) element.remove_attribute("accidlower");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "accidupper")) {
+                    this->SetAccidupper(StrToAccidentalWritten(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "accidlower")) {
+                    this->SetAccidlower(StrToAccidentalWritten(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -190,15 +220,26 @@ void AttTurnLog::ResetTurnLog()
 bool AttTurnLog::ReadTurnLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        if (removeAttr) element.remove_attribute("delayed");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "delayed")) {
+                    this->SetDelayed(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToTurnLogForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
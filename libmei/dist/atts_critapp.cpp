@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttCrit::ResetCrit()
 bool AttCrit::ReadCrit(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        if (removeAttr) element.remove_attribute("cause");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "cause")) {
+                    this->SetCause(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttAgentIdent::ResetAgentIdent()
 bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        if (removeAttr) element.remove_attribute("agent");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "agent")) {
+                    this->SetAgent(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -79,10 +89,19 @@ void AttReasonIdent::ResetReasonIdent()
 bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        if (removeAttr) element.remove_attribute("reason");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "reason")) {
+                    this->SetReason(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,15 +41,24 @@ void AttExtSymAuth::ResetExtSymAuth()
 bool AttExtSymAuth::ReadExtSymAuth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyph.auth")) {
-        this->SetGlyphAuth(StrToStr(element.attribute("glyph.auth").value()));
-        if (removeAttr) element.remove_attribute("glyph.auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.uri")) {
-        this->SetGlyphUri(StrToStr(element.attribute("glyph.uri").value()));
-        if (removeAttr) element.remove_attribute("glyph.uri");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'g':
+                if (!std::strcmp(name, "glyph.auth")) {
+                    this->SetGlyphAuth(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "glyph.uri")) {
+                    this->SetGlyphUri(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -95,15 +105,24 @@ void AttExtSymNames::ResetExtSymNames()
 bool AttExtSymNames::ReadExtSymNames(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyph.name")) {
-        this->SetGlyphName(StrToStr(element.attribute("glyph.name").value()));
-        if (removeAttr) element.remove_attribute("glyph.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.num")) {
-        this->SetGlyphNum(StrToHexnum(element.attribute("glyph.num").value()));
-        if (removeAttr) element.remove_attribute("glyph.num");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'g':
+                if (!std::strcmp(name, "glyph.name")) {
+                    this->SetGlyphName(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "glyph.num")) {
+                    this->SetGlyphNum(StrToHexnum(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttFacsimile::ResetFacsimile()
 bool AttFacsimile::ReadFacsimile(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("facs")) {
-        this->SetFacs(StrToStr(element.attribute("facs").value()));
-        if (removeAttr) element.remove_attribute("facs");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "facs")) {
+                    this->SetFacs(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
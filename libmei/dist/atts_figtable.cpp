@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,15 +41,26 @@ void AttTabular::ResetTabular()
 bool AttTabular::ReadTabular(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colspan")) {
-        this->SetColspan(StrToInt(element.attribute("colspan").value()));
-        if (removeAttr) element.remove_attribute("colspan");
-        hasAttribute = true;
-    }
-    if (element.attribute("rowspan")) {
-        this->SetRowspan(StrToInt(element.attribute("rowspan").value()));
-        if (removeAttr) element.remove_attribute("rowspan");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "colspan")) {
+                    this->SetColspan(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "rowspan")) {
+                    this->SetRowspan(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
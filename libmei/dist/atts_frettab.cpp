@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttCourseLog::ResetCourseLog()
 bool AttCourseLog::ReadCourseLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuning.standard")) {
-        this->SetTuningStandard(StrToCoursetuning(element.attribute("tuning.standard").value()));
-        if (removeAttr) element.remove_attribute("tuning.standard");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tuning.standard")) {
+                    this->SetTuningStandard(StrToCoursetuning(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -80,15 +90,24 @@ void AttNoteGesTab::ResetNoteGesTab()
 bool AttNoteGesTab::ReadNoteGesTab(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.course")) {
-        this->SetTabCourse(StrToInt(element.attribute("tab.course").value()));
-        if (removeAttr) element.remove_attribute("tab.course");
-        hasAttribute = true;
-    }
-    if (element.attribute("tab.fret")) {
-        this->SetTabFret(StrToInt(element.attribute("tab.fret").value()));
-        if (removeAttr) element.remove_attribute("tab.fret");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tab.course")) {
+                    this->SetTabCourse(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "tab.fret")) {
+                    this->SetTabFret(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttAccidentalGes::ResetAccidentalGes()
 bool AttAccidentalGes::ReadAccidentalGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalGestural(element.attribute("accid.ges").value()));
-        if (removeAttr) element.remove_attribute("accid.ges");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "accid.ges")) {
+                    this->SetAccidGes(StrToAccidentalGestural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -79,10 +89,19 @@ void AttArticulationGes::ResetArticulationGes()
 bool AttArticulationGes::ReadArticulationGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulationList(element.attribute("artic.ges").value()));
-        if (removeAttr) element.remove_attribute("artic.ges");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "artic.ges")) {
+                    this->SetArticGes(StrToArticulationList(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -119,10 +138,19 @@ void AttBendGes::ResetBendGes()
 bool AttBendGes::ReadBendGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        if (removeAttr) element.remove_attribute("amount");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "amount")) {
+                    this->SetAmount(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -164,35 +192,44 @@ void AttDurationGes::ResetDurationGes()
 bool AttDurationGes::ReadDurationGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        if (removeAttr) element.remove_attribute("dur.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("dots.ges")) {
-        this->SetDotsGes(StrToInt(element.attribute("dots.ges").value()));
-        if (removeAttr) element.remove_attribute("dots.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.metrical")) {
-        this->SetDurMetrical(StrToDbl(element.attribute("dur.metrical").value()));
-        if (removeAttr) element.remove_attribute("dur.metrical");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.ppq")) {
-        this->SetDurPpq(StrToInt(element.attribute("dur.ppq").value()));
-        if (removeAttr) element.remove_attribute("dur.ppq");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.real")) {
-        this->SetDurReal(StrToDbl(element.attribute("dur.real").value()));
-        if (removeAttr) element.remove_attribute("dur.real");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.recip")) {
-        this->SetDurRecip(StrToStr(element.attribute("dur.recip").value()));
-        if (removeAttr) element.remove_attribute("dur.recip");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dur.ges")) {
+                    this->SetDurGes(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dots.ges")) {
+                    this->SetDotsGes(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dur.metrical")) {
+                    this->SetDurMetrical(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dur.ppq")) {
+                    this->SetDurPpq(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dur.real")) {
+                    this->SetDurReal(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dur.recip")) {
+                    this->SetDurRecip(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -274,10 +311,19 @@ void AttMdivGes::ResetMdivGes()
 bool AttMdivGes::ReadMdivGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attacca")) {
-        this->SetAttacca(StrToBoolean(element.attribute("attacca").value()));
-        if (removeAttr) element.remove_attribute("attacca");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "attacca")) {
+                    this->SetAttacca(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -316,20 +362,31 @@ void AttNcGes::ResetNcGes()
 bool AttNcGes::ReadNcGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        if (removeAttr) element.remove_attribute("oct.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        if (removeAttr) element.remove_attribute("pname.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        if (removeAttr) element.remove_attribute("pnum");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "oct.ges")) {
+                    this->SetOctGes(StrToOctave(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "pname.ges")) {
+                    this->SetPnameGes(StrToPitchname(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "pnum")) {
+                    this->SetPnum(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -387,25 +444,38 @@ void AttNoteGes::ResetNoteGes()
 bool AttNoteGes::ReadNoteGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extremis")) {
-        this->SetExtremis(StrToNoteGesExtremis(element.attribute("extremis").value()));
-        if (removeAttr) element.remove_attribute("extremis");
-        hasAttribute = true;
-    }
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        if (removeAttr) element.remove_attribute("oct.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        if (removeAttr) element.remove_attribute("pname.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        if (removeAttr) element.remove_attribute("pnum");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "extremis")) {
+                    this->SetExtremis(StrToNoteGesExtremis(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'o':
+                if (!std::strcmp(name, "oct.ges")) {
+                    this->SetOctGes(StrToOctave(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "pname.ges")) {
+                    this->SetPnameGes(StrToPitchname(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "pnum")) {
+                    this->SetPnum(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -470,15 +540,24 @@ void AttOrnamentAccidGes::ResetOrnamentAccidGes()
 bool AttOrnamentAccidGes::ReadOrnamentAccidGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper.ges")) {
-        this->SetAccidupperGes(StrToAccidentalGestural(element.attribute("accidupper.ges").value()));
-        if (removeAttr) element.remove_attribute("accidupper.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("accidlower.ges")) {
-        this->SetAccidlowerGes(StrToAccidentalGestural(element.attribute("accidlower.ges").value()));
-        if (removeAttr) element.remove_attribute("accidlower.ges");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "accidupper.ges")) {
+                    this->SetAccidupperGes(StrToAccidentalGestural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "accidlower.ges")) {
+                    this->SetAccidlowerGes(StrToAccidentalGestural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -524,10 +603,19 @@ void AttSectionGes::ResetSectionGes()
 bool AttSectionGes::ReadSectionGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attacca")) {
-        this->SetAttacca(StrToBoolean(element.attribute("attacca").value()));
-        if (removeAttr) element.remove_attribute("attacca");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "attacca")) {
+                    this->SetAttacca(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -565,15 +653,26 @@ void AttSoundLocation::ResetSoundLocation()
 bool AttSoundLocation::ReadSoundLocation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("azimuth")) {
-        this->SetAzimuth(StrToDbl(element.attribute("azimuth").value()));
-        if (removeAttr) element.remove_attribute("azimuth");
-        hasAttribute = true;
-    }
-    if (element.attribute("elevation")) {
-        this->SetElevation(StrToDbl(element.attribute("elevation").value()));
-        if (removeAttr) element.remove_attribute("elevation");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "azimuth")) {
+                    this->SetAzimuth(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'e':
+                if (!std::strcmp(name, "elevation")) {
+                    this->SetElevation(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -620,15 +719,24 @@ void AttTimestampGes::ResetTimestampGes()
 bool AttTimestampGes::ReadTimestampGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDbl(element.attribute("tstamp.ges").value()));
-        if (removeAttr) element.remove_attribute("tstamp.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        if (removeAttr) element.remove_attribute("tstamp.real");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tstamp.ges")) {
+                    this->SetTstampGes(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "tstamp.real")) {
+                    this->SetTstampReal(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -675,15 +783,24 @@ void AttTimestamp2Ges::ResetTimestamp2Ges()
 bool AttTimestamp2Ges::ReadTimestamp2Ges(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2.ges")) {
-        this->SetTstamp2Ges(StrToMeasurebeat(element.attribute("tstamp2.ges").value()));
-        if (removeAttr) element.remove_attribute("tstamp2.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("tstamp2.real")) {
-        this->SetTstamp2Real(StrToStr(element.attribute("tstamp2.real").value()));
-        if (removeAttr) element.remove_attribute("tstamp2.real");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tstamp2.ges")) {
+                    this->SetTstamp2Ges(StrToMeasurebeat(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "tstamp2.real")) {
+                    this->SetTstamp2Real(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttAdlibitum::ResetAdlibitum()
 bool AttAdlibitum::ReadAdlibitum(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("adlib")) {
-        this->SetAdlib(StrToBoolean(element.attribute("adlib").value()));
-        if (removeAttr) element.remove_attribute("adlib");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "adlib")) {
+                    this->SetAdlib(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -82,25 +92,36 @@ void AttBifoliumSurfaces::ResetBifoliumSurfaces()
 bool AttBifoliumSurfaces::ReadBifoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("outer.recto")) {
-        this->SetOuterRecto(StrToStr(element.attribute("outer.recto").value()));
-        if (removeAttr) element.remove_attribute("outer.recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("inner.verso")) {
-        this->SetInnerVerso(StrToStr(element.attribute("inner.verso").value()));
-        if (removeAttr) element.remove_attribute("inner.verso");
-        hasAttribute = true;
-    }
-    if (element.attribute("inner.recto")) {
-        this->SetInnerRecto(StrToStr(element.attribute("inner.recto").value()));
-        if (removeAttr) element.remove_attribute("inner.recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("outer.verso")) {
-        this->SetOuterVerso(StrToStr(element.attribute("outer.verso").value()));
-        if (removeAttr) element.remove_attribute("outer.verso");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'i':
+                if (!std::strcmp(name, "inner.verso")) {
+                    this->SetInnerVerso(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "inner.recto")) {
+                    this->SetInnerRecto(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'o':
+                if (!std::strcmp(name, "outer.recto")) {
+                    this->SetOuterRecto(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "outer.verso")) {
+                    this->SetOuterVerso(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -165,15 +186,26 @@ void AttFoliumSurfaces::ResetFoliumSurfaces()
 bool AttFoliumSurfaces::ReadFoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recto")) {
-        this->SetRecto(StrToStr(element.attribute("recto").value()));
-        if (removeAttr) element.remove_attribute("recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("verso")) {
-        this->SetVerso(StrToStr(element.attribute("verso").value()));
-        if (removeAttr) element.remove_attribute("verso");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "recto")) {
+                    this->SetRecto(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'v':
+                if (!std::strcmp(name, "verso")) {
+                    this->SetVerso(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -219,10 +251,19 @@ void AttPerfRes::ResetPerfRes()
 bool AttPerfRes::ReadPerfRes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("solo")) {
-        this->SetSolo(StrToBoolean(element.attribute("solo").value()));
-        if (removeAttr) element.remove_attribute("solo");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "solo")) {
+                    this->SetSolo(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -259,10 +300,19 @@ void AttPerfResBasic::ResetPerfResBasic()
 bool AttPerfResBasic::ReadPerfResBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        if (removeAttr) element.remove_attribute("count");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "count")) {
+                    this->SetCount(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -299,10 +349,19 @@ void AttRecordType::ResetRecordType()
 bool AttRecordType::ReadRecordType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recordtype")) {
-        this->SetRecordtype(StrToRecordTypeRecordtype(element.attribute("recordtype").value()));
-        if (removeAttr) element.remove_attribute("recordtype");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "recordtype")) {
+                    this->SetRecordtype(StrToRecordTypeRecordtype(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -339,10 +398,19 @@ void AttRegularMethod::ResetRegularMethod()
 bool AttRegularMethod::ReadRegularMethod(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularMethodMethod(element.attribute("method").value()));
-        if (removeAttr) element.remove_attribute("method");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "method")) {
+                    this->SetMethod(StrToRegularMethodMethod(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -40,15 +41,24 @@ void AttNotationType::ResetNotationType()
 bool AttNotationType::ReadNotationType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        if (removeAttr) element.remove_attribute("notationtype");
-        hasAttribute = true;
-    }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        if (removeAttr) element.remove_attribute("notationsubtype");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "notationtype")) {
+                    this->SetNotationtype(StrToNotationtype(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "notationsubtype")) {
+                    this->SetNotationsubtype(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttDurationQuality::ResetDurationQuality()
 bool AttDurationQuality::ReadDurationQuality(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.quality")) {
-        this->SetDurQuality(StrToDurqualityMensural(element.attribute("dur.quality").value()));
-        if (removeAttr) element.remove_attribute("dur.quality");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dur.quality")) {
+                    this->SetDurQuality(StrToDurqualityMensural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -80,15 +90,24 @@ void AttMensuralLog::ResetMensuralLog()
 bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        if (removeAttr) element.remove_attribute("proport.num");
-        hasAttribute = true;
-    }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        if (removeAttr) element.remove_attribute("proport.numbase");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "proport.num")) {
+                    this->SetProportNum(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "proport.numbase")) {
+                    this->SetProportNumbase(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -138,30 +157,45 @@ void AttMensuralShared::ResetMensuralShared()
 bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        if (removeAttr) element.remove_attribute("modusmaior");
-        hasAttribute = true;
-    }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        if (removeAttr) element.remove_attribute("modusminor");
-        hasAttribute = true;
-    }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        if (removeAttr) element.remove_attribute("prolatio");
-        hasAttribute = true;
-    }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        if (removeAttr) element.remove_attribute("tempus");
-        hasAttribute = true;
-    }
-    if (element.attribute("divisio")) {
-        this->SetDivisio(StrToDivisio(element.attribute("divisio").value()));
-        if (removeAttr) element.remove_attribute("divisio");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "divisio")) {
+                    this->SetDivisio(StrToDivisio(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'm':
+                if (!std::strcmp(name, "modusmaior")) {
+                    this->SetModusmaior(StrToModusmaior(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "modusminor")) {
+                    this->SetModusminor(StrToModusminor(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "prolatio")) {
+                    this->SetProlatio(StrToProlatio(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 't':
+                if (!std::strcmp(name, "tempus")) {
+                    this->SetTempus(StrToTempus(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -234,10 +268,19 @@ void AttNoteVisMensural::ResetNoteVisMensural()
 bool AttNoteVisMensural::ReadNoteVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToLigatureform(element.attribute("lig").value()));
-        if (removeAttr) element.remove_attribute("lig");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lig")) {
+                    this->SetLig(StrToLigatureform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -274,10 +317,19 @@ void AttRestVisMensural::ResetRestVisMensural()
 bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        if (removeAttr) element.remove_attribute("spaces");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "spaces")) {
+                    this->SetSpaces(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -314,10 +366,19 @@ void AttStemsMensural::ResetStemsMensural()
 bool AttStemsMensural::ReadStemsMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.form")) {
-        this->SetStemForm(StrToStemformMensural(element.attribute("stem.form").value()));
-        if (removeAttr) element.remove_attribute("stem.form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "stem.form")) {
+                    this->SetStemForm(StrToStemformMensural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
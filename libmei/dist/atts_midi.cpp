@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -42,25 +43,34 @@ void AttChannelized::ResetChannelized()
 bool AttChannelized::ReadChannelized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        if (removeAttr) element.remove_attribute("midi.channel");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercentLimited(element.attribute("midi.duty").value()));
-        if (removeAttr) element.remove_attribute("midi.duty");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalueName(element.attribute("midi.port").value()));
-        if (removeAttr) element.remove_attribute("midi.port");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        if (removeAttr) element.remove_attribute("midi.track");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "midi.channel")) {
+                    this->SetMidiChannel(StrToMidichannel(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.duty")) {
+                    this->SetMidiDuty(StrToPercentLimited(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.port")) {
+                    this->SetMidiPort(StrToMidivalueName(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.track")) {
+                    this->SetMidiTrack(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -124,10 +134,19 @@ void AttInstrumentIdent::ResetInstrumentIdent()
 bool AttInstrumentIdent::ReadInstrumentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        if (removeAttr) element.remove_attribute("instr");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'i':
+                if (!std::strcmp(name, "instr")) {
+                    this->SetInstr(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -169,35 +188,44 @@ void AttMidiInstrument::ResetMidiInstrument()
 bool AttMidiInstrument::ReadMidiInstrument(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        if (removeAttr) element.remove_attribute("midi.instrnum");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.instrname")) {
-        this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        if (removeAttr) element.remove_attribute("midi.instrname");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivaluePan(element.attribute("midi.pan").value()));
-        if (removeAttr) element.remove_attribute("midi.pan");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.patchname")) {
-        this->SetMidiPatchname(StrToStr(element.attribute("midi.patchname").value()));
-        if (removeAttr) element.remove_attribute("midi.patchname");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.patchnum")) {
-        this->SetMidiPatchnum(StrToMidivalue(element.attribute("midi.patchnum").value()));
-        if (removeAttr) element.remove_attribute("midi.patchnum");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToPercent(element.attribute("midi.volume").value()));
-        if (removeAttr) element.remove_attribute("midi.volume");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "midi.instrnum")) {
+                    this->SetMidiInstrnum(StrToMidivalue(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.instrname")) {
+                    this->SetMidiInstrname(StrToMidinames(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.pan")) {
+                    this->SetMidiPan(StrToMidivaluePan(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.patchname")) {
+                    this->SetMidiPatchname(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.patchnum")) {
+                    this->SetMidiPatchnum(StrToMidivalue(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.volume")) {
+                    this->SetMidiVolume(StrToPercent(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -279,10 +307,19 @@ void AttMidiNumber::ResetMidiNumber()
 bool AttMidiNumber::ReadMidiNumber(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToMidivalue(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "num")) {
+                    this->SetNum(StrToMidivalue(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -320,15 +357,24 @@ void AttMidiTempo::ResetMidiTempo()
 bool AttMidiTempo::ReadMidiTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToDbl(element.attribute("midi.bpm").value()));
-        if (removeAttr) element.remove_attribute("midi.bpm");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        if (removeAttr) element.remove_attribute("midi.mspb");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "midi.bpm")) {
+                    this->SetMidiBpm(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "midi.mspb")) {
+                    this->SetMidiMspb(StrToMidimspb(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -374,10 +420,19 @@ void AttMidiValue::ResetMidiValue()
 bool AttMidiValue::ReadMidiValue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        if (removeAttr) element.remove_attribute("val");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "val")) {
+                    this->SetVal(StrToMidivalue(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -414,10 +469,19 @@ void AttMidiValue2::ResetMidiValue2()
 bool AttMidiValue2::ReadMidiValue2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        if (removeAttr) element.remove_attribute("val2");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "val2")) {
+                    this->SetVal2(StrToMidivalue(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -454,10 +518,19 @@ void AttMidiVelocity::ResetMidiVelocity()
 bool AttMidiVelocity::ReadMidiVelocity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        if (removeAttr) element.remove_attribute("vel");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "vel")) {
+                    this->SetVel(StrToMidivalue(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -494,10 +567,19 @@ void AttTimeBase::ResetTimeBase()
 bool AttTimeBase::ReadTimeBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        if (removeAttr) element.remove_attribute("ppq");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "ppq")) {
+                    this->SetPpq(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttDivLineLog::ResetDivLineLog()
 bool AttDivLineLog::ReadDivLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToStr(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -80,15 +90,26 @@ void AttNcLog::ResetNcLog()
 bool AttNcLog::ReadNcLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToStr(element.attribute("oct").value()));
-        if (removeAttr) element.remove_attribute("oct");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname")) {
-        this->SetPname(StrToStr(element.attribute("pname").value()));
-        if (removeAttr) element.remove_attribute("pname");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "oct")) {
+                    this->SetOct(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "pname")) {
+                    this->SetPname(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -141,45 +162,66 @@ void AttNcForm::ResetNcForm()
 bool AttNcForm::ReadNcForm(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("angled")) {
-        this->SetAngled(StrToBoolean(element.attribute("angled").value()));
-        if (removeAttr) element.remove_attribute("angled");
-        hasAttribute = true;
-    }
-    if (element.attribute("con")) {
-        this->SetCon(StrToNcFormCon(element.attribute("con").value()));
-        if (removeAttr) element.remove_attribute("con");
-        hasAttribute = true;
-    }
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToNcFormCurve(element.attribute("curve").value()));
-        if (removeAttr) element.remove_attribute("curve");
-        hasAttribute = true;
-    }
-    if (element.attribute("hooked")) {
-        this->SetHooked(StrToBoolean(element.attribute("hooked").value()));
-        if (removeAttr) element.remove_attribute("hooked");
-        hasAttribute = true;
-    }
-    if (element.attribute("ligated")) {
-        this->SetLigated(StrToBoolean(element.attribute("ligated").value()));
-        if (removeAttr) element.remove_attribute("ligated");
-        hasAttribute = true;
-    }
-    if (element.attribute("rellen")) {
-        this->SetRellen(StrToNcFormRellen(element.attribute("rellen").value()));
-        if (removeAttr) element.remove_attribute("rellen");
-        hasAttribute = true;
-    }
-    if (element.attribute("sShape")) {
-        this->SetSShape(StrToStr(element.attribute("sShape").value()));
-        if (removeAttr) element.remove_attribute("sShape");
-        hasAttribute = true;
-    }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        if (removeAttr) element.remove_attribute("tilt");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "angled")) {
+                    this->SetAngled(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'c':
+                if (!std::strcmp(name, "con")) {
+                    this->SetCon(StrToNcFormCon(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "curve")) {
+                    this->SetCurve(StrToNcFormCurve(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'h':
+                if (!std::strcmp(name, "hooked")) {
+                    this->SetHooked(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "ligated")) {
+                    this->SetLigated(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "rellen")) {
+                    this->SetRellen(StrToNcFormRellen(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "sShape")) {
+                    this->SetSShape(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 't':
+                if (!std::strcmp(name, "tilt")) {
+                    this->SetTilt(StrToCompassdirection(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
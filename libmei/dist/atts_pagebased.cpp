@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -42,25 +43,40 @@ void AttMargins::ResetMargins()
 bool AttMargins::ReadMargins(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("topmar")) {
-        this->SetTopmar(StrToMeasurementunsigned(element.attribute("topmar").value()));
-        if (removeAttr) element.remove_attribute("topmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("botmar")) {
-        this->SetBotmar(StrToMeasurementunsigned(element.attribute("botmar").value()));
-        if (removeAttr) element.remove_attribute("botmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("leftmar")) {
-        this->SetLeftmar(StrToMeasurementunsigned(element.attribute("leftmar").value()));
-        if (removeAttr) element.remove_attribute("leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("rightmar")) {
-        this->SetRightmar(StrToMeasurementunsigned(element.attribute("rightmar").value()));
-        if (removeAttr) element.remove_attribute("rightmar");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "botmar")) {
+                    this->SetBotmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "leftmar")) {
+                    this->SetLeftmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "rightmar")) {
+                    this->SetRightmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 't':
+                if (!std::strcmp(name, "topmar")) {
+                    this->SetTopmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttAccidLog::ResetAccidLog()
 bool AttAccidLog::ReadAccidLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "func")) {
+                    this->SetFunc(StrToAccidLogFunc(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -79,10 +89,19 @@ void AttAccidental::ResetAccidental()
 bool AttAccidental::ReadAccidental(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalWritten(element.attribute("accid").value()));
-        if (removeAttr) element.remove_attribute("accid");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "accid")) {
+                    this->SetAccid(StrToAccidentalWritten(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -119,10 +138,19 @@ void AttArticulation::ResetArticulation()
 bool AttArticulation::ReadArticulation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        if (removeAttr) element.remove_attribute("artic");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "artic")) {
+                    this->SetArtic(StrToArticulationList(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -159,10 +187,19 @@ void AttAttaccaLog::ResetAttaccaLog()
 bool AttAttaccaLog::ReadAttaccaLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "target")) {
+                    this->SetTarget(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -199,10 +236,19 @@ void AttAudience::ResetAudience()
 bool AttAudience::ReadAudience(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("audience")) {
-        this->SetAudience(StrToAudienceAudience(element.attribute("audience").value()));
-        if (removeAttr) element.remove_attribute("audience");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "audience")) {
+                    this->SetAudience(StrToAudienceAudience(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -239,10 +285,19 @@ void AttAugmentDots::ResetAugmentDots()
 bool AttAugmentDots::ReadAugmentDots(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        if (removeAttr) element.remove_attribute("dots");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dots")) {
+                    this->SetDots(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -280,15 +335,24 @@ void AttAuthorized::ResetAuthorized()
 bool AttAuthorized::ReadAuthorized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("auth")) {
-        this->SetAuth(StrToStr(element.attribute("auth").value()));
-        if (removeAttr) element.remove_attribute("auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("auth.uri")) {
-        this->SetAuthUri(StrToStr(element.attribute("auth.uri").value()));
-        if (removeAttr) element.remove_attribute("auth.uri");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "auth")) {
+                    this->SetAuth(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "auth.uri")) {
+                    this->SetAuthUri(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -334,10 +398,19 @@ void AttBarLineLog::ResetBarLineLog()
 bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToBarrendition(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -376,20 +449,29 @@ void AttBarring::ResetBarring()
 bool AttBarring::ReadBarring(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.len")) {
-        this->SetBarLen(StrToDbl(element.attribute("bar.len").value()));
-        if (removeAttr) element.remove_attribute("bar.len");
-        hasAttribute = true;
-    }
-    if (element.attribute("bar.method")) {
-        this->SetBarMethod(StrToBarmethod(element.attribute("bar.method").value()));
-        if (removeAttr) element.remove_attribute("bar.method");
-        hasAttribute = true;
-    }
-    if (element.attribute("bar.place")) {
-        this->SetBarPlace(StrToInt(element.attribute("bar.place").value()));
-        if (removeAttr) element.remove_attribute("bar.place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "bar.len")) {
+                    this->SetBarLen(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "bar.method")) {
+                    this->SetBarMethod(StrToBarmethod(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "bar.place")) {
+                    this->SetBarPlace(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -444,10 +526,19 @@ void AttBasic::ResetBasic()
 bool AttBasic::ReadBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        if (removeAttr) element.remove_attribute("xml:base");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'x':
+                if (!std::strcmp(name, "xml:base")) {
+                    this->SetBase(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -484,10 +575,19 @@ void AttBibl::ResetBibl()
 bool AttBibl::ReadBibl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        if (removeAttr) element.remove_attribute("analog");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "analog")) {
+                    this->SetAnalog(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -524,10 +624,19 @@ void AttCalendared::ResetCalendared()
 bool AttCalendared::ReadCalendared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        if (removeAttr) element.remove_attribute("calendar");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "calendar")) {
+                    this->SetCalendar(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -564,10 +673,19 @@ void AttCanonical::ResetCanonical()
 bool AttCanonical::ReadCanonical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        if (removeAttr) element.remove_attribute("codedval");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "codedval")) {
+                    this->SetCodedval(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -604,10 +722,19 @@ void AttClassed::ResetClassed()
 bool AttClassed::ReadClassed(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("class")) {
-        this->SetClass(StrToStr(element.attribute("class").value()));
-        if (removeAttr) element.remove_attribute("class");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "class")) {
+                    this->SetClass(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -644,10 +771,19 @@ void AttClefLog::ResetClefLog()
 bool AttClefLog::ReadClefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        if (removeAttr) element.remove_attribute("cautionary");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "cautionary")) {
+                    this->SetCautionary(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -684,10 +820,19 @@ void AttClefShape::ResetClefShape()
 bool AttClefShape::ReadClefShape(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        if (removeAttr) element.remove_attribute("shape");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "shape")) {
+                    this->SetShape(StrToClefshape(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -727,25 +872,34 @@ void AttCleffingLog::ResetCleffingLog()
 bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        if (removeAttr) element.remove_attribute("clef.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        if (removeAttr) element.remove_attribute("clef.line");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        if (removeAttr) element.remove_attribute("clef.dis");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToStaffrelBasic(element.attribute("clef.dis.place").value()));
-        if (removeAttr) element.remove_attribute("clef.dis.place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "clef.shape")) {
+                    this->SetClefShape(StrToClefshape(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "clef.line")) {
+                    this->SetClefLine(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "clef.dis")) {
+                    this->SetClefDis(StrToOctaveDis(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "clef.dis.place")) {
+                    this->SetClefDisPlace(StrToStaffrelBasic(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -809,10 +963,19 @@ void AttColor::ResetColor()
 bool AttColor::ReadColor(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        if (removeAttr) element.remove_attribute("color");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "color")) {
+                    this->SetColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -849,10 +1012,19 @@ void AttColoration::ResetColoration()
 bool AttColoration::ReadColoration(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        if (removeAttr) element.remove_attribute("colored");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "colored")) {
+                    this->SetColored(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -889,10 +1061,19 @@ void AttCoordX1::ResetCoordX1()
 bool AttCoordX1::ReadCoordX1(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.x1")) {
-        this->SetCoordX1(StrToDbl(element.attribute("coord.x1").value()));
-        if (removeAttr) element.remove_attribute("coord.x1");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "coord.x1")) {
+                    this->SetCoordX1(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -929,10 +1110,19 @@ void AttCoordX2::ResetCoordX2()
 bool AttCoordX2::ReadCoordX2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.x2")) {
-        this->SetCoordX2(StrToDbl(element.attribute("coord.x2").value()));
-        if (removeAttr) element.remove_attribute("coord.x2");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "coord.x2")) {
+                    this->SetCoordX2(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -969,10 +1159,19 @@ void AttCoordY1::ResetCoordY1()
 bool AttCoordY1::ReadCoordY1(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.y1")) {
-        this->SetCoordY1(StrToDbl(element.attribute("coord.y1").value()));
-        if (removeAttr) element.remove_attribute("coord.y1");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "coord.y1")) {
+                    this->SetCoordY1(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1013,30 +1212,43 @@ void AttCoordinated::ResetCoordinated()
 bool AttCoordinated::ReadCoordinated(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        if (removeAttr) element.remove_attribute("ulx");
-        hasAttribute = true;
-    }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        if (removeAttr) element.remove_attribute("uly");
-        hasAttribute = true;
-    }
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        if (removeAttr) element.remove_attribute("lrx");
-        hasAttribute = true;
-    }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        if (removeAttr) element.remove_attribute("lry");
-        hasAttribute = true;
-    }
-    if (element.attribute("rotate")) {
-        this->SetRotate(StrToDbl(element.attribute("rotate").value()));
-        if (removeAttr) element.remove_attribute("rotate");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lrx")) {
+                    this->SetLrx(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lry")) {
+                    this->SetLry(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "rotate")) {
+                    this->SetRotate(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'u':
+                if (!std::strcmp(name, "ulx")) {
+                    this->SetUlx(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "uly")) {
+                    this->SetUly(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1109,10 +1321,19 @@ void AttCue::ResetCue()
 bool AttCue::ReadCue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cue")) {
-        this->SetCue(StrToBoolean(element.attribute("cue").value()));
-        if (removeAttr) element.remove_attribute("cue");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "cue")) {
+                    this->SetCue(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1151,20 +1372,31 @@ void AttCurvature::ResetCurvature()
 bool AttCurvature::ReadCurvature(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        if (removeAttr) element.remove_attribute("bezier");
-        hasAttribute = true;
-    }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToBulge(element.attribute("bulge").value()));
-        if (removeAttr) element.remove_attribute("bulge");
-        hasAttribute = true;
-    }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        if (removeAttr) element.remove_attribute("curvedir");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "bezier")) {
+                    this->SetBezier(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "bulge")) {
+                    this->SetBulge(StrToBulge(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'c':
+                if (!std::strcmp(name, "curvedir")) {
+                    this->SetCurvedir(StrToCurvatureCurvedir(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1220,15 +1452,24 @@ void AttCurveRend::ResetCurveRend()
 bool AttCurveRend::ReadCurveRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        if (removeAttr) element.remove_attribute("lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        if (removeAttr) element.remove_attribute("lwidth");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lform")) {
+                    this->SetLform(StrToLineform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lwidth")) {
+                    this->SetLwidth(StrToLinewidth(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1274,10 +1515,19 @@ void AttCustosLog::ResetCustosLog()
 bool AttCustosLog::ReadCustosLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "target")) {
+                    this->SetTarget(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1314,10 +1564,19 @@ void AttDataPointing::ResetDataPointing()
 bool AttDataPointing::ReadDataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        if (removeAttr) element.remove_attribute("data");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "data")) {
+                    this->SetData(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1358,30 +1617,45 @@ void AttDatable::ResetDatable()
 bool AttDatable::ReadDatable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        if (removeAttr) element.remove_attribute("enddate");
-        hasAttribute = true;
-    }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        if (removeAttr) element.remove_attribute("isodate");
-        hasAttribute = true;
-    }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        if (removeAttr) element.remove_attribute("notafter");
-        hasAttribute = true;
-    }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        if (removeAttr) element.remove_attribute("notbefore");
-        hasAttribute = true;
-    }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        if (removeAttr) element.remove_attribute("startdate");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "enddate")) {
+                    this->SetEnddate(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'i':
+                if (!std::strcmp(name, "isodate")) {
+                    this->SetIsodate(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'n':
+                if (!std::strcmp(name, "notafter")) {
+                    this->SetNotafter(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "notbefore")) {
+                    this->SetNotbefore(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "startdate")) {
+                    this->SetStartdate(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1458,30 +1732,45 @@ void AttDistances::ResetDistances()
 bool AttDistances::ReadDistances(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir.dist")) {
-        this->SetDirDist(StrToMeasurementsigned(element.attribute("dir.dist").value()));
-        if (removeAttr) element.remove_attribute("dir.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToMeasurementsigned(element.attribute("dynam.dist").value()));
-        if (removeAttr) element.remove_attribute("dynam.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToMeasurementsigned(element.attribute("harm.dist").value()));
-        if (removeAttr) element.remove_attribute("harm.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("reh.dist")) {
-        this->SetRehDist(StrToMeasurementsigned(element.attribute("reh.dist").value()));
-        if (removeAttr) element.remove_attribute("reh.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("tempo.dist")) {
-        this->SetTempoDist(StrToMeasurementsigned(element.attribute("tempo.dist").value()));
-        if (removeAttr) element.remove_attribute("tempo.dist");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dir.dist")) {
+                    this->SetDirDist(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dynam.dist")) {
+                    this->SetDynamDist(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'h':
+                if (!std::strcmp(name, "harm.dist")) {
+                    this->SetHarmDist(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "reh.dist")) {
+                    this->SetRehDist(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 't':
+                if (!std::strcmp(name, "tempo.dist")) {
+                    this->SetTempoDist(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1554,10 +1843,19 @@ void AttDotLog::ResetDotLog()
 bool AttDotLog::ReadDotLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToDotLogForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1594,10 +1892,19 @@ void AttDurationAdditive::ResetDurationAdditive()
 bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dur")) {
+                    this->SetDur(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1636,20 +1943,31 @@ void AttDurationDefault::ResetDurationDefault()
 bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        if (removeAttr) element.remove_attribute("dur.default");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        if (removeAttr) element.remove_attribute("num.default");
-        hasAttribute = true;
-    }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        if (removeAttr) element.remove_attribute("numbase.default");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dur.default")) {
+                    this->SetDurDefault(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'n':
+                if (!std::strcmp(name, "num.default")) {
+                    this->SetNumDefault(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "numbase.default")) {
+                    this->SetNumbaseDefault(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1704,10 +2022,19 @@ void AttDurationLog::ResetDurationLog()
 bool AttDurationLog::ReadDurationLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dur")) {
+                    this->SetDur(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1745,15 +2072,24 @@ void AttDurationRatio::ResetDurationRatio()
 bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
-        hasAttribute = true;
-    }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        if (removeAttr) element.remove_attribute("numbase");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "num")) {
+                    this->SetNum(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "numbase")) {
+                    this->SetNumbase(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1799,10 +2135,19 @@ void AttEnclosingChars::ResetEnclosingChars()
 bool AttEnclosingChars::ReadEnclosingChars(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        if (removeAttr) element.remove_attribute("enclose");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "enclose")) {
+                    this->SetEnclose(StrToEnclosure(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1839,10 +2184,19 @@ void AttEndings::ResetEndings()
 bool AttEndings::ReadEndings(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        if (removeAttr) element.remove_attribute("ending.rend");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "ending.rend")) {
+                    this->SetEndingRend(StrToEndingsEndingrend(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1880,15 +2234,26 @@ void AttEvidence::ResetEvidence()
 bool AttEvidence::ReadEvidence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        if (removeAttr) element.remove_attribute("cert");
-        hasAttribute = true;
-    }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        if (removeAttr) element.remove_attribute("evidence");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "cert")) {
+                    this->SetCert(StrToCertainty(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'e':
+                if (!std::strcmp(name, "evidence")) {
+                    this->SetEvidence(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1934,10 +2299,19 @@ void AttExtender::ResetExtender()
 bool AttExtender::ReadExtender(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        if (removeAttr) element.remove_attribute("extender");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "extender")) {
+                    this->SetExtender(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1974,10 +2348,19 @@ void AttExtent::ResetExtent()
 bool AttExtent::ReadExtent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        if (removeAttr) element.remove_attribute("extent");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "extent")) {
+                    this->SetExtent(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2014,10 +2397,19 @@ void AttFermataPresent::ResetFermataPresent()
 bool AttFermataPresent::ReadFermataPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToStaffrelBasic(element.attribute("fermata").value()));
-        if (removeAttr) element.remove_attribute("fermata");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "fermata")) {
+                    this->SetFermata(StrToStaffrelBasic(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2054,10 +2446,19 @@ void AttFiling::ResetFiling()
 bool AttFiling::ReadFiling(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        if (removeAttr) element.remove_attribute("nonfiling");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "nonfiling")) {
+                    this->SetNonfiling(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2094,10 +2495,19 @@ void AttGrpSymLog::ResetGrpSymLog()
 bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        if (removeAttr) element.remove_attribute("level");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "level")) {
+                    this->SetLevel(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2134,10 +2544,19 @@ void AttHandIdent::ResetHandIdent()
 bool AttHandIdent::ReadHandIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        if (removeAttr) element.remove_attribute("hand");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'h':
+                if (!std::strcmp(name, "hand")) {
+                    this->SetHand(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2174,10 +2593,19 @@ void AttHeight::ResetHeight()
 bool AttHeight::ReadHeight(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToMeasurementunsigned(element.attribute("height").value()));
-        if (removeAttr) element.remove_attribute("height");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'h':
+                if (!std::strcmp(name, "height")) {
+                    this->SetHeight(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2214,10 +2642,19 @@ void AttHorizontalAlign::ResetHorizontalAlign()
 bool AttHorizontalAlign::ReadHorizontalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        if (removeAttr) element.remove_attribute("halign");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'h':
+                if (!std::strcmp(name, "halign")) {
+                    this->SetHalign(StrToHorizontalalignment(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2254,10 +2691,19 @@ void AttInternetMedia::ResetInternetMedia()
 bool AttInternetMedia::ReadInternetMedia(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        if (removeAttr) element.remove_attribute("mimetype");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "mimetype")) {
+                    this->SetMimetype(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2294,10 +2740,19 @@ void AttJoined::ResetJoined()
 bool AttJoined::ReadJoined(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        if (removeAttr) element.remove_attribute("join");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'j':
+                if (!std::strcmp(name, "join")) {
+                    this->SetJoin(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2334,10 +2789,19 @@ void AttKeySigLog::ResetKeySigLog()
 bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        if (removeAttr) element.remove_attribute("sig");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "sig")) {
+                    this->SetSig(StrToKeysignature(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2374,10 +2838,19 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
 bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.sig")) {
-        this->SetKeySig(StrToKeysignature(element.attribute("key.sig").value()));
-        if (removeAttr) element.remove_attribute("key.sig");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'k':
+                if (!std::strcmp(name, "key.sig")) {
+                    this->SetKeySig(StrToKeysignature(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2414,10 +2887,19 @@ void AttLabelled::ResetLabelled()
 bool AttLabelled::ReadLabelled(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        if (removeAttr) element.remove_attribute("label");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "label")) {
+                    this->SetLabel(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2455,15 +2937,26 @@ void AttLang::ResetLang()
 bool AttLang::ReadLang(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        if (removeAttr) element.remove_attribute("xml:lang");
-        hasAttribute = true;
-    }
-    if (element.attribute("translit")) {
-        this->SetTranslit(StrToStr(element.attribute("translit").value()));
-        if (removeAttr) element.remove_attribute("translit");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "translit")) {
+                    this->SetTranslit(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'x':
+                if (!std::strcmp(name, "xml:lang")) {
+                    this->SetLang(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2509,10 +3002,19 @@ void AttLayerLog::ResetLayerLog()
 bool AttLayerLog::ReadLayerLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        if (removeAttr) element.remove_attribute("def");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "def")) {
+                    this->SetDef(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2549,10 +3051,19 @@ void AttLayerIdent::ResetLayerIdent()
 bool AttLayerIdent::ReadLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        if (removeAttr) element.remove_attribute("layer");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "layer")) {
+                    this->SetLayer(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2589,10 +3100,19 @@ void AttLineLoc::ResetLineLoc()
 bool AttLineLoc::ReadLineLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        if (removeAttr) element.remove_attribute("line");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "line")) {
+                    this->SetLine(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2632,25 +3152,34 @@ void AttLineRend::ResetLineRend()
 bool AttLineRend::ReadLineRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        if (removeAttr) element.remove_attribute("lendsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("lendsym.size")) {
-        this->SetLendsymSize(StrToInt(element.attribute("lendsym.size").value()));
-        if (removeAttr) element.remove_attribute("lendsym.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        if (removeAttr) element.remove_attribute("lstartsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("lstartsym.size")) {
-        this->SetLstartsymSize(StrToInt(element.attribute("lstartsym.size").value()));
-        if (removeAttr) element.remove_attribute("lstartsym.size");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lendsym")) {
+                    this->SetLendsym(StrToLinestartendsymbol(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lendsym.size")) {
+                    this->SetLendsymSize(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lstartsym")) {
+                    this->SetLstartsym(StrToLinestartendsymbol(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lstartsym.size")) {
+                    this->SetLstartsymSize(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2716,20 +3245,29 @@ void AttLineRendBase::ResetLineRendBase()
 bool AttLineRendBase::ReadLineRendBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        if (removeAttr) element.remove_attribute("lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("lsegs")) {
-        this->SetLsegs(StrToInt(element.attribute("lsegs").value()));
-        if (removeAttr) element.remove_attribute("lsegs");
-        hasAttribute = true;
-    }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        if (removeAttr) element.remove_attribute("lwidth");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lform")) {
+                    this->SetLform(StrToLineform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lsegs")) {
+                    this->SetLsegs(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lwidth")) {
+                    this->SetLwidth(StrToLinewidth(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2791,45 +3329,62 @@ void AttLinking::ResetLinking()
 bool AttLinking::ReadLinking(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        if (removeAttr) element.remove_attribute("copyof");
-        hasAttribute = true;
-    }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        if (removeAttr) element.remove_attribute("corresp");
-        hasAttribute = true;
-    }
-    if (element.attribute("follows")) {
-        this->SetFollows(StrToStr(element.attribute("follows").value()));
-        if (removeAttr) element.remove_attribute("follows");
-        hasAttribute = true;
-    }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        if (removeAttr) element.remove_attribute("next");
-        hasAttribute = true;
-    }
-    if (element.attribute("precedes")) {
-        this->SetPrecedes(StrToStr(element.attribute("precedes").value()));
-        if (removeAttr) element.remove_attribute("precedes");
-        hasAttribute = true;
-    }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        if (removeAttr) element.remove_attribute("prev");
-        hasAttribute = true;
-    }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        if (removeAttr) element.remove_attribute("sameas");
-        hasAttribute = true;
-    }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        if (removeAttr) element.remove_attribute("synch");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "copyof")) {
+                    this->SetCopyof(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "corresp")) {
+                    this->SetCorresp(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "follows")) {
+                    this->SetFollows(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'n':
+                if (!std::strcmp(name, "next")) {
+                    this->SetNext(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "precedes")) {
+                    this->SetPrecedes(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "prev")) {
+                    this->SetPrev(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "sameas")) {
+                    this->SetSameas(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "synch")) {
+                    this->SetSynch(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2934,35 +3489,44 @@ void AttLyricStyle::ResetLyricStyle()
 bool AttLyricStyle::ReadLyricStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToMeasurementsigned(element.attribute("lyric.align").value()));
-        if (removeAttr) element.remove_attribute("lyric.align");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        if (removeAttr) element.remove_attribute("lyric.fam");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        if (removeAttr) element.remove_attribute("lyric.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToFontsize(element.attribute("lyric.size").value()));
-        if (removeAttr) element.remove_attribute("lyric.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        if (removeAttr) element.remove_attribute("lyric.style");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        if (removeAttr) element.remove_attribute("lyric.weight");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lyric.align")) {
+                    this->SetLyricAlign(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lyric.fam")) {
+                    this->SetLyricFam(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lyric.name")) {
+                    this->SetLyricName(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lyric.size")) {
+                    this->SetLyricSize(StrToFontsize(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lyric.style")) {
+                    this->SetLyricStyle(StrToFontstyle(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lyric.weight")) {
+                    this->SetLyricWeight(StrToFontweight(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3044,10 +3608,19 @@ void AttMeasureNumbers::ResetMeasureNumbers()
 bool AttMeasureNumbers::ReadMeasureNumbers(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        if (removeAttr) element.remove_attribute("mnum.visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "mnum.visible")) {
+                    this->SetMnumVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3084,10 +3657,19 @@ void AttMeasurement::ResetMeasurement()
 bool AttMeasurement::ReadMeasurement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        if (removeAttr) element.remove_attribute("unit");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'u':
+                if (!std::strcmp(name, "unit")) {
+                    this->SetUnit(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3126,20 +3708,31 @@ void AttMediaBounds::ResetMediaBounds()
 bool AttMediaBounds::ReadMediaBounds(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        if (removeAttr) element.remove_attribute("begin");
-        hasAttribute = true;
-    }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        if (removeAttr) element.remove_attribute("end");
-        hasAttribute = true;
-    }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        if (removeAttr) element.remove_attribute("betype");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "begin")) {
+                    this->SetBegin(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "betype")) {
+                    this->SetBetype(StrToBetype(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'e':
+                if (!std::strcmp(name, "end")) {
+                    this->SetEnd(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3194,10 +3787,19 @@ void AttMedium::ResetMedium()
 bool AttMedium::ReadMedium(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        if (removeAttr) element.remove_attribute("medium");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "medium")) {
+                    this->SetMedium(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3234,10 +3836,19 @@ void AttMeiVersion::ResetMeiVersion()
 bool AttMeiVersion::ReadMeiVersion(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiVersionMeiversion(element.attribute("meiversion").value()));
-        if (removeAttr) element.remove_attribute("meiversion");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "meiversion")) {
+                    this->SetMeiversion(StrToMeiVersionMeiversion(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3274,10 +3885,19 @@ void AttMetadataPointing::ResetMetadataPointing()
 bool AttMetadataPointing::ReadMetadataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        if (removeAttr) element.remove_attribute("decls");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "decls")) {
+                    this->SetDecls(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3314,10 +3934,19 @@ void AttMeterConformance::ResetMeterConformance()
 bool AttMeterConformance::ReadMeterConformance(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterConformanceMetcon(element.attribute("metcon").value()));
-        if (removeAttr) element.remove_attribute("metcon");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "metcon")) {
+                    this->SetMetcon(StrToMeterConformanceMetcon(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3355,15 +3984,26 @@ void AttMeterConformanceBar::ResetMeterConformanceBar()
 bool AttMeterConformanceBar::ReadMeterConformanceBar(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        if (removeAttr) element.remove_attribute("metcon");
-        hasAttribute = true;
-    }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        if (removeAttr) element.remove_attribute("control");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "control")) {
+                    this->SetControl(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'm':
+                if (!std::strcmp(name, "metcon")) {
+                    this->SetMetcon(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3411,20 +4051,33 @@ void AttMeterSigLog::ResetMeterSigLog()
 bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToMetercountPair(element.attribute("count").value()));
-        if (removeAttr) element.remove_attribute("count");
-        hasAttribute = true;
-    }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        if (removeAttr) element.remove_attribute("sym");
-        hasAttribute = true;
-    }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        if (removeAttr) element.remove_attribute("unit");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "count")) {
+                    this->SetCount(StrToMetercountPair(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "sym")) {
+                    this->SetSym(StrToMetersign(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'u':
+                if (!std::strcmp(name, "unit")) {
+                    this->SetUnit(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3481,20 +4134,29 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
 bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToMetercountPair(element.attribute("meter.count").value()));
-        if (removeAttr) element.remove_attribute("meter.count");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        if (removeAttr) element.remove_attribute("meter.unit");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        if (removeAttr) element.remove_attribute("meter.sym");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "meter.count")) {
+                    this->SetMeterCount(StrToMetercountPair(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "meter.unit")) {
+                    this->SetMeterUnit(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "meter.sym")) {
+                    this->SetMeterSym(StrToMetersign(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3551,20 +4213,29 @@ void AttMmTempo::ResetMmTempo()
 bool AttMmTempo::ReadMmTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToDbl(element.attribute("mm").value()));
-        if (removeAttr) element.remove_attribute("mm");
-        hasAttribute = true;
-    }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        if (removeAttr) element.remove_attribute("mm.unit");
-        hasAttribute = true;
-    }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        if (removeAttr) element.remove_attribute("mm.dots");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "mm")) {
+                    this->SetMm(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mm.unit")) {
+                    this->SetMmUnit(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mm.dots")) {
+                    this->SetMmDots(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3619,10 +4290,19 @@ void AttMultinumMeasures::ResetMultinumMeasures()
 bool AttMultinumMeasures::ReadMultinumMeasures(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        if (removeAttr) element.remove_attribute("multi.number");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "multi.number")) {
+                    this->SetMultiNumber(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3659,10 +4339,19 @@ void AttNInteger::ResetNInteger()
 bool AttNInteger::ReadNInteger(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        if (removeAttr) element.remove_attribute("n");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "n")) {
+                    this->SetN(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3699,10 +4388,19 @@ void AttNNumberLike::ResetNNumberLike()
 bool AttNNumberLike::ReadNNumberLike(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToStr(element.attribute("n").value()));
-        if (removeAttr) element.remove_attribute("n");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "n")) {
+                    this->SetN(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3740,15 +4438,26 @@ void AttName::ResetName()
 bool AttName::ReadName(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        if (removeAttr) element.remove_attribute("nymref");
-        hasAttribute = true;
-    }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        if (removeAttr) element.remove_attribute("role");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'n':
+                if (!std::strcmp(name, "nymref")) {
+                    this->SetNymref(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "role")) {
+                    this->SetRole(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3795,15 +4504,24 @@ void AttNotationStyle::ResetNotationStyle()
 bool AttNotationStyle::ReadNotationStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        if (removeAttr) element.remove_attribute("music.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToFontsize(element.attribute("music.size").value()));
-        if (removeAttr) element.remove_attribute("music.size");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "music.name")) {
+                    this->SetMusicName(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "music.size")) {
+                    this->SetMusicSize(StrToFontsize(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -3857,50 +4575,59 @@ void AttNoteHeads::ResetNoteHeads()
 bool AttNoteHeads::ReadNoteHeads(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("head.altsym")) {
-        this->SetHeadAltsym(StrToStr(element.attribute("head.altsym").value()));
-        if (removeAttr) element.remove_attribute("head.altsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.auth")) {
-        this->SetHeadAuth(StrToStr(element.attribute("head.auth").value()));
-        if (removeAttr) element.remove_attribute("head.auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        if (removeAttr) element.remove_attribute("head.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        if (removeAttr) element.remove_attribute("head.fill");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        if (removeAttr) element.remove_attribute("head.fillcolor");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToNoteheadmodifier(element.attribute("head.mod").value()));
-        if (removeAttr) element.remove_attribute("head.mod");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToRotation(element.attribute("head.rotation").value()));
-        if (removeAttr) element.remove_attribute("head.rotation");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshape(element.attribute("head.shape").value()));
-        if (removeAttr) element.remove_attribute("head.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        if (removeAttr) element.remove_attribute("head.visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'h':
+                if (!std::strcmp(name, "head.altsym")) {
+                    this->SetHeadAltsym(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.auth")) {
+                    this->SetHeadAuth(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.color")) {
+                    this->SetHeadColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.fill")) {
+                    this->SetHeadFill(StrToFill(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.fillcolor")) {
+                    this->SetHeadFillcolor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.mod")) {
+                    this->SetHeadMod(StrToNoteheadmodifier(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.rotation")) {
+                    this->SetHeadRotation(StrToRotation(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.shape")) {
+                    this->SetHeadShape(StrToHeadshape(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "head.visible")) {
+                    this->SetHeadVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4009,10 +4736,19 @@ void AttOctave::ResetOctave()
 bool AttOctave::ReadOctave(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToOctave(element.attribute("oct").value()));
-        if (removeAttr) element.remove_attribute("oct");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "oct")) {
+                    this->SetOct(StrToOctave(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4049,10 +4785,19 @@ void AttOctaveDefault::ResetOctaveDefault()
 bool AttOctaveDefault::ReadOctaveDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.default")) {
-        this->SetOctDefault(StrToOctave(element.attribute("oct.default").value()));
-        if (removeAttr) element.remove_attribute("oct.default");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "oct.default")) {
+                    this->SetOctDefault(StrToOctave(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4090,15 +4835,24 @@ void AttOctaveDisplacement::ResetOctaveDisplacement()
 bool AttOctaveDisplacement::ReadOctaveDisplacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        if (removeAttr) element.remove_attribute("dis");
-        hasAttribute = true;
-    }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToStaffrelBasic(element.attribute("dis.place").value()));
-        if (removeAttr) element.remove_attribute("dis.place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dis")) {
+                    this->SetDis(StrToOctaveDis(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "dis.place")) {
+                    this->SetDisPlace(StrToStaffrelBasic(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4144,10 +4898,19 @@ void AttOneLineStaff::ResetOneLineStaff()
 bool AttOneLineStaff::ReadOneLineStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        if (removeAttr) element.remove_attribute("ontheline");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "ontheline")) {
+                    this->SetOntheline(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4184,10 +4947,19 @@ void AttOptimization::ResetOptimization()
 bool AttOptimization::ReadOptimization(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        if (removeAttr) element.remove_attribute("optimize");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "optimize")) {
+                    this->SetOptimize(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4224,10 +4996,19 @@ void AttOriginLayerIdent::ResetOriginLayerIdent()
 bool AttOriginLayerIdent::ReadOriginLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        if (removeAttr) element.remove_attribute("origin.layer");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "origin.layer")) {
+                    this->SetOriginLayer(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4264,10 +5045,19 @@ void AttOriginStaffIdent::ResetOriginStaffIdent()
 bool AttOriginStaffIdent::ReadOriginStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        if (removeAttr) element.remove_attribute("origin.staff");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "origin.staff")) {
+                    this->SetOriginStaff(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4305,15 +5095,24 @@ void AttOriginStartEndId::ResetOriginStartEndId()
 bool AttOriginStartEndId::ReadOriginStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        if (removeAttr) element.remove_attribute("origin.startid");
-        hasAttribute = true;
-    }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        if (removeAttr) element.remove_attribute("origin.endid");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "origin.startid")) {
+                    this->SetOriginStartid(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "origin.endid")) {
+                    this->SetOriginEndid(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4360,15 +5159,24 @@ void AttOriginTimestampLog::ResetOriginTimestampLog()
 bool AttOriginTimestampLog::ReadOriginTimestampLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        if (removeAttr) element.remove_attribute("origin.tstamp");
-        hasAttribute = true;
-    }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        if (removeAttr) element.remove_attribute("origin.tstamp2");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "origin.tstamp")) {
+                    this->SetOriginTstamp(StrToMeasurebeat(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "origin.tstamp2")) {
+                    this->SetOriginTstamp2(StrToMeasurebeat(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4421,45 +5229,54 @@ void AttPages::ResetPages()
 bool AttPages::ReadPages(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToMeasurementunsigned(element.attribute("page.height").value()));
-        if (removeAttr) element.remove_attribute("page.height");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToMeasurementunsigned(element.attribute("page.width").value()));
-        if (removeAttr) element.remove_attribute("page.width");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToMeasurementunsigned(element.attribute("page.topmar").value()));
-        if (removeAttr) element.remove_attribute("page.topmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToMeasurementunsigned(element.attribute("page.botmar").value()));
-        if (removeAttr) element.remove_attribute("page.botmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToMeasurementunsigned(element.attribute("page.leftmar").value()));
-        if (removeAttr) element.remove_attribute("page.leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToMeasurementunsigned(element.attribute("page.rightmar").value()));
-        if (removeAttr) element.remove_attribute("page.rightmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        if (removeAttr) element.remove_attribute("page.panels");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        if (removeAttr) element.remove_attribute("page.scale");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "page.height")) {
+                    this->SetPageHeight(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.width")) {
+                    this->SetPageWidth(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.topmar")) {
+                    this->SetPageTopmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.botmar")) {
+                    this->SetPageBotmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.leftmar")) {
+                    this->SetPageLeftmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.rightmar")) {
+                    this->SetPageRightmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.panels")) {
+                    this->SetPagePanels(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "page.scale")) {
+                    this->SetPageScale(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4560,15 +5377,24 @@ void AttPartIdent::ResetPartIdent()
 bool AttPartIdent::ReadPartIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("part")) {
-        this->SetPart(StrToStr(element.attribute("part").value()));
-        if (removeAttr) element.remove_attribute("part");
-        hasAttribute = true;
-    }
-    if (element.attribute("partstaff")) {
-        this->SetPartstaff(StrToStr(element.attribute("partstaff").value()));
-        if (removeAttr) element.remove_attribute("partstaff");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "part")) {
+                    this->SetPart(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "partstaff")) {
+                    this->SetPartstaff(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4614,10 +5440,19 @@ void AttPitch::ResetPitch()
 bool AttPitch::ReadPitch(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        if (removeAttr) element.remove_attribute("pname");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "pname")) {
+                    this->SetPname(StrToPitchname(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4654,10 +5489,19 @@ void AttPlacementOnStaff::ResetPlacementOnStaff()
 bool AttPlacementOnStaff::ReadPlacementOnStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("onstaff")) {
-        this->SetOnstaff(StrToBoolean(element.attribute("onstaff").value()));
-        if (removeAttr) element.remove_attribute("onstaff");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "onstaff")) {
+                    this->SetOnstaff(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4694,10 +5538,19 @@ void AttPlacementRelEvent::ResetPlacementRelEvent()
 bool AttPlacementRelEvent::ReadPlacementRelEvent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToStaffrel(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4734,10 +5587,19 @@ void AttPlacementRelStaff::ResetPlacementRelStaff()
 bool AttPlacementRelStaff::ReadPlacementRelStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToStaffrel(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4774,10 +5636,19 @@ void AttPlist::ResetPlist()
 bool AttPlist::ReadPlist(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToXsdAnyURIList(element.attribute("plist").value()));
-        if (removeAttr) element.remove_attribute("plist");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "plist")) {
+                    this->SetPlist(StrToXsdAnyURIList(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4818,30 +5689,41 @@ void AttPointing::ResetPointing()
 bool AttPointing::ReadPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        if (removeAttr) element.remove_attribute("xlink:actuate");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        if (removeAttr) element.remove_attribute("xlink:role");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        if (removeAttr) element.remove_attribute("xlink:show");
-        hasAttribute = true;
-    }
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
-        hasAttribute = true;
-    }
-    if (element.attribute("targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("targettype").value()));
-        if (removeAttr) element.remove_attribute("targettype");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "target")) {
+                    this->SetTarget(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "targettype")) {
+                    this->SetTargettype(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'x':
+                if (!std::strcmp(name, "xlink:actuate")) {
+                    this->SetActuate(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "xlink:role")) {
+                    this->SetRole(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "xlink:show")) {
+                    this->SetShow(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4914,10 +5796,19 @@ void AttQuantity::ResetQuantity()
 bool AttQuantity::ReadQuantity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        if (removeAttr) element.remove_attribute("quantity");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'q':
+                if (!std::strcmp(name, "quantity")) {
+                    this->SetQuantity(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -4958,30 +5849,43 @@ void AttRanging::ResetRanging()
 bool AttRanging::ReadRanging(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("atleast")) {
-        this->SetAtleast(StrToDbl(element.attribute("atleast").value()));
-        if (removeAttr) element.remove_attribute("atleast");
-        hasAttribute = true;
-    }
-    if (element.attribute("atmost")) {
-        this->SetAtmost(StrToDbl(element.attribute("atmost").value()));
-        if (removeAttr) element.remove_attribute("atmost");
-        hasAttribute = true;
-    }
-    if (element.attribute("min")) {
-        this->SetMin(StrToDbl(element.attribute("min").value()));
-        if (removeAttr) element.remove_attribute("min");
-        hasAttribute = true;
-    }
-    if (element.attribute("max")) {
-        this->SetMax(StrToDbl(element.attribute("max").value()));
-        if (removeAttr) element.remove_attribute("max");
-        hasAttribute = true;
-    }
-    if (element.attribute("confidence")) {
-        this->SetConfidence(StrToDbl(element.attribute("confidence").value()));
-        if (removeAttr) element.remove_attribute("confidence");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "atleast")) {
+                    this->SetAtleast(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "atmost")) {
+                    this->SetAtmost(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'c':
+                if (!std::strcmp(name, "confidence")) {
+                    this->SetConfidence(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'm':
+                if (!std::strcmp(name, "min")) {
+                    this->SetMin(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "max")) {
+                    this->SetMax(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5054,10 +5958,19 @@ void AttRepeatMarkLog::ResetRepeatMarkLog()
 bool AttRepeatMarkLog::ReadRepeatMarkLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToRepeatMarkLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "func")) {
+                    this->SetFunc(StrToRepeatMarkLogFunc(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5094,10 +6007,19 @@ void AttResponsibility::ResetResponsibility()
 bool AttResponsibility::ReadResponsibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        if (removeAttr) element.remove_attribute("resp");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "resp")) {
+                    this->SetResp(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5134,10 +6056,19 @@ void AttRestdurationLog::ResetRestdurationLog()
 bool AttRestdurationLog::ReadRestdurationLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dur")) {
+                    this->SetDur(StrToDuration(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5174,10 +6105,19 @@ void AttScalable::ResetScalable()
 bool AttScalable::ReadScalable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        if (removeAttr) element.remove_attribute("scale");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "scale")) {
+                    this->SetScale(StrToPercent(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5214,10 +6154,19 @@ void AttSequence::ResetSequence()
 bool AttSequence::ReadSequence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        if (removeAttr) element.remove_attribute("seq");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "seq")) {
+                    this->SetSeq(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5254,10 +6203,19 @@ void AttSlashCount::ResetSlashCount()
 bool AttSlashCount::ReadSlashCount(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "slash")) {
+                    this->SetSlash(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5294,10 +6252,19 @@ void AttSlurPresent::ResetSlurPresent()
 bool AttSlurPresent::ReadSlurPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        if (removeAttr) element.remove_attribute("slur");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "slur")) {
+                    this->SetSlur(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5334,10 +6301,19 @@ void AttSource::ResetSource()
 bool AttSource::ReadSource(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        if (removeAttr) element.remove_attribute("source");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "source")) {
+                    this->SetSource(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5377,25 +6353,34 @@ void AttSpacing::ResetSpacing()
 bool AttSpacing::ReadSpacing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        if (removeAttr) element.remove_attribute("spacing.packexp");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        if (removeAttr) element.remove_attribute("spacing.packfact");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToMeasurementsigned(element.attribute("spacing.staff").value()));
-        if (removeAttr) element.remove_attribute("spacing.staff");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToMeasurementsigned(element.attribute("spacing.system").value()));
-        if (removeAttr) element.remove_attribute("spacing.system");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "spacing.packexp")) {
+                    this->SetSpacingPackexp(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "spacing.packfact")) {
+                    this->SetSpacingPackfact(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "spacing.staff")) {
+                    this->SetSpacingStaff(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "spacing.system")) {
+                    this->SetSpacingSystem(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5459,10 +6444,19 @@ void AttStaffLog::ResetStaffLog()
 bool AttStaffLog::ReadStaffLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        if (removeAttr) element.remove_attribute("def");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "def")) {
+                    this->SetDef(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5499,10 +6493,19 @@ void AttStaffDefLog::ResetStaffDefLog()
 bool AttStaffDefLog::ReadStaffDefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        if (removeAttr) element.remove_attribute("lines");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "lines")) {
+                    this->SetLines(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5539,10 +6542,19 @@ void AttStaffGroupingSym::ResetStaffGroupingSym()
 bool AttStaffGroupingSym::ReadStaffGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffGroupingSymSymbol(element.attribute("symbol").value()));
-        if (removeAttr) element.remove_attribute("symbol");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "symbol")) {
+                    this->SetSymbol(StrToStaffGroupingSymSymbol(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5579,10 +6591,19 @@ void AttStaffIdent::ResetStaffIdent()
 bool AttStaffIdent::ReadStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        if (removeAttr) element.remove_attribute("staff");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "staff")) {
+                    this->SetStaff(StrToXsdPositiveIntegerList(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5621,20 +6642,31 @@ void AttStaffItems::ResetStaffItems()
 bool AttStaffItems::ReadStaffItems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("aboveorder")) {
-        this->SetAboveorder(StrToStaffitem(element.attribute("aboveorder").value()));
-        if (removeAttr) element.remove_attribute("aboveorder");
-        hasAttribute = true;
-    }
-    if (element.attribute("beloworder")) {
-        this->SetBeloworder(StrToStaffitem(element.attribute("beloworder").value()));
-        if (removeAttr) element.remove_attribute("beloworder");
-        hasAttribute = true;
-    }
-    if (element.attribute("betweenorder")) {
-        this->SetBetweenorder(StrToStaffitem(element.attribute("betweenorder").value()));
-        if (removeAttr) element.remove_attribute("betweenorder");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "aboveorder")) {
+                    this->SetAboveorder(StrToStaffitem(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'b':
+                if (!std::strcmp(name, "beloworder")) {
+                    this->SetBeloworder(StrToStaffitem(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "betweenorder")) {
+                    this->SetBetweenorder(StrToStaffitem(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5689,10 +6721,19 @@ void AttStaffLoc::ResetStaffLoc()
 bool AttStaffLoc::ReadStaffLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        if (removeAttr) element.remove_attribute("loc");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "loc")) {
+                    this->SetLoc(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5730,15 +6771,26 @@ void AttStaffLocPitched::ResetStaffLocPitched()
 bool AttStaffLocPitched::ReadStaffLocPitched(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        if (removeAttr) element.remove_attribute("ploc");
-        hasAttribute = true;
-    }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToOctave(element.attribute("oloc").value()));
-        if (removeAttr) element.remove_attribute("oloc");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "oloc")) {
+                    this->SetOloc(StrToOctave(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "ploc")) {
+                    this->SetPloc(StrToPitchname(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5784,10 +6836,19 @@ void AttStartEndId::ResetStartEndId()
 bool AttStartEndId::ReadStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        if (removeAttr) element.remove_attribute("endid");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "endid")) {
+                    this->SetEndid(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5824,10 +6885,19 @@ void AttStartId::ResetStartId()
 bool AttStartId::ReadStartId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        if (removeAttr) element.remove_attribute("startid");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "startid")) {
+                    this->SetStartid(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -5871,45 +6941,54 @@ void AttStems::ResetStems()
 bool AttStems::ReadStems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        if (removeAttr) element.remove_attribute("stem.dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToDbl(element.attribute("stem.len").value()));
-        if (removeAttr) element.remove_attribute("stem.len");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        if (removeAttr) element.remove_attribute("stem.mod");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        if (removeAttr) element.remove_attribute("stem.pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.sameas")) {
-        this->SetStemSameas(StrToStr(element.attribute("stem.sameas").value()));
-        if (removeAttr) element.remove_attribute("stem.sameas");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.visible")) {
-        this->SetStemVisible(StrToBoolean(element.attribute("stem.visible").value()));
-        if (removeAttr) element.remove_attribute("stem.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        if (removeAttr) element.remove_attribute("stem.x");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        if (removeAttr) element.remove_attribute("stem.y");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "stem.dir")) {
+                    this->SetStemDir(StrToStemdirection(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.len")) {
+                    this->SetStemLen(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.mod")) {
+                    this->SetStemMod(StrToStemmodifier(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.pos")) {
+                    this->SetStemPos(StrToStemposition(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.sameas")) {
+                    this->SetStemSameas(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.visible")) {
+                    this->SetStemVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.x")) {
+                    this->SetStemX(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "stem.y")) {
+                    this->SetStemY(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6010,15 +7089,26 @@ void AttSylLog::ResetSylLog()
 bool AttSylLog::ReadSylLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        if (removeAttr) element.remove_attribute("con");
-        hasAttribute = true;
-    }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        if (removeAttr) element.remove_attribute("wordpos");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "con")) {
+                    this->SetCon(StrToSylLogCon(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'w':
+                if (!std::strcmp(name, "wordpos")) {
+                    this->SetWordpos(StrToSylLogWordpos(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6064,10 +7154,19 @@ void AttSylText::ResetSylText()
 bool AttSylText::ReadSylText(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        if (removeAttr) element.remove_attribute("syl");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "syl")) {
+                    this->SetSyl(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6107,25 +7206,34 @@ void AttSystems::ResetSystems()
 bool AttSystems::ReadSystems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        if (removeAttr) element.remove_attribute("system.leftline");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToMeasurementunsigned(element.attribute("system.leftmar").value()));
-        if (removeAttr) element.remove_attribute("system.leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToMeasurementunsigned(element.attribute("system.rightmar").value()));
-        if (removeAttr) element.remove_attribute("system.rightmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToMeasurementunsigned(element.attribute("system.topmar").value()));
-        if (removeAttr) element.remove_attribute("system.topmar");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "system.leftline")) {
+                    this->SetSystemLeftline(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "system.leftmar")) {
+                    this->SetSystemLeftmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "system.rightmar")) {
+                    this->SetSystemRightmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "system.topmar")) {
+                    this->SetSystemTopmar(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6189,10 +7297,19 @@ void AttTargetEval::ResetTargetEval()
 bool AttTargetEval::ReadTargetEval(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetEvalEvaluate(element.attribute("evaluate").value()));
-        if (removeAttr) element.remove_attribute("evaluate");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "evaluate")) {
+                    this->SetEvaluate(StrToTargetEvalEvaluate(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6229,10 +7346,19 @@ void AttTempoLog::ResetTempoLog()
 bool AttTempoLog::ReadTempoLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "func")) {
+                    this->SetFunc(StrToTempoLogFunc(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6270,15 +7396,26 @@ void AttTextRendition::ResetTextRendition()
 bool AttTextRendition::ReadTextRendition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altrend")) {
-        this->SetAltrend(StrToStr(element.attribute("altrend").value()));
-        if (removeAttr) element.remove_attribute("altrend");
-        hasAttribute = true;
-    }
-    if (element.attribute("rend")) {
-        this->SetRend(StrToTextrendition(element.attribute("rend").value()));
-        if (removeAttr) element.remove_attribute("rend");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "altrend")) {
+                    this->SetAltrend(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'r':
+                if (!std::strcmp(name, "rend")) {
+                    this->SetRend(StrToTextrendition(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6328,30 +7465,39 @@ void AttTextStyle::ResetTextStyle()
 bool AttTextStyle::ReadTextStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        if (removeAttr) element.remove_attribute("text.fam");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        if (removeAttr) element.remove_attribute("text.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToFontsize(element.attribute("text.size").value()));
-        if (removeAttr) element.remove_attribute("text.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        if (removeAttr) element.remove_attribute("text.style");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        if (removeAttr) element.remove_attribute("text.weight");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "text.fam")) {
+                    this->SetTextFam(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "text.name")) {
+                    this->SetTextName(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "text.size")) {
+                    this->SetTextSize(StrToFontsize(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "text.style")) {
+                    this->SetTextStyle(StrToFontstyle(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "text.weight")) {
+                    this->SetTextWeight(StrToFontweight(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6424,10 +7570,19 @@ void AttTiePresent::ResetTiePresent()
 bool AttTiePresent::ReadTiePresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        if (removeAttr) element.remove_attribute("tie");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tie")) {
+                    this->SetTie(StrToTie(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6464,10 +7619,19 @@ void AttTimestampLog::ResetTimestampLog()
 bool AttTimestampLog::ReadTimestampLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        if (removeAttr) element.remove_attribute("tstamp");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tstamp")) {
+                    this->SetTstamp(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6504,10 +7668,19 @@ void AttTimestamp2Log::ResetTimestamp2Log()
 bool AttTimestamp2Log::ReadTimestamp2Log(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        if (removeAttr) element.remove_attribute("tstamp2");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tstamp2")) {
+                    this->SetTstamp2(StrToMeasurebeat(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6545,15 +7718,24 @@ void AttTransposition::ResetTransposition()
 bool AttTransposition::ReadTransposition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToInt(element.attribute("trans.diat").value()));
-        if (removeAttr) element.remove_attribute("trans.diat");
-        hasAttribute = true;
-    }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToInt(element.attribute("trans.semi").value()));
-        if (removeAttr) element.remove_attribute("trans.semi");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "trans.diat")) {
+                    this->SetTransDiat(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "trans.semi")) {
+                    this->SetTransSemi(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6601,20 +7783,29 @@ void AttTuning::ResetTuning()
 bool AttTuning::ReadTuning(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        if (removeAttr) element.remove_attribute("tune.Hz");
-        hasAttribute = true;
-    }
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        if (removeAttr) element.remove_attribute("tune.pname");
-        hasAttribute = true;
-    }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        if (removeAttr) element.remove_attribute("tune.temper");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tune.Hz")) {
+                    this->SetTuneHz(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "tune.pname")) {
+                    this->SetTunePname(StrToPitchname(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "tune.temper")) {
+                    this->SetTuneTemper(StrToTemperament(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6669,10 +7860,19 @@ void AttTupletPresent::ResetTupletPresent()
 bool AttTupletPresent::ReadTupletPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        if (removeAttr) element.remove_attribute("tuplet");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "tuplet")) {
+                    this->SetTuplet(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6709,10 +7909,19 @@ void AttTyped::ResetTyped()
 bool AttTyped::ReadTyped(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        if (removeAttr) element.remove_attribute("type");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "type")) {
+                    this->SetType(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6755,40 +7964,51 @@ void AttTypography::ResetTypography()
 bool AttTypography::ReadTypography(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        if (removeAttr) element.remove_attribute("fontfam");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        if (removeAttr) element.remove_attribute("fontname");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToFontsize(element.attribute("fontsize").value()));
-        if (removeAttr) element.remove_attribute("fontsize");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        if (removeAttr) element.remove_attribute("fontstyle");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        if (removeAttr) element.remove_attribute("fontweight");
-        hasAttribute = true;
-    }
-    if (element.attribute("letterspacing")) {
-        this->SetLetterspacing(StrToDbl(element.attribute("letterspacing").value()));
-        if (removeAttr) element.remove_attribute("letterspacing");
-        hasAttribute = true;
-    }
-    if (element.attribute("lineheight")) {
-        this->SetLineheight(StrToStr(element.attribute("lineheight").value()));
-        if (removeAttr) element.remove_attribute("lineheight");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "fontfam")) {
+                    this->SetFontfam(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "fontname")) {
+                    this->SetFontname(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "fontsize")) {
+                    this->SetFontsize(StrToFontsize(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "fontstyle")) {
+                    this->SetFontstyle(StrToFontstyle(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "fontweight")) {
+                    this->SetFontweight(StrToFontweight(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "letterspacing")) {
+                    this->SetLetterspacing(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lineheight")) {
+                    this->SetLineheight(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6879,10 +8099,19 @@ void AttVerticalAlign::ResetVerticalAlign()
 bool AttVerticalAlign::ReadVerticalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("valign")) {
-        this->SetValign(StrToVerticalalignment(element.attribute("valign").value()));
-        if (removeAttr) element.remove_attribute("valign");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "valign")) {
+                    this->SetValign(StrToVerticalalignment(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6919,10 +8148,19 @@ void AttVerticalGroup::ResetVerticalGroup()
 bool AttVerticalGroup::ReadVerticalGroup(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vgrp")) {
-        this->SetVgrp(StrToInt(element.attribute("vgrp").value()));
-        if (removeAttr) element.remove_attribute("vgrp");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "vgrp")) {
+                    this->SetVgrp(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6959,10 +8197,19 @@ void AttVisibility::ResetVisibility()
 bool AttVisibility::ReadVisibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        if (removeAttr) element.remove_attribute("visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "visible")) {
+                    this->SetVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -6999,10 +8246,19 @@ void AttVisualOffsetHo::ResetVisualOffsetHo()
 bool AttVisualOffsetHo::ReadVisualOffsetHo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToMeasurementsigned(element.attribute("ho").value()));
-        if (removeAttr) element.remove_attribute("ho");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'h':
+                if (!std::strcmp(name, "ho")) {
+                    this->SetHo(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7039,10 +8295,19 @@ void AttVisualOffsetTo::ResetVisualOffsetTo()
 bool AttVisualOffsetTo::ReadVisualOffsetTo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        if (removeAttr) element.remove_attribute("to");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 't':
+                if (!std::strcmp(name, "to")) {
+                    this->SetTo(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7079,10 +8344,19 @@ void AttVisualOffsetVo::ResetVisualOffsetVo()
 bool AttVisualOffsetVo::ReadVisualOffsetVo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToMeasurementsigned(element.attribute("vo").value()));
-        if (removeAttr) element.remove_attribute("vo");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "vo")) {
+                    this->SetVo(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7120,15 +8394,26 @@ void AttVisualOffset2Ho::ResetVisualOffset2Ho()
 bool AttVisualOffset2Ho::ReadVisualOffset2Ho(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToMeasurementsigned(element.attribute("startho").value()));
-        if (removeAttr) element.remove_attribute("startho");
-        hasAttribute = true;
-    }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToMeasurementsigned(element.attribute("endho").value()));
-        if (removeAttr) element.remove_attribute("endho");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "endho")) {
+                    this->SetEndho(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "startho")) {
+                    this->SetStartho(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7175,15 +8460,26 @@ void AttVisualOffset2To::ResetVisualOffset2To()
 bool AttVisualOffset2To::ReadVisualOffset2To(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        if (removeAttr) element.remove_attribute("startto");
-        hasAttribute = true;
-    }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        if (removeAttr) element.remove_attribute("endto");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "endto")) {
+                    this->SetEndto(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "startto")) {
+                    this->SetStartto(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7230,15 +8526,26 @@ void AttVisualOffset2Vo::ResetVisualOffset2Vo()
 bool AttVisualOffset2Vo::ReadVisualOffset2Vo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToMeasurementsigned(element.attribute("startvo").value()));
-        if (removeAttr) element.remove_attribute("startvo");
-        hasAttribute = true;
-    }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToMeasurementsigned(element.attribute("endvo").value()));
-        if (removeAttr) element.remove_attribute("endvo");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "endvo")) {
+                    this->SetEndvo(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "startvo")) {
+                    this->SetStartvo(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7284,10 +8591,19 @@ void AttVoltaGroupingSym::ResetVoltaGroupingSym()
 bool AttVoltaGroupingSym::ReadVoltaGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("voltasym")) {
-        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(element.attribute("voltasym").value()));
-        if (removeAttr) element.remove_attribute("voltasym");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "voltasym")) {
+                    this->SetVoltasym(StrToVoltaGroupingSymVoltasym(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7324,10 +8640,19 @@ void AttWhitespace::ResetWhitespace()
 bool AttWhitespace::ReadWhitespace(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        if (removeAttr) element.remove_attribute("xml:space");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'x':
+                if (!std::strcmp(name, "xml:space")) {
+                    this->SetSpace(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7364,10 +8689,19 @@ void AttWidth::ResetWidth()
 bool AttWidth::ReadWidth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToMeasurementunsigned(element.attribute("width").value()));
-        if (removeAttr) element.remove_attribute("width");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'w':
+                if (!std::strcmp(name, "width")) {
+                    this->SetWidth(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7405,15 +8739,26 @@ void AttXy::ResetXy()
 bool AttXy::ReadXy(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        if (removeAttr) element.remove_attribute("x");
-        hasAttribute = true;
-    }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        if (removeAttr) element.remove_attribute("y");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'x':
+                if (!std::strcmp(name, "x")) {
+                    this->SetX(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'y':
+                if (!std::strcmp(name, "y")) {
+                    this->SetY(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -7460,15 +8805,26 @@ void AttXy2::ResetXy2()
 bool AttXy2::ReadXy2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        if (removeAttr) element.remove_attribute("x2");
-        hasAttribute = true;
-    }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        if (removeAttr) element.remove_attribute("y2");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'x':
+                if (!std::strcmp(name, "x2")) {
+                    this->SetX2(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'y':
+                if (!std::strcmp(name, "y2")) {
+                    this->SetY2(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -39,10 +40,19 @@ void AttAnnotVis::ResetAnnotVis()
 bool AttAnnotVis::ReadAnnotVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToPlacement(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToPlacement(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -85,40 +95,51 @@ void AttArpegVis::ResetArpegVis()
 bool AttArpegVis::ReadArpegVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        if (removeAttr) element.remove_attribute("arrow");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.shape")) {
-        this->SetArrowShape(StrToLinestartendsymbol(element.attribute("arrow.shape").value()));
-        if (removeAttr) element.remove_attribute("arrow.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.size")) {
-        this->SetArrowSize(StrToInt(element.attribute("arrow.size").value()));
-        if (removeAttr) element.remove_attribute("arrow.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.color")) {
-        this->SetArrowColor(StrToStr(element.attribute("arrow.color").value()));
-        if (removeAttr) element.remove_attribute("arrow.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.fillcolor")) {
-        this->SetArrowFillcolor(StrToStr(element.attribute("arrow.fillcolor").value()));
-        if (removeAttr) element.remove_attribute("arrow.fillcolor");
-        hasAttribute = true;
-    }
-    if (element.attribute("line.form")) {
-        this->SetLineForm(StrToLineform(element.attribute("line.form").value()));
-        if (removeAttr) element.remove_attribute("line.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("line.width")) {
-        this->SetLineWidth(StrToLinewidth(element.attribute("line.width").value()));
-        if (removeAttr) element.remove_attribute("line.width");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "arrow")) {
+                    this->SetArrow(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "arrow.shape")) {
+                    this->SetArrowShape(StrToLinestartendsymbol(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "arrow.size")) {
+                    this->SetArrowSize(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "arrow.color")) {
+                    this->SetArrowColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "arrow.fillcolor")) {
+                    this->SetArrowFillcolor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "line.form")) {
+                    this->SetLineForm(StrToLineform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "line.width")) {
+                    this->SetLineWidth(StrToLinewidth(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -211,20 +232,33 @@ void AttBarLineVis::ResetBarLineVis()
 bool AttBarLineVis::ReadBarLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("len")) {
-        this->SetLen(StrToDbl(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
-        hasAttribute = true;
-    }
-    if (element.attribute("method")) {
-        this->SetMethod(StrToBarmethod(element.attribute("method").value()));
-        if (removeAttr) element.remove_attribute("method");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToInt(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'l':
+                if (!std::strcmp(name, "len")) {
+                    this->SetLen(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'm':
+                if (!std::strcmp(name, "method")) {
+                    this->SetMethod(StrToBarmethod(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -281,20 +315,29 @@ void AttBeamingVis::ResetBeamingVis()
 bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        if (removeAttr) element.remove_attribute("beam.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        if (removeAttr) element.remove_attribute("beam.rend");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        if (removeAttr) element.remove_attribute("beam.slope");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "beam.color")) {
+                    this->SetBeamColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "beam.rend")) {
+                    this->SetBeamRend(StrToBeamingVisBeamrend(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "beam.slope")) {
+                    this->SetBeamSlope(StrToDbl(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -349,10 +392,19 @@ void AttBeatRptVis::ResetBeatRptVis()
 bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBeatrptRend(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "slash")) {
+                    this->SetSlash(StrToBeatrptRend(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -389,10 +441,19 @@ void AttChordVis::ResetChordVis()
 bool AttChordVis::ReadChordVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        if (removeAttr) element.remove_attribute("cluster");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "cluster")) {
+                    this->SetCluster(StrToCluster(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -430,15 +491,24 @@ void AttCleffingVis::ResetCleffingVis()
 bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        if (removeAttr) element.remove_attribute("clef.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        if (removeAttr) element.remove_attribute("clef.visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "clef.color")) {
+                    this->SetClefColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "clef.visible")) {
+                    this->SetClefVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -485,15 +555,26 @@ void AttEpisemaVis::ResetEpisemaVis()
 bool AttEpisemaVis::ReadEpisemaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToEpisemaVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToEpisemaVisForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToEventrel(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -541,20 +622,31 @@ void AttFTremVis::ResetFTremVis()
 bool AttFTremVis::ReadFTremVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beams")) {
-        this->SetBeams(StrToInt(element.attribute("beams").value()));
-        if (removeAttr) element.remove_attribute("beams");
-        hasAttribute = true;
-    }
-    if (element.attribute("beams.float")) {
-        this->SetBeamsFloat(StrToInt(element.attribute("beams.float").value()));
-        if (removeAttr) element.remove_attribute("beams.float");
-        hasAttribute = true;
-    }
-    if (element.attribute("float.gap")) {
-        this->SetFloatGap(StrToMeasurementunsigned(element.attribute("float.gap").value()));
-        if (removeAttr) element.remove_attribute("float.gap");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "beams")) {
+                    this->SetBeams(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "beams.float")) {
+                    this->SetBeamsFloat(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "float.gap")) {
+                    this->SetFloatGap(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -610,15 +702,26 @@ void AttFermataVis::ResetFermataVis()
 bool AttFermataVis::ReadFermataVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        if (removeAttr) element.remove_attribute("shape");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToFermataVisForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "shape")) {
+                    this->SetShape(StrToFermataVisShape(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -664,10 +767,19 @@ void AttFingGrpVis::ResetFingGrpVis()
 bool AttFingGrpVis::ReadFingGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToFingGrpVisOrient(element.attribute("orient").value()));
-        if (removeAttr) element.remove_attribute("orient");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'o':
+                if (!std::strcmp(name, "orient")) {
+                    this->SetOrient(StrToFingGrpVisOrient(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -707,25 +819,38 @@ void AttHairpinVis::ResetHairpinVis()
 bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToMeasurementunsigned(element.attribute("opening").value()));
-        if (removeAttr) element.remove_attribute("opening");
-        hasAttribute = true;
-    }
-    if (element.attribute("closed")) {
-        this->SetClosed(StrToBoolean(element.attribute("closed").value()));
-        if (removeAttr) element.remove_attribute("closed");
-        hasAttribute = true;
-    }
-    if (element.attribute("opening.vertical")) {
-        this->SetOpeningVertical(StrToBoolean(element.attribute("opening.vertical").value()));
-        if (removeAttr) element.remove_attribute("opening.vertical");
-        hasAttribute = true;
-    }
-    if (element.attribute("angle.optimize")) {
-        this->SetAngleOptimize(StrToBoolean(element.attribute("angle.optimize").value()));
-        if (removeAttr) element.remove_attribute("angle.optimize");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'a':
+                if (!std::strcmp(name, "angle.optimize")) {
+                    this->SetAngleOptimize(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'c':
+                if (!std::strcmp(name, "closed")) {
+                    this->SetClosed(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'o':
+                if (!std::strcmp(name, "opening")) {
+                    this->SetOpening(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "opening.vertical")) {
+                    this->SetOpeningVertical(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -789,10 +914,19 @@ void AttHarmVis::ResetHarmVis()
 bool AttHarmVis::ReadHarmVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        if (removeAttr) element.remove_attribute("rendgrid");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "rendgrid")) {
+                    this->SetRendgrid(StrToHarmVisRendgrid(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -830,15 +964,26 @@ void AttHispanTickVis::ResetHispanTickVis()
 bool AttHispanTickVis::ReadHispanTickVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
-    }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        if (removeAttr) element.remove_attribute("tilt");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToEventrel(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 't':
+                if (!std::strcmp(name, "tilt")) {
+                    this->SetTilt(StrToCompassdirection(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -884,10 +1029,19 @@ void AttKeySigVis::ResetKeySigVis()
 bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig.showchange")) {
-        this->SetSigShowchange(StrToBoolean(element.attribute("sig.showchange").value()));
-        if (removeAttr) element.remove_attribute("sig.showchange");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 's':
+                if (!std::strcmp(name, "sig.showchange")) {
+                    this->SetSigShowchange(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -925,15 +1079,24 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
 bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("keysig.showchange")) {
-        this->SetKeysigShowchange(StrToBoolean(element.attribute("keysig.showchange").value()));
-        if (removeAttr) element.remove_attribute("keysig.showchange");
-        hasAttribute = true;
-    }
-    if (element.attribute("keysig.visible")) {
-        this->SetKeysigVisible(StrToBoolean(element.attribute("keysig.visible").value()));
-        if (removeAttr) element.remove_attribute("keysig.visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'k':
+                if (!std::strcmp(name, "keysig.showchange")) {
+                    this->SetKeysigShowchange(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "keysig.visible")) {
+                    this->SetKeysigVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -979,10 +1142,19 @@ void AttLigatureVis::ResetLigatureVis()
 bool AttLigatureVis::ReadLigatureVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToLigatureform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1024,35 +1196,50 @@ void AttLineVis::ResetLineVis()
 bool AttLineVis::ReadLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToLinewidth(element.attribute("width").value()));
-        if (removeAttr) element.remove_attribute("width");
-        hasAttribute = true;
-    }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        if (removeAttr) element.remove_attribute("endsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("endsym.size")) {
-        this->SetEndsymSize(StrToInt(element.attribute("endsym.size").value()));
-        if (removeAttr) element.remove_attribute("endsym.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        if (removeAttr) element.remove_attribute("startsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("startsym.size")) {
-        this->SetStartsymSize(StrToInt(element.attribute("startsym.size").value()));
-        if (removeAttr) element.remove_attribute("startsym.size");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'e':
+                if (!std::strcmp(name, "endsym")) {
+                    this->SetEndsym(StrToLinestartendsymbol(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "endsym.size")) {
+                    this->SetEndsymSize(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToLineform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "startsym")) {
+                    this->SetStartsym(StrToLinestartendsymbol(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "startsym.size")) {
+                    this->SetStartsymSize(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'w':
+                if (!std::strcmp(name, "width")) {
+                    this->SetWidth(StrToLinewidth(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1135,15 +1322,26 @@ void AttLiquescentVis::ResetLiquescentVis()
 bool AttLiquescentVis::ReadLiquescentVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToLiquescentVisCurve(element.attribute("curve").value()));
-        if (removeAttr) element.remove_attribute("curve");
-        hasAttribute = true;
-    }
-    if (element.attribute("looped")) {
-        this->SetLooped(StrToBoolean(element.attribute("looped").value()));
-        if (removeAttr) element.remove_attribute("looped");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "curve")) {
+                    this->SetCurve(StrToLiquescentVisCurve(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "looped")) {
+                    this->SetLooped(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1192,25 +1390,40 @@ void AttMensurVis::ResetMensurVis()
 bool AttMensurVis::ReadMensurVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        if (removeAttr) element.remove_attribute("dot");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        if (removeAttr) element.remove_attribute("orient");
-        hasAttribute = true;
-    }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        if (removeAttr) element.remove_attribute("sign");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dot")) {
+                    this->SetDot(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToMensurVisForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'o':
+                if (!std::strcmp(name, "orient")) {
+                    this->SetOrient(StrToOrientation(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "sign")) {
+                    this->SetSign(StrToMensurationsign(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1281,45 +1494,54 @@ void AttMensuralVis::ResetMensuralVis()
 bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        if (removeAttr) element.remove_attribute("mensur.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        if (removeAttr) element.remove_attribute("mensur.dot");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        if (removeAttr) element.remove_attribute("mensur.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        if (removeAttr) element.remove_attribute("mensur.loc");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        if (removeAttr) element.remove_attribute("mensur.orient");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        if (removeAttr) element.remove_attribute("mensur.sign");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToFontsize(element.attribute("mensur.size").value()));
-        if (removeAttr) element.remove_attribute("mensur.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        if (removeAttr) element.remove_attribute("mensur.slash");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "mensur.color")) {
+                    this->SetMensurColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.dot")) {
+                    this->SetMensurDot(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.form")) {
+                    this->SetMensurForm(StrToMensuralVisMensurform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.loc")) {
+                    this->SetMensurLoc(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.orient")) {
+                    this->SetMensurOrient(StrToOrientation(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.sign")) {
+                    this->SetMensurSign(StrToMensurationsign(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.size")) {
+                    this->SetMensurSize(StrToFontsize(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "mensur.slash")) {
+                    this->SetMensurSlash(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1419,10 +1641,19 @@ void AttMeterSigVis::ResetMeterSigVis()
 bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToMeterform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1461,20 +1692,29 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
 bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.form")) {
-        this->SetMeterForm(StrToMeterform(element.attribute("meter.form").value()));
-        if (removeAttr) element.remove_attribute("meter.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        if (removeAttr) element.remove_attribute("meter.showchange");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.visible")) {
-        this->SetMeterVisible(StrToBoolean(element.attribute("meter.visible").value()));
-        if (removeAttr) element.remove_attribute("meter.visible");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'm':
+                if (!std::strcmp(name, "meter.form")) {
+                    this->SetMeterForm(StrToMeterform(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "meter.showchange")) {
+                    this->SetMeterShowchange(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "meter.visible")) {
+                    this->SetMeterVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1529,10 +1769,19 @@ void AttMultiRestVis::ResetMultiRestVis()
 bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        if (removeAttr) element.remove_attribute("block");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "block")) {
+                    this->SetBlock(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1569,10 +1818,19 @@ void AttPbVis::ResetPbVis()
 bool AttPbVis::ReadPbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        if (removeAttr) element.remove_attribute("folium");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "folium")) {
+                    this->SetFolium(StrToPbVisFolium(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1609,10 +1867,19 @@ void AttPedalVis::ResetPedalVis()
 bool AttPedalVis::ReadPedalVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalstyle(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToPedalstyle(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1650,15 +1917,26 @@ void AttPlicaVis::ResetPlicaVis()
 bool AttPlicaVis::ReadPlicaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToStemdirectionBasic(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("len")) {
-        this->SetLen(StrToMeasurementunsigned(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dir")) {
+                    this->SetDir(StrToStemdirectionBasic(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "len")) {
+                    this->SetLen(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1704,10 +1982,19 @@ void AttQuilismaVis::ResetQuilismaVis()
 bool AttQuilismaVis::ReadQuilismaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("waves")) {
-        this->SetWaves(StrToInt(element.attribute("waves").value()));
-        if (removeAttr) element.remove_attribute("waves");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'w':
+                if (!std::strcmp(name, "waves")) {
+                    this->SetWaves(StrToInt(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1744,10 +2031,19 @@ void AttSbVis::ResetSbVis()
 bool AttSbVis::ReadSbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToSbVisForm(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1784,10 +2080,19 @@ void AttScoreDefVis::ResetScoreDefVis()
 bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        if (removeAttr) element.remove_attribute("vu.height");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'v':
+                if (!std::strcmp(name, "vu.height")) {
+                    this->SetVuHeight(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1824,10 +2129,19 @@ void AttSectionVis::ResetSectionVis()
 bool AttSectionVis::ReadSectionVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        if (removeAttr) element.remove_attribute("restart");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'r':
+                if (!std::strcmp(name, "restart")) {
+                    this->SetRestart(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1864,10 +2178,19 @@ void AttSignifLetVis::ResetSignifLetVis()
 bool AttSignifLetVis::ReadSignifLetVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'p':
+                if (!std::strcmp(name, "place")) {
+                    this->SetPlace(StrToEventrel(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1904,10 +2227,19 @@ void AttSpaceVis::ResetSpaceVis()
 bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        if (removeAttr) element.remove_attribute("compressable");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'c':
+                if (!std::strcmp(name, "compressable")) {
+                    this->SetCompressable(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -1948,30 +2280,43 @@ void AttStaffDefVis::ResetStaffDefVis()
 bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        if (removeAttr) element.remove_attribute("grid.show");
-        hasAttribute = true;
-    }
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        if (removeAttr) element.remove_attribute("layerscheme");
-        hasAttribute = true;
-    }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        if (removeAttr) element.remove_attribute("lines.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        if (removeAttr) element.remove_attribute("lines.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToMeasurementsigned(element.attribute("spacing").value()));
-        if (removeAttr) element.remove_attribute("spacing");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'g':
+                if (!std::strcmp(name, "grid.show")) {
+                    this->SetGridShow(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "layerscheme")) {
+                    this->SetLayerscheme(StrToLayerscheme(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lines.color")) {
+                    this->SetLinesColor(StrToStr(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "lines.visible")) {
+                    this->SetLinesVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 's':
+                if (!std::strcmp(name, "spacing")) {
+                    this->SetSpacing(StrToMeasurementsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2044,10 +2389,19 @@ void AttStaffGrpVis::ResetStaffGrpVis()
 bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.thru")) {
-        this->SetBarThru(StrToBoolean(element.attribute("bar.thru").value()));
-        if (removeAttr) element.remove_attribute("bar.thru");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "bar.thru")) {
+                    this->SetBarThru(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2089,35 +2443,50 @@ void AttStemVis::ResetStemVis()
 bool AttStemVis::ReadStemVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pos")) {
-        this->SetPos(StrToStemposition(element.attribute("pos").value()));
-        if (removeAttr) element.remove_attribute("pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("len")) {
-        this->SetLen(StrToMeasurementunsigned(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToStemformMensural(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("dir")) {
-        this->SetDir(StrToStemdirection(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("flag.pos")) {
-        this->SetFlagPos(StrToFlagposMensural(element.attribute("flag.pos").value()));
-        if (removeAttr) element.remove_attribute("flag.pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("flag.form")) {
-        this->SetFlagForm(StrToFlagformMensural(element.attribute("flag.form").value()));
-        if (removeAttr) element.remove_attribute("flag.form");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'd':
+                if (!std::strcmp(name, "dir")) {
+                    this->SetDir(StrToStemdirection(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'f':
+                if (!std::strcmp(name, "form")) {
+                    this->SetForm(StrToStemformMensural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "flag.pos")) {
+                    this->SetFlagPos(StrToFlagposMensural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "flag.form")) {
+                    this->SetFlagForm(StrToFlagformMensural(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'l':
+                if (!std::strcmp(name, "len")) {
+                    this->SetLen(StrToMeasurementunsigned(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'p':
+                if (!std::strcmp(name, "pos")) {
+                    this->SetPos(StrToStemposition(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
@@ -2202,25 +2571,38 @@ void AttTupletVis::ResetTupletVis()
 bool AttTupletVis::ReadTupletVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToStaffrelBasic(element.attribute("bracket.place").value()));
-        if (removeAttr) element.remove_attribute("bracket.place");
-        hasAttribute = true;
-    }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        if (removeAttr) element.remove_attribute("bracket.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        if (removeAttr) element.remove_attribute("dur.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        if (removeAttr) element.remove_attribute("num.format");
-        hasAttribute = true;
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {
+            case 'b':
+                if (!std::strcmp(name, "bracket.place")) {
+                    this->SetBracketPlace(StrToStaffrelBasic(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                else if (!std::strcmp(name, "bracket.visible")) {
+                    this->SetBracketVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'd':
+                if (!std::strcmp(name, "dur.visible")) {
+                    this->SetDurVisible(StrToBoolean(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            case 'n':
+                if (!std::strcmp(name, "num.format")) {
+                    this->SetNumFormat(StrToTupletVisNumformat(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }
+                break;
+            default: break;
+        }
     }
     return hasAttribute;
 }
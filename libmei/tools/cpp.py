@@ -128,6 +128,7 @@ ATTCLASS_FILE_CPP = """{license}
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -155,7 +156,14 @@ void Att{attGroupNameUpper}::Reset{attGroupNameUpper}()
 bool Att{attGroupNameUpper}::Read{attGroupNameUpper}(pugi::xml_node element, bool removeAttr)
 {{
     bool hasAttribute = false;
-    {reads}
+    for (pugi::xml_attribute attr = element.first_attribute(), next; attr; attr = next) {{
+        next = attr.next_attribute();
+        const char *name = attr.name();
+        switch (name[0]) {{
+            {reads}
+            default: break;
+        }}
+    }}
     return hasAttribute;
 }}
 
@@ -171,11 +179,17 @@ bool Att{attGroupNameUpper}::Write{attGroupNameUpper}(pugi::xml_node element)
 
 ATTCLASS_MEMBERS_DEFAULT_CPP = """m_{attNameLowerJoined} = {attDefault};"""
 
-ATTCLASS_READ_CPP = """if (element.attribute("{attNameLower}")) {{
-        this->Set{attNameUpper}({converterRead}(element.attribute("{attNameLower}").value()));
-        if (removeAttr) element.remove_attribute("{attNameLower}");
-        hasAttribute = true;
-    }}"""
+# The attributes of a class are dispatched with a switch on their first character
+# so that reading the class walks the attributes of the node only once
+ATTCLASS_READ_CASE_CPP = """case '{attNameFirstChar}':
+                {reads}
+                break;"""
+
+ATTCLASS_READ_CPP = """if (!std::strcmp(name, "{attNameLower}")) {{
+                    this->Set{attNameUpper}({converterRead}(attr.value()));
+                    if (removeAttr) element.remove_attribute(attr);
+                    hasAttribute = true;
+                }}"""
 
 ATTCLASS_WRITE_CPP = """if (this->Has{attNameUpper}()) {{
         element.append_attribute("{attNameLower}") = {converterWrite}(this->Get{attNameUpper}()).c_str();
@@ -754,7 +768,7 @@ def create_att_classes(cpp_ns: str, schema, outdir: Path):
             members: list = []
             methods: list = []
             defaults: list = []
-            reads: list = []
+            reads: dict = {}
             writes: list = []
             checkers: list = []
 
@@ -794,11 +808,10 @@ def create_att_classes(cpp_ns: str, schema, outdir: Path):
 
                 if len(defaults) > 0:
                     defaults.append("\n    ")
-                    reads.append("\n    ")
                     writes.append("\n    ")
 
                 defaults.append(ATTCLASS_MEMBERS_DEFAULT_CPP.format_map(substrings))
-                reads.append(ATTCLASS_READ_CPP.format_map(substrings))
+                reads.setdefault(att_lower_name[0], []).append(ATTCLASS_READ_CPP.format_map(substrings))
                 writes.append(ATTCLASS_WRITE_CPP.format_map(substrings))
 
                 if vrv_is_alternate_type(att_type):
@@ -811,7 +824,9 @@ def create_att_classes(cpp_ns: str, schema, outdir: Path):
                 "methods": "".join(methods),
                 "members": "".join(members),
                 "defaults": "".join(defaults),
-                "reads": "".join(reads),
+                "reads": "\n            ".join(
+                    ATTCLASS_READ_CASE_CPP.format(attNameFirstChar=first, reads="\n                else ".join(cases))
+                    for first, cases in sorted(reads.items())),
                 "writes": "".join(writes),
                 "checkers": "".join(checkers),
 
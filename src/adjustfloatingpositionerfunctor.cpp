@@ -37,9 +37,11 @@ FunctorCode AdjustFloatingPositionersFunctor::VisitStaffAlignment(StaffAlignment
     const bool verseCollapse = m_doc->GetOptions()->m_lyricVerseCollapse.GetValue();
     if (m_classId == SYL) {
         if (staffAlignment->GetVerseCount(verseCollapse) > 0) {
-            FontInfo *lyricFont = m_doc->GetDrawingLyricFont(staffAlignment->GetStaff()->m_drawingStaffSize);
-            int descender = m_doc->GetTextGlyphDescender(L'q', lyricFont, false);
-            int height = m_doc->GetTextGlyphHeight(L'I', lyricFont, false);
+            // Use a local font since systems can be processed concurrently
+            FontInfo lyricFont;
+            lyricFont.SetPointSize(m_doc->GetDrawingLyricFontSize(staffAlignment->GetStaff()->m_drawingStaffSize));
+            int descender = m_doc->GetTextGlyphDescender(L'q', &lyricFont, false);
+            int height = m_doc->GetTextGlyphHeight(L'I', &lyricFont, false);
             int margin = m_doc->GetBottomMargin(SYL) * drawingUnit;
             int minMargin = std::max((int)(m_doc->GetOptions()->m_lyricTopMinMargin.GetValue() * drawingUnit),
                 staffAlignment->GetOverflowBelow());
@@ -861,6 +861,62 @@ int BoundingBox::CalcBezierAtPosition(const Point bezier[4], int x)
     return p.y;
 }
 
+std::vector<int> BoundingBox::CalcBezierAtPositions(const Point bezier[4], const std::vector<int> &positions)
+{
+    const int count = (int)positions.size();
+    std::vector<int> values(count);
+
+    // Without a strictly increasing x(t) there can be several parameters for a position, or a vanishing derivative at
+    // the endpoints
+    if ((bezier[0].x >= bezier[3].x) || (bezier[0].x >= bezier[1].x) || (bezier[1].x > bezier[2].x)
+        || (bezier[2].x >= bezier[3].x)) {
+        for (int i = 0; i < count; ++i) values[i] = BoundingBox::CalcBezierAtPosition(bezier, positions[i]);
+        return values;
+    }
+
+    // Coefficients of x(t) = ((a * t + b) * t + c) * t + d
+    const double a = -bezier[0].x + 3.0 * bezier[1].x - 3.0 * bezier[2].x + bezier[3].x;
+    const double b = 3.0 * bezier[0].x - 6.0 * bezier[1].x + 3.0 * bezier[2].x;
+    const double c = -3.0 * bezier[0].x + 3.0 * bezier[1].x;
+    const double d = bezier[0].x;
+
+    // Sample x(t) at regular intervals
+    double table[BEZIER_TABLE_SIZE + 1];
+    for (int k = 0; k <= BEZIER_TABLE_SIZE; ++k) {
+        const double t = double(k) / BEZIER_TABLE_SIZE;
+        table[k] = ((a * t + b) * t + c) * t + d;
+    }
+    table[0] = bezier[0].x;
+    table[BEZIER_TABLE_SIZE] = bezier[3].x;
+
+    for (int i = 0; i < count; ++i) {
+        const double x = positions[i];
+        // Find the interval with a fixed number of comparisons
+        int k = 0;
+        for (int j = 1; j < BEZIER_TABLE_SIZE; ++j) {
+            k += (table[j] <= x);
+        }
+        const double t0 = double(k) / BEZIER_TABLE_SIZE;
+        const double t1 = double(k + 1) / BEZIER_TABLE_SIZE;
+        // Interpolate within the interval and refine with Newton iterations
+        double t = t0 + (x - table[k]) / (table[k + 1] - table[k]) * (t1 - t0);
+        t = std::min(std::max(t, t0), t1);
+        for (int n = 0; n < 4; ++n) {
+            const double f = ((a * t + b) * t + c) * t + d - x;
+            const double df = (3.0 * a * t + 2.0 * b) * t + c;
+            t -= f / std::max(df, 1e-9);
+            t = std::min(std::max(t, t0), t1);
+        }
+        // Positions outside of the curve get the start point, as in CalcBezierParamAtPosition
+        t = ((x < table[0]) || (x > table[BEZIER_TABLE_SIZE])) ? 0.0 : t;
+        const double mt = 1.0 - t;
+        values[i] = mt * mt * mt * bezier[0].y + 3.0 * t * mt * mt * bezier[1].y + 3.0 * mt * t * t * bezier[2].y
+            + t * t * t * bezier[3].y;
+    }
+
+    return values;
+}
+
 void BoundingBox::CalcLinearInterpolation(Point &dest, const Point &a, const Point &b, double t)
 {
     dest.x = a.x + (b.x - a.x) * t;
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <math.h>
 
 //----------------------------------------------------------------------------
@@ -241,8 +242,17 @@ void DeviceContext::GetTextExtent(const std::u32string &string, TextExtend *exte
     const Resources *resources = this->GetResources();
     assert(resources);
 
-    extend->m_width = 0;
-    extend->m_height = 0;
+    const int pointSize = m_fontStack.top()->GetPointSize();
+    TextExtend cached;
+    if (resources->GetCachedTextExtent(string, pointSize, false, typeSize, cached)) {
+        this->MergeTextExtend(cached, extend);
+        return;
+    }
+
+    // Calculate the extent from scratch and merge it once cached
+    TextExtend *target = extend;
+    extend = &cached;
+    this->InitTextExtend(extend);
 
     if (typeSize) {
         AddGlyphToTextExtend(resources->GetTextGlyph(L'p'), extend);
@@ -270,6 +280,9 @@ void DeviceContext::GetTextExtent(const std::u32string &string, TextExtend *exte
         }
         AddGlyphToTextExtend(glyph, extend);
     }
+
+    resources->SetCachedTextExtent(string, pointSize, false, typeSize, cached);
+    this->MergeTextExtend(cached, target);
 }
 
 void DeviceContext::GetSmuflTextExtent(const std::u32string &string, TextExtend *extend)
@@ -280,16 +293,46 @@ void DeviceContext::GetSmuflTextExtent(const std::u32string &string, TextExtend
     const Resources *resources = this->GetResources();
     assert(resources);
 
-    extend->m_width = 0;
-    extend->m_height = 0;
+    const int pointSize = m_fontStack.top()->GetPointSize();
+    TextExtend cached;
+    if (resources->GetCachedTextExtent(string, pointSize, true, false, cached)) {
+        this->MergeTextExtend(cached, extend);
+        return;
+    }
+
+    this->InitTextExtend(&cached);
 
     for (char32_t c : string) {
         const Glyph *glyph = resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
-        AddGlyphToTextExtend(glyph, extend);
+        AddGlyphToTextExtend(glyph, &cached);
     }
+
+    resources->SetCachedTextExtent(string, pointSize, true, false, cached);
+    this->MergeTextExtend(cached, extend);
+}
+
+void DeviceContext::InitTextExtend(TextExtend *extend) const
+{
+    assert(extend);
+
+    extend->m_width = 0;
+    extend->m_height = 0;
+    // Ascent and descent are merged with the values already in the extent passed by the caller
+    extend->m_ascent = std::numeric_limits<int>::min();
+    extend->m_descent = std::numeric_limits<int>::min();
+}
+
+void DeviceContext::MergeTextExtend(const TextExtend &cached, TextExtend *extend) const
+{
+    assert(extend);
+
+    extend->m_width = cached.m_width;
+    extend->m_height = cached.m_height;
+    extend->m_ascent = std::max(cached.m_ascent, extend->m_ascent);
+    extend->m_descent = std::max(cached.m_descent, extend->m_descent);
 }
 
 void DeviceContext::AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend)
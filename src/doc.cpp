@@ -9,8 +9,13 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <list>
 #include <math.h>
+#include <tuple>
+#include <utility>
 
 //----------------------------------------------------------------------------
 
@@ -51,6 +56,7 @@
 #include "pghead.h"
 #include "pghead2.h"
 #include "preparedatafunctor.h"
+#include "profiler.h"
 #include "resetfunctor.h"
 #include "runningelement.h"
 #include "score.h"
@@ -65,6 +71,7 @@
 #include "system.h"
 #include "tempo.h"
 #include "text.h"
+#include "threadpool.h"
 #include "timemap.h"
 #include "timestamp.h"
 #include "transposefunctor.h"
@@ -80,6 +87,12 @@
 
 namespace vrv {
 
+// The range of the SMuFL code points (private use area) with scaled glyph metrics
+static const char32_t GLYPH_METRICS_FIRST_CODE = 0xE000;
+static const char32_t GLYPH_METRICS_LAST_CODE = 0xF8FF;
+// The largest staff size with scaled glyph metrics
+static const int GLYPH_METRICS_MAX_STAFF_SIZE = 400;
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -91,6 +104,9 @@ Doc::Doc() : Object(DOC, "doc-")
     // owned pointers need to be set to NULL;
     m_selectionPreceding = NULL;
     m_selectionFollowing = NULL;
+    m_threadPool = NULL;
+
+    m_scaledGlyphMetrics = std::vector<std::atomic<ScaledGlyphMetricTable *>>(2 * (GLYPH_METRICS_MAX_STAFF_SIZE + 1));
 
     this->Reset();
 }
@@ -98,8 +114,10 @@ Doc::Doc() : Object(DOC, "doc-")
 Doc::~Doc()
 {
     this->ClearSelectionPages();
+    this->ResetScaledGlyphMetrics(false);
 
     delete m_options;
+    delete m_threadPool;
 }
 
 void Doc::Reset()
@@ -130,6 +148,10 @@ void Doc::Reset()
     m_currentScore = NULL;
     m_currentScoreDefDone = false;
     m_dataPreparationDone = false;
+    m_changedMeasures.clear();
+    m_fullPreparationNeeded = false;
+    m_dependencyMeasures.clear();
+    m_dependencyRanges.clear();
     m_timemapTempo = 0.0;
     m_markup = MARKUP_DEFAULT;
     m_isMensuralMusicOnly = false;
@@ -354,7 +376,7 @@ void Doc::CalculateTimemap()
     InitMaxMeasureDurationFunctor initMaxMeasureDuration;
     initMaxMeasureDuration.SetCurrentTempo(tempo);
     initMaxMeasureDuration.SetTempoAdjustment(m_options->m_midiTempoAdjustment.GetValue());
-    this->Process(initMaxMeasureDuration);
+    this->ProcessInExpansionOrder(initMaxMeasureDuration);
 
     // Then calculate the onset and offset times (w.r.t. the measure) for every note
     InitOnsetOffsetFunctor initOnsetOffset;
@@ -370,6 +392,7 @@ void Doc::CalculateTimemap()
 
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
 {
+    ProfilerScope profilerScope(PROFILER_IO, "ExportMIDI");
 
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
@@ -405,17 +428,68 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
     // The tree is used to process each staff/layer/verse separately
     // For this, we use a array of AttNIntegerComparison that looks for each object if it is of the type
     // and with @n specified
+    // The layer index of InitProcessingListsFunctor is not used since GenerateMIDIFunctor also visits the measures,
+    // the scoreDefs and the pedals outside of the layers
 
     IntTree_t::const_iterator staves;
     IntTree_t::const_iterator layers;
 
+    // Generate the events of a layer of a staff into a MIDI file
+    auto generateLayerMIDI = [this, tempo, &initMIDI](smf::MidiFile *layerMidiFile, int staffN, int layerN,
+                                 int midiChannel, int midiTrack, int transSemi) {
+        Filters filters;
+        // Create ad comparison object for each type / @n
+        AttNIntegerComparison matchStaff(STAFF, staffN);
+        AttNIntegerComparison matchLayer(LAYER, layerN);
+        filters.Add(&matchStaff);
+        filters.Add(&matchLayer);
+
+        GenerateMIDIFunctor generateMIDI(layerMidiFile);
+        generateMIDI.PushFilters(&filters);
+
+        generateMIDI.SetChannel(midiChannel);
+        generateMIDI.SetTrack(midiTrack);
+        generateMIDI.SetStaffN(staffN);
+        generateMIDI.SetTransSemi(transSemi);
+        generateMIDI.SetCurrentTempo(tempo);
+        generateMIDI.SetDeferredNotes(initMIDI.GetDeferredNotes());
+        generateMIDI.SetCueExclusion(this->GetOptions()->m_midiNoCue.GetValue());
+
+        // LogDebug("Exporting track %d ----------------", midiTrack);
+        this->ProcessInExpansionOrder(generateMIDI);
+    };
+
+    // With a thread pool, the events of each staff setup and of each layer are generated into their own buffer.
+    // The layers are generated concurrently and the buffers are then merged in the order of the serial generation,
+    // which gives the same event lists as generating everything in the MIDI file directly.
+    ThreadPool *threadPool = (initMIDI.HasIndependentTracks()) ? this->GetThreadPool() : NULL;
+    // The buffers with the MIDI track of their events - a list for them not to be moved when adding new ones
+    std::list<std::pair<smf::MidiFile, int>> buffers;
+    // A buffer has only two tracks, with the events of the MIDI track in track 1 (unless it is track 0)
+    auto getBufferTrack = [](int track) { return (track > 0) ? 1 : 0; };
+    auto addBuffer = [midiFile, &buffers]() {
+        smf::MidiFile &buffer = buffers.emplace_back().first;
+        buffer.setTPQ(midiFile->getTPQ());
+        buffer.absoluteTicks();
+        buffer.addTracks(1);
+        return &buffer;
+    };
+    // The layers to be generated in the buffers with [staff, layer, channel, track, transSemi]
+    std::vector<std::tuple<int, int, int, int, int>> layerStreams;
+    std::vector<smf::MidiFile *> layerBuffers;
+
     // Process notes and chords, rests, spaces layer by layer
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiChannel = 0;
     int midiTrack = 1;
-    Filters filters;
     for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
 
+        smf::MidiFile *staffMidiFile = (threadPool) ? addBuffer() : midiFile;
+        // The track of the MIDI file or of the buffer where the staff events are added
+        auto getStaffTrack = [threadPool, &getBufferTrack](int track) {
+            return (threadPool) ? getBufferTrack(track) : track;
+        };
+
         ScoreDef *currentScoreDef = this->GetCurrentScoreDef();
         int transSemi = 0;
         if (StaffDef *staffDef = currentScoreDef->GetStaffDef(staves->first)) {
@@ -444,7 +518,8 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
                     }
                 }
                 if (instrdef->HasMidiInstrnum()) {
-                    midiFile->addPatchChange(midiTrack, 0, midiChannel, instrdef->GetMidiInstrnum());
+                    staffMidiFile->addPatchChange(
+                        getStaffTrack(midiTrack), 0, midiChannel, instrdef->GetMidiInstrnum());
                 }
             }
             // set MIDI track name
@@ -456,7 +531,7 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
             }
             if (label) {
                 std::string trackName = UTF32to8(label->GetText(label)).c_str();
-                if (!trackName.empty()) midiFile->addTrackName(midiTrack, 0, trackName);
+                if (!trackName.empty()) staffMidiFile->addTrackName(getStaffTrack(midiTrack), 0, trackName);
             }
             // set MIDI key signature
             KeySig *keySig = vrv_cast<KeySig *>(staffDef->FindDescendantByType(KEYSIG));
@@ -464,7 +539,8 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
                 keySig = vrv_cast<KeySig *>(currentScoreDef->GetKeySig());
             }
             if (keySig && keySig->HasSig()) {
-                midiFile->addKeySignature(midiTrack, 0, keySig->GetFifthsInt(), (keySig->GetMode() == MODE_minor));
+                staffMidiFile->addKeySignature(
+                    getStaffTrack(midiTrack), 0, keySig->GetFifthsInt(), (keySig->GetMode() == MODE_minor));
             }
             // set MIDI time signature
             MeterSig *meterSig = vrv_cast<MeterSig *>(staffDef->FindDescendantByType(METERSIG));
@@ -472,43 +548,123 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
                 meterSig = vrv_cast<MeterSig *>(currentScoreDef->GetMeterSig());
             }
             if (meterSig && meterSig->HasCount() && meterSig->HasUnit()) {
-                midiFile->addTimeSignature(midiTrack, 0, meterSig->GetTotalCount(), meterSig->GetUnit());
+                staffMidiFile->addTimeSignature(
+                    getStaffTrack(midiTrack), 0, meterSig->GetTotalCount(), meterSig->GetUnit());
             }
         }
+        if (threadPool) buffers.back().second = midiTrack;
 
         // Set initial scoreDef values for tuning
-        GenerateMIDIFunctor generateScoreDefMIDI(midiFile);
+        GenerateMIDIFunctor generateScoreDefMIDI(staffMidiFile);
         generateScoreDefMIDI.SetChannel(midiChannel);
-        generateScoreDefMIDI.SetTrack(midiTrack);
+        generateScoreDefMIDI.SetTrack(getStaffTrack(midiTrack));
         currentScoreDef->Process(generateScoreDefMIDI);
 
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.Add(&matchStaff);
-            filters.Add(&matchLayer);
+            if (threadPool) {
+                layerStreams.push_back({ staves->first, layers->first, midiChannel, midiTrack, transSemi });
+                layerBuffers.push_back(addBuffer());
+                buffers.back().second = midiTrack;
+            }
+            else {
+                generateLayerMIDI(midiFile, staves->first, layers->first, midiChannel, midiTrack, transSemi);
+            }
+        }
+    }
 
-            GenerateMIDIFunctor generateMIDI(midiFile);
-            generateMIDI.PushFilters(&filters);
+    if (!threadPool) return;
 
-            generateMIDI.SetChannel(midiChannel);
-            generateMIDI.SetTrack(midiTrack);
-            generateMIDI.SetStaffN(staves->first);
-            generateMIDI.SetTransSemi(transSemi);
-            generateMIDI.SetCurrentTempo(tempo);
-            generateMIDI.SetDeferredNotes(initMIDI.GetDeferredNotes());
-            generateMIDI.SetCueExclusion(this->GetOptions()->m_midiNoCue.GetValue());
+    threadPool->Run((int)layerStreams.size(), [&](int i) {
+        const auto [staffN, layerN, channel, track, transSemi] = layerStreams.at(i);
+        generateLayerMIDI(layerBuffers.at(i), staffN, layerN, channel, getBufferTrack(track), transSemi);
+    });
 
-            // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(generateMIDI);
+    // Move the events of the buffers to the MIDI file
+    for (auto &[buffer, track] : buffers) {
+        for (int bufferTrack = 0; bufferTrack <= getBufferTrack(track); ++bufferTrack) {
+            const int fileTrack = (bufferTrack == 0) ? 0 : track;
+            smf::MidiEventList &events = buffer[bufferTrack];
+            for (int i = 0; i < events.getEventCount(); ++i) {
+                events[i].track = fileTrack;
+                (*midiFile)[fileTrack].push_back_no_copy(&events[i]);
+            }
+            events.detach();
         }
     }
 }
 
+void Doc::ExportMIDI(std::vector<unsigned char> &midiData)
+{
+    smf::MidiFile midiFile;
+    midiFile.absoluteTicks();
+    this->ExportMIDI(&midiFile);
+    midiFile.sortTracks();
+
+    ProfilerScope profilerScope(PROFILER_IO, "WriteMIDI");
+
+    // Encode the Standard MIDI File directly from the absolute ticks. This gives the same bytes as
+    // smf::MidiFile::write but without converting all the events to delta ticks and back.
+    auto writeValue = [&midiData](unsigned long value, int byteCount) {
+        for (int i = byteCount - 1; i >= 0; --i) midiData.push_back((value >> (8 * i)) & 0xff);
+    };
+    auto writeVLValue = [&midiData](long value) {
+        // Same clipping as in smf::MidiFile (including for negative values)
+        if ((unsigned long)value >= (1 << 28)) value = 0x0FFFffff;
+        int shift = 21;
+        while ((shift > 0) && !(((unsigned long)value >> shift) & 0x7f)) shift -= 7;
+        for (; shift > 0; shift -= 7) midiData.push_back((((unsigned long)value >> shift) & 0x7f) | 0x80);
+        midiData.push_back((unsigned long)value & 0x7f);
+    };
+
+    const int trackCount = midiFile.getTrackCount();
+    midiData.clear();
+    midiData.insert(midiData.end(), { 'M', 'T', 'h', 'd' });
+    writeValue(6, 4);
+    writeValue((trackCount == 1) ? 0 : 1, 2);
+    writeValue(trackCount, 2);
+    writeValue(midiFile.getTicksPerQuarterNote(), 2);
+
+    for (int track = 0; track < trackCount; ++track) {
+        midiData.insert(midiData.end(), { 'M', 'T', 'r', 'k' });
+        // The size is written once the track is encoded
+        const size_t sizePosition = midiData.size();
+        writeValue(0, 4);
+        const size_t start = midiData.size();
+
+        const smf::MidiEventList &events = midiFile[track];
+        int previousTick = 0;
+        for (int i = 0; i < events.getEventCount(); ++i) {
+            const smf::MidiEvent &event = events[i];
+            // The delta is calculated from the previous event, even if it is not written
+            const int delta = (i == 0) ? event.tick : event.tick - previousTick;
+            previousTick = event.tick;
+            // Empty events and end-of-track messages are not written (one is added at the end)
+            if (event.empty() || event.isEndOfTrack()) continue;
+            writeVLValue(delta);
+            if ((event.getCommandByte() == 0xf0) || (event.getCommandByte() == 0xf7)) {
+                // Sysex messages with the length of the remaining bytes
+                midiData.push_back(event[0]);
+                writeVLValue((int)event.size() - 1);
+                midiData.insert(midiData.end(), event.begin() + 1, event.end());
+            }
+            else {
+                midiData.insert(midiData.end(), event.begin(), event.end());
+            }
+        }
+        const size_t end = midiData.size();
+        if ((end - start < 3) || (midiData.at(end - 3) != 0xff) || (midiData.at(end - 2) != 0x2f)) {
+            midiData.insert(midiData.end(), { 0x00, 0xff, 0x2f, 0x00 });
+        }
+
+        const unsigned long trackSize = midiData.size() - start;
+        for (int i = 0; i < 4; ++i) midiData.at(sizePosition + i) = (trackSize >> (8 * (3 - i))) & 0xff;
+    }
+}
+
 bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeasures)
 {
+    ProfilerScope profilerScope(PROFILER_IO, "ExportTimemap");
+
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
         CalculateTimemap();
@@ -521,7 +677,8 @@ bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeas
     Timemap timemap;
     GenerateTimemapFunctor generateTimemap(&timemap);
     generateTimemap.SetCueExclusion(this->GetOptions()->m_midiNoCue.GetValue());
-    this->Process(generateTimemap);
+    generateTimemap.SetExpansionMap(&m_expansionMap);
+    this->ProcessInExpansionOrder(generateTimemap);
 
     timemap.ToJson(output, includeRests, includeMeasures);
 
@@ -559,13 +716,27 @@ bool Doc::ExportFeatures(std::string &output, const std::string &options)
 
 void Doc::PrepareData()
 {
+    this->PrepareData(NULL);
+}
+
+void Doc::PrepareData(Comparison *measureComparison)
+{
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "PrepareData");
+
+    // The content of the measures not matching the comparison is skipped by the functors processing the document,
+    // apart from the ones that are needed for the entire document
+    Filters measureFilters;
+    if (measureComparison) measureFilters.Add(measureComparison);
+
     /************ Reset and initialization ************/
 
     if (m_dataPreparationDone) {
         ResetDataFunctor resetData;
+        resetData.PushFilters(&measureFilters);
         this->Process(resetData);
     }
     PrepareDataInitializationFunctor prepareDataInitialization(this);
+    prepareDataInitialization.PushFilters(&measureFilters);
     this->Process(prepareDataInitialization);
 
     /************ Generate measure indices ************/
@@ -575,12 +746,14 @@ void Doc::PrepareData()
     /************ Store default durations ************/
 
     PrepareDurationFunctor prepareDuration;
+    prepareDuration.PushFilters(&measureFilters);
     this->Process(prepareDuration);
 
     /************ Resolve @startid / @endid ************/
 
     // Try to match all spanning elements (slur, tie, etc) by processing backwards
     PrepareTimeSpanningFunctor prepareTimeSpanning;
+    prepareTimeSpanning.PushFilters(&measureFilters);
     prepareTimeSpanning.PushDirection(BACKWARD);
     this->Process(prepareTimeSpanning);
     prepareTimeSpanning.PopDirection();
@@ -610,10 +783,12 @@ void Doc::PrepareData()
     // Resolve <reh> elements first, since they can be encoded without @startid or @tstamp, but we need one internally
     // for placement
     PrepareRehPositionFunctor prepareRehPosition;
+    prepareRehPosition.PushFilters(&measureFilters);
     this->Process(prepareRehPosition);
 
     // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
     PrepareTimePointingFunctor prepareTimePointing;
+    prepareTimePointing.PushFilters(&measureFilters);
     prepareTimePointing.PushDirection(BACKWARD);
     this->Process(prepareTimePointing);
 
@@ -621,6 +796,7 @@ void Doc::PrepareData()
 
     // Now try to match the @tstamp and @tstamp2 attributes.
     PrepareTimestampsFunctor prepareTimestamps;
+    prepareTimestamps.PushFilters(&measureFilters);
     this->Process(prepareTimestamps);
 
     // If some are still there, then it is probably an issue in the encoding
@@ -633,6 +809,7 @@ void Doc::PrepareData()
 
     // Try to match all pointing elements using @next, @sameas and @stem.sameas
     PrepareLinkingFunctor prepareLinking;
+    prepareLinking.PushFilters(&measureFilters);
     this->Process(prepareLinking);
     prepareLinking.SetDataCollectionCompleted();
 
@@ -659,6 +836,7 @@ void Doc::PrepareData()
 
     // Try to match all pointing elements using @plist
     PreparePlistFunctor preparePlist;
+    preparePlist.PushFilters(&measureFilters);
     this->Process(preparePlist);
     preparePlist.SetDataCollectionCompleted();
 
@@ -676,11 +854,13 @@ void Doc::PrepareData()
 
     // Prepare the cross-staff pointers
     PrepareCrossStaffFunctor prepareCrossStaff;
+    prepareCrossStaff.PushFilters(&measureFilters);
     this->Process(prepareCrossStaff);
 
     /************ Resolve beamspan elements ***********/
 
     PrepareBeamSpanElementsFunctor prepareBeamSpanElements;
+    prepareBeamSpanElements.PushFilters(&measureFilters);
     this->Process(prepareBeamSpanElements);
 
     /************ Prepare processing by staff/layer/verse ************/
@@ -688,6 +868,7 @@ void Doc::PrepareData()
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
     InitProcessingListsFunctor initProcessingLists;
+    initProcessingLists.PushFilters(&measureFilters);
 
     // We first fill a tree of ints with [staff/layer] and [staff/layer/verse] numbers (@n) to be processed
     // LogElapsedTimeStart();
@@ -696,8 +877,9 @@ void Doc::PrepareData()
     const IntTree &verseTree = initProcessingLists.GetVerseTree();
 
     // The tree is used to process each staff/layer/verse separately
-    // For this, we use an array of AttNIntegerComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The functors below only visit the content of the layers, so instead of processing the whole document with
+    // filters for each staff/layer/verse we process the layers of each staff/layer directly in document order.
+    // Verses are still selected with an AttNIntegerComparison since the other ones have to be skipped
 
     IntTree_t::const_iterator staves;
     IntTree_t::const_iterator layers;
@@ -705,41 +887,29 @@ void Doc::PrepareData()
 
     /************ Resolve some pointers by layer ************/
 
-    Filters filters;
     for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.Add(&matchStaff);
-            filters.Add(&matchLayer);
-
             PreparePointersByLayerFunctor preparePointersByLayer;
-            preparePointersByLayer.PushFilters(&filters);
-            this->Process(preparePointersByLayer);
+            for (Layer *layer : initProcessingLists.GetLayers(staves->first, layers->first)) {
+                layer->Process(preparePointersByLayer);
+            }
         }
     }
 
     /************ Resolve delayed turns ************/
 
     PrepareDelayedTurnsFunctor prepareDelayedTurns;
+    prepareDelayedTurns.PushFilters(&measureFilters);
     this->Process(prepareDelayedTurns);
     prepareDelayedTurns.SetDataCollectionCompleted();
 
     if (!prepareDelayedTurns.GetDelayedTurns().empty()) {
-        prepareDelayedTurns.PushFilters(&filters);
         for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
             for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
-                AttNIntegerComparison matchLayer(LAYER, layers->first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
-
                 prepareDelayedTurns.ResetCurrent();
-                this->Process(prepareDelayedTurns);
+                for (Layer *layer : initProcessingLists.GetLayers(staves->first, layers->first)) {
+                    layer->Process(prepareDelayedTurns);
+                }
             }
         }
     }
@@ -747,24 +917,22 @@ void Doc::PrepareData()
     /************ Resolve lyric connectors ************/
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    Filters filters;
     for (staves = verseTree.child.begin(); staves != verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
-                // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
-                AttNIntegerComparison matchLayer(LAYER, layers->first);
                 AttNIntegerComparison matchVerse(VERSE, verses->first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
-                filters.Add(&matchVerse);
+                filters = { &matchVerse };
 
                 // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
                 // m_drawingLastNote is set only if the syl has a forward connector
                 PrepareLyricsFunctor prepareLyrics;
                 prepareLyrics.PushFilters(&filters);
-                this->Process(prepareLyrics);
+                for (Layer *layer : initProcessingLists.GetLayers(staves->first, layers->first)) {
+                    layer->Process(prepareLyrics);
+                }
+                // The end of the document closes the last syl of the verse
+                this->AcceptEnd(prepareLyrics);
             }
         }
     }
@@ -775,6 +943,7 @@ void Doc::PrepareData()
     // TimeSpanningInterface to each staff they are extended. This does not need to be done staff by staff because we
     // can just check the staff->GetN to see where we are (see PrepareStaffCurrentTimeSpanningFunctor::VisitStaff)
     PrepareStaffCurrentTimeSpanningFunctor prepareStaffCurrentTimeSpanning;
+    prepareStaffCurrentTimeSpanning.PushFilters(&measureFilters);
     this->Process(prepareStaffCurrentTimeSpanning);
 
     // Something must be wrong in the encoding because a TimeSpanningInterface was left open
@@ -786,6 +955,8 @@ void Doc::PrepareData()
     /************ Resolve mRpt ************/
 
     // Process by staff for matching mRpt elements and setting the drawing number
+    // This is a filtered traversal of the whole tree and not of the layer index because PrepareRptFunctor visits the
+    // staves for the multiNumber of their staffDef
     for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             filters.Clear();
@@ -794,6 +965,7 @@ void Doc::PrepareData()
             AttNIntegerComparison matchLayer(LAYER, layers->first);
             filters.Add(&matchStaff);
             filters.Add(&matchLayer);
+            if (measureComparison) filters.Add(measureComparison);
 
             // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
             PrepareRptFunctor prepareRpt(this);
@@ -810,7 +982,9 @@ void Doc::PrepareData()
 
     /************ Resolve floating groups for vertical alignment ************/
 
-    // Prepare the floating drawing groups
+    // Prepare the floating drawing groups - this is done for the entire document since the group ids are generated in
+    // order of appearance
+    FloatingObject::ResetDrawingObjectIDs();
     PrepareFloatingGrpsFunctor prepareFloatingGrps(this);
     this->Process(prepareFloatingGrps);
 
@@ -818,17 +992,20 @@ void Doc::PrepareData()
 
     // Prepare the drawing cue size
     PrepareCueSizeFunctor prepareCueSize;
+    prepareCueSize.PushFilters(&measureFilters);
     this->Process(prepareCueSize);
 
     /************ Resolve @altsym ************/
 
     // Try to match all pointing elements using @next, @sameas and @stem.sameas
     PrepareAltSymFunctor prepareAltSym;
+    prepareAltSym.PushFilters(&measureFilters);
     this->Process(prepareAltSym);
 
     /************ Instanciate LayerElement parts (stem, flag, dots, etc) ************/
 
     PrepareLayerElementPartsFunctor prepareLayerElementParts;
+    prepareLayerElementParts.PushFilters(&measureFilters);
     this->Process(prepareLayerElementParts);
 
     /************ Add default syl for syllables (if applicable) ************/
@@ -858,10 +1035,152 @@ void Doc::PrepareData()
     // LogElapsedTimeEnd ("Preparing drawing");
 
     m_dataPreparationDone = true;
+
+    m_changedMeasures.clear();
+    m_fullPreparationNeeded = false;
+    m_dependencyMeasures.clear();
+    m_dependencyRanges.clear();
+}
+
+void Doc::PrepareChangedData()
+{
+    const int prepareData = m_options->m_prepareData.GetValue();
+    if ((prepareData == PREPAREDATA_full) || m_fullPreparationNeeded || m_changedMeasures.empty()
+        || (this->GetType() == Facs)) {
+        this->PrepareData();
+        return;
+    }
+
+    // The measure indices and the dependencies cannot be used when measures were added or removed
+    const ListOfConstObjects measures = std::as_const(*this).FindAllDescendantsByType(MEASURE, false);
+    if (measures != m_dependencyMeasures) {
+        this->PrepareData();
+        return;
+    }
+
+    // Add the dependencies encoded in the changed measures to the ones of the data prepared before the changes
+    InitDataDependenciesFunctor initDataDependencies(false);
+    for (const Object *measure : m_changedMeasures) {
+        measure->Process(initDataDependencies);
+    }
+    initDataDependencies.SetDataCollectionCompleted();
+    this->Process(initDataDependencies);
+
+    std::vector<std::pair<int, int>> ranges = m_dependencyRanges;
+    ranges.insert(ranges.end(), initDataDependencies.GetRanges().begin(), initDataDependencies.GetRanges().end());
+
+    // The changed measures and their neighbours (for the pointers set by layer, e.g., for dots) are prepared again
+    const int count = (int)measures.size();
+    std::vector<bool> isPrepared(count + 1, false);
+    for (const Object *object : m_changedMeasures) {
+        const Measure *measure = vrv_cast<const Measure *>(object);
+        assert(measure);
+        const int index = measure->GetIndex();
+        for (int i = std::max(1, index - 1); i <= std::min(count, index + 1); ++i) isPrepared.at(i) = true;
+    }
+
+    // Extend them with all the ranges overlapping them until no range is left partially prepared
+    bool extended = true;
+    std::vector<int> preparedCounts(count + 1, 0);
+    while (extended) {
+        extended = false;
+        for (int i = 1; i <= count; ++i) {
+            preparedCounts.at(i) = preparedCounts.at(i - 1) + (isPrepared.at(i) ? 1 : 0);
+        }
+        for (const auto &range : ranges) {
+            const int first = std::max(1, range.first);
+            const int last = std::min(count, range.second);
+            if (first > last) continue;
+            const int preparedCount = preparedCounts.at(last) - preparedCounts.at(first - 1);
+            if ((preparedCount == 0) || (preparedCount == last - first + 1)) continue;
+            for (int i = first; i <= last; ++i) isPrepared.at(i) = true;
+            extended = true;
+        }
+    }
+
+    std::set<const Object *> preparedMeasures;
+    int index = 0;
+    for (const Object *measure : measures) {
+        if (isPrepared.at(++index)) preparedMeasures.insert(measure);
+    }
+    if ((int)preparedMeasures.size() == count) {
+        this->PrepareData();
+        return;
+    }
+
+    LogDebug("Preparing the data for %d of %d measure(s)", (int)preparedMeasures.size(), count);
+    ObjectSetComparison matchMeasures(MEASURE, preparedMeasures);
+    this->PrepareData(&matchMeasures);
+
+    if (prepareData != PREPAREDATA_validate) return;
+
+    // Compare the data with the one of a preparation of the entire document
+    GetPreparedDataFunctor getChangedPreparedData;
+    this->Process(getChangedPreparedData);
+    std::vector<std::string> changedPreparedData = getChangedPreparedData.GetPreparedData();
+    this->PrepareData();
+    GetPreparedDataFunctor getPreparedData;
+    this->Process(getPreparedData);
+    std::vector<std::string> preparedData = getPreparedData.GetPreparedData();
+
+    std::sort(changedPreparedData.begin(), changedPreparedData.end());
+    std::sort(preparedData.begin(), preparedData.end());
+    std::vector<std::string> unexpected;
+    std::vector<std::string> missing;
+    std::set_difference(changedPreparedData.begin(), changedPreparedData.end(), preparedData.begin(),
+        preparedData.end(), std::back_inserter(unexpected));
+    std::set_difference(preparedData.begin(), preparedData.end(), changedPreparedData.begin(),
+        changedPreparedData.end(), std::back_inserter(missing));
+    if (unexpected.empty() && missing.empty()) return;
+
+    LogWarning("The data prepared for the changed measures differs from the one of the entire document");
+    const int maxLines = 10;
+    for (int i = 0; i < std::min(maxLines, (int)unexpected.size()); ++i) {
+        LogWarning("Unexpected: %s", unexpected.at(i).c_str());
+    }
+    for (int i = 0; i < std::min(maxLines, (int)missing.size()); ++i) {
+        LogWarning("Missing: %s", missing.at(i).c_str());
+    }
+    if (((int)unexpected.size() > maxLines) || ((int)missing.size() > maxLines)) {
+        LogWarning("%d unexpected and %d missing value(s) in total", (int)unexpected.size(), (int)missing.size());
+    }
+}
+
+void Doc::MarkDataChanged(const Object *object)
+{
+    assert(object);
+
+    if (m_fullPreparationNeeded) return;
+
+    // Keep the dependencies of the data prepared before the first change
+    if (m_changedMeasures.empty()) {
+        if (!m_dataPreparationDone || (m_options->m_prepareData.GetValue() == PREPAREDATA_full)) {
+            m_fullPreparationNeeded = true;
+            return;
+        }
+        m_dependencyMeasures = std::as_const(*this).FindAllDescendantsByType(MEASURE, false);
+        InitDataDependenciesFunctor initDataDependencies(true);
+        initDataDependencies.SetDataCollectionCompleted();
+        this->Process(initDataDependencies);
+        m_dependencyRanges = initDataDependencies.GetRanges();
+    }
+
+    const Object *measure = (object->Is(MEASURE)) ? object : object->GetFirstAncestor(MEASURE);
+    // The dependency ranges do not follow the readings of an app or a choice around measures, which are then prepared
+    // in full like the changes outside the measures
+    if (measure && !measure->GetFirstAncestorInRange(EDITORIAL_ELEMENT, EDITORIAL_ELEMENT_max)) {
+        m_changedMeasures.insert(measure);
+    }
+    // Changes outside the measures (e.g., to the scoreDef) require the entire document to be prepared
+    else {
+        m_fullPreparationNeeded = true;
+    }
 }
 
 void Doc::ScoreDefSetCurrentDoc(bool force)
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "ScoreDefSetCurrentDoc");
+
     if (m_currentScoreDefDone && !force) {
         return;
     }
@@ -922,6 +1241,8 @@ void Doc::CastOffSmartDoc()
 
 void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "CastOff");
+
     Pages *pages = this->GetPages();
     assert(pages);
 
@@ -1027,6 +1348,8 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
 
 void Doc::UnCastOffDoc(bool resetCache)
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "UnCastOff");
+
     if (!this->IsCastOff()) {
         LogDebug("Document is not cast off");
         return;
@@ -1056,6 +1379,8 @@ void Doc::UnCastOffDoc(bool resetCache)
 
 void Doc::CastOffEncodingDoc()
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "CastOffEncoding");
+
     if (this->IsCastOff()) {
         LogDebug("Document is already cast off");
         return;
@@ -1332,19 +1657,19 @@ void Doc::ConvertMarkupDoc(bool permanent)
 
         // Process by layer for matching @tie attribute - we process notes and chords, looking at
         // GetTie values and pitch and oct for matching notes
-        Filters filters;
+        // The layers are processed directly and the end of their measure is visited for adding the control events
         for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
             for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
-                AttNIntegerComparison matchLayer(LAYER, layers->first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
-
                 ConvertMarkupAnalyticalFunctor convertMarkupAnalytical(permanent);
-                convertMarkupAnalytical.PushFilters(&filters);
-                this->Process(convertMarkupAnalytical);
+                const std::vector<Layer *> &layerList = initProcessingLists.GetLayers(staves->first, layers->first);
+                for (auto iter = layerList.begin(); iter != layerList.end(); ++iter) {
+                    (*iter)->Process(convertMarkupAnalytical);
+                    Measure *measure = vrv_cast<Measure *>((*iter)->GetFirstAncestor(MEASURE));
+                    Measure *nextMeasure = (std::next(iter) != layerList.end())
+                        ? vrv_cast<Measure *>((*std::next(iter))->GetFirstAncestor(MEASURE))
+                        : NULL;
+                    if (measure && (measure != nextMeasure)) measure->AcceptEnd(convertMarkupAnalytical);
+                }
 
                 // After having processed one layer, we check if we have open ties - if yes, we
                 // must reset them and they will be ignored.
@@ -1416,7 +1741,7 @@ void Doc::ExpandExpansions()
 
     xsdAnyURI_List expansionList = start->GetPlist();
     xsdAnyURI_List existingList;
-    m_expansionMap.Expand(expansionList, existingList, start);
+    m_expansionMap.Expand(expansionList, existingList, start, this->GetOptions()->m_expandShared.GetValue());
 
     // save original/notated expansion as element in expanded MEI
     // Expansion *originalExpansion = new Expansion();
@@ -1435,6 +1760,83 @@ void Doc::ExpandExpansions()
     // for (std::string s : existingList) std::cout << s.c_str() << ((s != existingList.back()) ? " " : "}.\n");
 }
 
+void Doc::ProcessInExpansionOrder(Functor &functor)
+{
+    if (!m_expansionMap.HasSharedRepeats()) {
+        this->Process(functor);
+        return;
+    }
+
+    for (Object *object : this->GetObjectsInExpansionOrder()) {
+        object->Process(functor);
+        if (functor.GetCode() == FUNCTOR_STOP) break;
+    }
+}
+
+void Doc::ProcessInExpansionOrder(ConstFunctor &functor) const
+{
+    if (!m_expansionMap.HasSharedRepeats()) {
+        this->Process(functor);
+        return;
+    }
+
+    for (const Object *object : this->GetObjectsInExpansionOrder()) {
+        object->Process(functor);
+        if (functor.GetCode() == FUNCTOR_STOP) break;
+    }
+}
+
+std::vector<Object *> Doc::GetObjectsInExpansionOrder()
+{
+    std::vector<Object *> objects;
+    Pages *pages = this->GetPages();
+    if (!pages) return objects;
+
+    for (Object *page : pages->GetChildren()) {
+        for (Object *child : page->GetChildren()) {
+            if (child->Is(SYSTEM)) {
+                const ArrayOfObjects &systemChildren = child->GetChildren();
+                objects.insert(objects.end(), systemChildren.begin(), systemChildren.end());
+            }
+            else {
+                objects.push_back(child);
+            }
+        }
+    }
+
+    std::vector<Object *> orderedObjects;
+    const std::vector<const Object *> constObjects(objects.begin(), objects.end());
+    for (int position : m_expansionMap.GetSharedPlaybackOrder(constObjects)) {
+        orderedObjects.push_back(objects.at(position));
+    }
+    return orderedObjects;
+}
+
+std::vector<const Object *> Doc::GetObjectsInExpansionOrder() const
+{
+    std::vector<const Object *> objects;
+    const Pages *pages = this->GetPages();
+    if (!pages) return objects;
+
+    for (const Object *page : pages->GetChildren()) {
+        for (const Object *child : page->GetChildren()) {
+            if (child->Is(SYSTEM)) {
+                const ArrayOfConstObjects systemChildren = child->GetChildren();
+                objects.insert(objects.end(), systemChildren.begin(), systemChildren.end());
+            }
+            else {
+                objects.push_back(child);
+            }
+        }
+    }
+
+    std::vector<const Object *> orderedObjects;
+    for (int position : m_expansionMap.GetSharedPlaybackOrder(objects)) {
+        orderedObjects.push_back(objects.at(position));
+    }
+    return orderedObjects;
+}
+
 bool Doc::HasPage(int pageIdx) const
 {
     const Pages *pages = this->GetPages();
@@ -1470,42 +1872,104 @@ int Doc::GetPageCount() const
     return ((pages) ? pages->GetChildCount() : 0);
 }
 
+int Doc::ScaleGlyphValue(int value, const Glyph *glyph, int staffSize, bool graceSize) const
+{
+    value = value * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
+    if (graceSize) value = value * m_options->m_graceFactor.GetValue();
+    value = value * staffSize / 100;
+    return value;
+}
+
+const Doc::ScaledGlyphMetrics *Doc::GetScaledGlyphMetrics(char32_t code, int staffSize, bool graceSize) const
+{
+    if ((code < GLYPH_METRICS_FIRST_CODE) || (code > GLYPH_METRICS_LAST_CODE)) return NULL;
+    if ((staffSize < 0) || (staffSize > GLYPH_METRICS_MAX_STAFF_SIZE)) return NULL;
+
+    std::atomic<ScaledGlyphMetricTable *> &slot = m_scaledGlyphMetrics[2 * staffSize + graceSize];
+    const ScaledGlyphMetricTable *table = slot.load(std::memory_order_acquire);
+    if (!table) {
+        std::lock_guard<std::mutex> lock(m_scaledGlyphMetricsMutex);
+        table = slot.load(std::memory_order_relaxed);
+        if (!table) {
+            ScaledGlyphMetricTable *newTable = new ScaledGlyphMetricTable();
+            newTable->m_fontSize = m_drawingSmuflFontSize;
+            newTable->m_graceFactor = m_options->m_graceFactor.GetValue();
+            newTable->m_metrics.resize(GLYPH_METRICS_LAST_CODE - GLYPH_METRICS_FIRST_CODE + 1, { 0, 0, 0, 0, 0, false });
+            for (char32_t glyphCode = GLYPH_METRICS_FIRST_CODE; glyphCode <= GLYPH_METRICS_LAST_CODE; ++glyphCode) {
+                const Glyph *glyph = m_resources.GetGlyph(glyphCode);
+                if (!glyph) continue;
+                int x, y, w, h;
+                glyph->GetBoundingBox(x, y, w, h);
+                ScaledGlyphMetrics &metrics = newTable->m_metrics[glyphCode - GLYPH_METRICS_FIRST_CODE];
+                metrics.m_x = this->ScaleGlyphValue(x, glyph, staffSize, graceSize);
+                metrics.m_y = this->ScaleGlyphValue(y, glyph, staffSize, graceSize);
+                metrics.m_width = this->ScaleGlyphValue(w, glyph, staffSize, graceSize);
+                metrics.m_height = this->ScaleGlyphValue(h, glyph, staffSize, graceSize);
+                metrics.m_advX = this->ScaleGlyphValue(glyph->GetHorizAdvX(), glyph, staffSize, graceSize);
+                metrics.m_isSet = true;
+            }
+            slot.store(newTable, std::memory_order_release);
+            table = newTable;
+        }
+    }
+
+    // The table cannot be used if the font size or the grace factor changed since it was built
+    if ((table->m_fontSize != m_drawingSmuflFontSize) || (table->m_graceFactor != m_options->m_graceFactor.GetValue())) {
+        return NULL;
+    }
+    const ScaledGlyphMetrics &metrics = table->m_metrics[code - GLYPH_METRICS_FIRST_CODE];
+    return (metrics.m_isSet) ? &metrics : NULL;
+}
+
+void Doc::ResetScaledGlyphMetrics(bool outdatedOnly)
+{
+    for (std::atomic<ScaledGlyphMetricTable *> &slot : m_scaledGlyphMetrics) {
+        ScaledGlyphMetricTable *table = slot.load(std::memory_order_relaxed);
+        if (!table) continue;
+        if (outdatedOnly && (table->m_fontSize == m_drawingSmuflFontSize)
+            && (table->m_graceFactor == m_options->m_graceFactor.GetValue())) {
+            continue;
+        }
+        delete table;
+        slot.store(NULL, std::memory_order_relaxed);
+    }
+}
+
 int Doc::GetGlyphHeight(char32_t code, int staffSize, bool graceSize) const
 {
+    const ScaledGlyphMetrics *metrics = this->GetScaledGlyphMetrics(code, staffSize, graceSize);
+    if (metrics) return metrics->m_height;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
-    h = h * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) h = h * m_options->m_graceFactor.GetValue();
-    h = h * staffSize / 100;
-    return h;
+    return this->ScaleGlyphValue(h, glyph, staffSize, graceSize);
 }
 
 int Doc::GetGlyphWidth(char32_t code, int staffSize, bool graceSize) const
 {
+    const ScaledGlyphMetrics *metrics = this->GetScaledGlyphMetrics(code, staffSize, graceSize);
+    if (metrics) return metrics->m_width;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
-    w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) w = w * m_options->m_graceFactor.GetValue();
-    w = w * staffSize / 100;
-    return w;
+    return this->ScaleGlyphValue(w, glyph, staffSize, graceSize);
 }
 
 int Doc::GetGlyphAdvX(char32_t code, int staffSize, bool graceSize) const
 {
+    const ScaledGlyphMetrics *metrics = this->GetScaledGlyphMetrics(code, staffSize, graceSize);
+    if (metrics) return metrics->m_advX;
+
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
     assert(glyph);
-    int advX = glyph->GetHorizAdvX();
-    advX = advX * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) advX = advX * m_options->m_graceFactor.GetValue();
-    advX = advX * staffSize / 100;
-    return advX;
+    return this->ScaleGlyphValue(glyph->GetHorizAdvX(), glyph, staffSize, graceSize);
 }
 
 Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staffSize, bool graceSize) const
@@ -1528,15 +1992,15 @@ Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staf
 
 int Doc::GetGlyphLeft(char32_t code, int staffSize, bool graceSize) const
 {
+    const ScaledGlyphMetrics *metrics = this->GetScaledGlyphMetrics(code, staffSize, graceSize);
+    if (metrics) return metrics->m_x;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
-    x = x * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) x = x * m_options->m_graceFactor.GetValue();
-    x = x * staffSize / 100;
-    return x;
+    return this->ScaleGlyphValue(x, glyph, staffSize, graceSize);
 }
 
 int Doc::GetGlyphRight(char32_t code, int staffSize, bool graceSize) const
@@ -1546,15 +2010,15 @@ int Doc::GetGlyphRight(char32_t code, int staffSize, bool graceSize) const
 
 int Doc::GetGlyphBottom(char32_t code, int staffSize, bool graceSize) const
 {
+    const ScaledGlyphMetrics *metrics = this->GetScaledGlyphMetrics(code, staffSize, graceSize);
+    if (metrics) return metrics->m_y;
+
     int x, y, w, h;
     const Resources &resources = this->GetResources();
     const Glyph *glyph = resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
-    y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) y = y * m_options->m_graceFactor.GetValue();
-    y = y * staffSize / 100;
-    return y;
+    return this->ScaleGlyphValue(y, glyph, staffSize, graceSize);
 }
 
 int Doc::GetGlyphTop(char32_t code, int staffSize, bool graceSize) const
@@ -1986,6 +2450,8 @@ Page *Doc::SetDrawingPage(int pageIdx)
 
     // values for fonts
     m_drawingSmuflFontSize = this->CalcMusicFontSize();
+    // The tables of scaled glyph metrics are built again for a new font size or grace factor
+    this->ResetScaledGlyphMetrics(true);
     m_drawingLyricFontSize = m_options->m_unit.GetValue() * m_options->m_lyricSize.GetValue();
     m_fingeringFontSize = m_drawingLyricFontSize * m_options->m_fingeringScale.GetValue();
 
@@ -2025,6 +2491,26 @@ int Doc::GetAdjustedDrawingPageWidth() const
     return (contentWidth + m_drawingPageMarginLeft + m_drawingPageMarginRight) / DEFINITION_FACTOR;
 }
 
+ThreadPool *Doc::GetThreadPool()
+{
+#ifdef __EMSCRIPTEN__
+    // No threads available
+    return NULL;
+#else
+    const int threadCount = m_options->m_threads.GetValue();
+    if (threadCount < 2) return NULL;
+
+    if (m_threadPool && (m_threadPool->GetThreadCount() != threadCount)) {
+        delete m_threadPool;
+        m_threadPool = NULL;
+    }
+    if (!m_threadPool) {
+        m_threadPool = new ThreadPool(threadCount);
+    }
+    return m_threadPool;
+#endif
+}
+
 Score *Doc::GetCurrentScore()
 {
     if (!m_currentScore) {
@@ -2043,7 +2529,8 @@ ScoreDef *Doc::GetCurrentScoreDef()
 
 void Doc::SetCurrentScore(Score *score)
 {
-    m_currentScore = score;
+    // Do not write it again when unchanged since documents with a single score can be processed concurrently
+    if (m_currentScore != score) m_currentScore = score;
 }
 
 //----------------------------------------------------------------------------
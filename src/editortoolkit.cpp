@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        editortoolkit.cpp
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "editortoolkit.h"
+
+//--------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <sstream>
+
+//--------------------------------------------------------------------------------
+
+#include "iomei.h"
+#include "page.h"
+#include "vrv.h"
+
+//--------------------------------------------------------------------------------
+
+namespace vrv {
+
+//--------------------------------------------------------------------------------
+// EditorToolkit
+//--------------------------------------------------------------------------------
+
+bool EditorToolkit::PerformAction(const std::string &json_editorAction)
+{
+    jsonxx::Object json;
+    std::string action;
+    if (json.parse(json_editorAction) && json.has<jsonxx::String>("action")) {
+        action = json.get<jsonxx::String>("action");
+    }
+
+    if (action == "begin") {
+        return this->BeginTransaction();
+    }
+    else if (action == "rollback") {
+        if (!m_isInTransaction) {
+            LogWarning("No transaction to roll back.");
+            return false;
+        }
+        this->AbortTransaction();
+        return true;
+    }
+    else if ((action == "commit") && m_isInTransaction) {
+        return this->CommitTransaction();
+    }
+
+    const bool success = this->ParseEditorAction(json_editorAction);
+
+    if (m_isInTransaction) {
+        if (success) {
+            this->AddAffectedIds(json);
+        }
+        else {
+            // Keep the information on the action that failed
+            jsonxx::Object info;
+            info.parse(this->EditInfo());
+            this->AbortTransaction();
+            info.import("status", "FAILURE");
+            info.import("rolledBack", true);
+            this->SetEditInfo(this->GetTransactionInfo(info));
+        }
+    }
+
+    return success;
+}
+
+bool EditorToolkit::BeginTransaction()
+{
+    if (m_isInTransaction) {
+        LogError("A transaction is already in progress.");
+        jsonxx::Object info;
+        info.import("status", "FAILURE");
+        info.import("message", "A transaction is already in progress.");
+        this->SetEditInfo(info);
+        return false;
+    }
+
+    // Save the document as for Toolkit::GetMEI, with the selection deactivated, or with its pages when it was loaded
+    // from page-based MEI
+    const int drawingPageIdx = (m_doc->GetDrawingPage()) ? m_doc->GetDrawingPage()->GetIdx() : -1;
+    const bool hadSelection = m_doc->HasSelection();
+    if (hadSelection) m_doc->DeactiveateSelection();
+
+    MEIOutput meioutput(m_doc);
+    meioutput.SetScoreBasedMEI(!m_isPageBasedData);
+    std::ostringstream output;
+    const bool success = meioutput.GetOutput(output);
+
+    if (hadSelection) m_doc->ReactivateSelection(false);
+    if (drawingPageIdx >= 0) m_doc->SetDrawingPage(drawingPageIdx);
+
+    if (!success) {
+        LogError("The document could not be saved for the transaction.");
+        jsonxx::Object info;
+        info.import("status", "FAILURE");
+        info.import("message", "The document could not be saved for the transaction.");
+        this->SetEditInfo(info);
+        return false;
+    }
+
+    m_isInTransaction = true;
+    m_transactionNeedsPrepareData = false;
+    m_transactionNeedsLayOut = false;
+    m_transactionIds.clear();
+    m_transactionSnapshot = output.str();
+    m_rollbackData.clear();
+
+    this->SetEditInfo(this->GetTransactionInfo(jsonxx::Object()));
+    return true;
+}
+
+bool EditorToolkit::CommitTransaction()
+{
+    if (!m_isInTransaction) {
+        LogWarning("No transaction to commit.");
+        return false;
+    }
+
+    this->OnCommitTransaction();
+
+    m_isInTransaction = false;
+    m_transactionSnapshot.clear();
+
+    // The work deferred by the actions is done once
+    if (m_transactionNeedsPrepareData) m_doc->PrepareChangedData();
+    if (m_transactionNeedsLayOut && m_doc->GetDrawingPage()) m_doc->GetDrawingPage()->LayOut(true);
+    m_transactionNeedsPrepareData = false;
+    m_transactionNeedsLayOut = false;
+
+    this->SetEditInfo(this->GetTransactionInfo(jsonxx::Object()));
+    return true;
+}
+
+void EditorToolkit::AbortTransaction()
+{
+    if (!m_isInTransaction) return;
+
+    m_isInTransaction = false;
+    m_transactionNeedsPrepareData = false;
+    m_transactionNeedsLayOut = false;
+    m_rollbackData = std::move(m_transactionSnapshot);
+    m_transactionSnapshot.clear();
+    // The objects will be replaced when the document is restored
+    this->ResetDocCaches();
+
+    jsonxx::Object info;
+    info.import("rolledBack", true);
+    this->SetEditInfo(this->GetTransactionInfo(info));
+}
+
+std::string EditorToolkit::TakeRollbackData()
+{
+    std::string rollbackData = std::move(m_rollbackData);
+    m_rollbackData.clear();
+    return rollbackData;
+}
+
+void EditorToolkit::UpdateDoc(bool layOut)
+{
+    if (m_isInTransaction) {
+        m_transactionNeedsPrepareData = true;
+        m_transactionNeedsLayOut = m_transactionNeedsLayOut || layOut;
+        return;
+    }
+
+    m_doc->PrepareChangedData();
+    if (layOut && m_doc->GetDrawingPage()) m_doc->GetDrawingPage()->LayOut(true);
+}
+
+void EditorToolkit::AddAffectedIds(const jsonxx::Object &action)
+{
+    std::vector<std::string> ids;
+
+    if (action.has<jsonxx::Object>("param")) {
+        const jsonxx::Object &param = action.get<jsonxx::Object>("param");
+        for (const std::string key : { "elementId", "startid", "endid" }) {
+            if (param.has<jsonxx::String>(key)) ids.push_back(param.get<jsonxx::String>(key));
+        }
+        if (param.has<jsonxx::Array>("elementIds")) {
+            const jsonxx::Array &elementIds = param.get<jsonxx::Array>("elementIds");
+            for (int i = 0; i < (int)elementIds.size(); ++i) {
+                if (elementIds.has<jsonxx::String>(i)) ids.push_back(elementIds.get<jsonxx::String>(i));
+            }
+        }
+    }
+
+    // The element created or modified as reported by the action
+    jsonxx::Object info;
+    if (info.parse(this->EditInfo()) && info.has<jsonxx::String>("uuid")) {
+        ids.push_back(info.get<jsonxx::String>("uuid"));
+    }
+
+    for (const std::string &id : ids) {
+        if (id.empty()) continue;
+        if (std::find(m_transactionIds.begin(), m_transactionIds.end(), id) != m_transactionIds.end()) continue;
+        m_transactionIds.push_back(id);
+    }
+}
+
+jsonxx::Object EditorToolkit::GetTransactionInfo(jsonxx::Object info) const
+{
+    if (!info.has<jsonxx::String>("status")) info.import("status", "OK");
+    if (!info.has<jsonxx::String>("message")) info.import("message", "");
+
+    jsonxx::Array affectedIds;
+    for (const std::string &id : m_transactionIds) affectedIds << id;
+    info.import("affectedIds", affectedIds);
+
+    return info;
+}
+
+} // namespace vrv
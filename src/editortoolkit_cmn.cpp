@@ -61,7 +61,7 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
 
     // Action without parameter
     if (action == "commit") {
-        m_doc->PrepareData();
+        m_doc->PrepareChangedData();
         return true;
     }
 
@@ -203,8 +203,12 @@ bool EditorToolkitCMN::Chain(jsonxx::Array actions)
     bool status = true;
     m_chainedId = "";
     for (int i = 0; i < (int)actions.size(); ++i) {
-        status = this->ParseEditorAction(actions.get<jsonxx::Object>(i).json(), !status);
+        const std::string action = actions.get<jsonxx::Object>(i).json();
+        // After a failure, only the commit actions are processed
+        status = (status) ? this->PerformAction(action) : this->ParseEditorAction(action, true);
         m_editInfo.import("uuid", m_chainedId);
+        // The remaining actions are skipped when the transaction was rolled back
+        if (this->HasRollbackData()) break;
     }
     return status;
 }
@@ -215,6 +219,7 @@ bool EditorToolkitCMN::Delete(std::string &elementId)
     if (!element) return false;
 
     if (element->Is(NOTE)) {
+        m_doc->MarkDataChanged(element);
         return this->DeleteNote(vrv_cast<Note *>(element));
     }
     return false;
@@ -229,6 +234,7 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
     if (element->HasInterface(INTERFACE_PITCH)) {
         Layer *layer = vrv_cast<Layer *>(element->GetFirstAncestor(LAYER));
         if (!layer) return false;
+        m_doc->MarkDataChanged(element);
         int oct;
         data_PITCHNAME pname
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
@@ -249,6 +255,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
     if (element->HasInterface(INTERFACE_PITCH)) {
         PitchInterface *interface = element->GetPitchInterface();
         assert(interface);
+        m_doc->MarkDataChanged(element);
         int step;
         switch (key) {
             case KEY_UP: step = 1; break;
@@ -303,6 +310,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     assert(element);
     TimeSpanningInterface *interface = element->GetTimeSpanningInterface();
     assert(interface);
+    m_doc->MarkDataChanged(measure);
     measure->AddChild(element);
     interface->SetStartid("#" + startid);
     interface->SetEndid("#" + endid);
@@ -324,6 +332,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         return false;
     }
     if (elementType == "note") {
+        m_doc->MarkDataChanged(start);
         return this->InsertNote(start);
     }
     // Check if it is a LayerElement
@@ -350,6 +359,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     assert(element);
     TimeSpanningInterface *interface = element->GetTimeSpanningInterface();
     assert(interface);
+    m_doc->MarkDataChanged(measure);
     measure->AddChild(element);
     interface->SetStartid("#" + startid);
 
@@ -364,6 +374,7 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     Object *element = this->GetElement(elementId);
     if (!element) return false;
 
+    m_doc->MarkDataChanged(element);
     bool success = false;
     if (AttModule::SetAnalytical(element, attribute, value))
         success = true;
@@ -210,8 +210,10 @@ bool EditorToolkitNeume::Chain(jsonxx::Array actions)
             m_infoObject.import("message", "Action " + std::to_string(i) + " was not an object.");
             return false;
         }
-        status |= this->ParseEditorAction(actions.get<jsonxx::Object>(i).json());
+        status |= this->PerformAction(actions.get<jsonxx::Object>(i).json());
         results.import(std::to_string(i), m_infoObject);
+        // The remaining actions are skipped when the transaction was rolled back
+        if (this->HasRollbackData()) break;
     }
     m_infoObject = results;
     return status;
@@ -538,6 +540,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y)
         }
 
         staff->GetParent()->StableSort(StaffSort());
+        this->UpdateStaffIndex(staff);
 
         return true; // Can't reorder by layer since staves contain layers
     }
@@ -590,20 +593,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
 
     // Find closest valid staff
     if (staffId == "auto") {
-        ListOfObjects staves = m_doc->FindAllDescendantsByType(STAFF, false);
-        std::vector<Object *> stavesVector(staves.begin(), staves.end());
-
-        ClosestBB comp;
-        comp.x = ulx;
-        comp.y = uly;
-
-        if (staves.size() > 0) {
-            std::sort(stavesVector.begin(), stavesVector.end(), comp);
-            staff = dynamic_cast<Staff *>(stavesVector.at(0));
-        }
-        else {
-            staff = NULL;
-        }
+        staff = this->FindClosestStaff(ulx, uly);
     }
     else {
         staff = dynamic_cast<Staff *>(m_doc->FindDescendantByID(staffId));
@@ -645,6 +635,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
         newStaff->AttachZone(zone);
         Layer *newLayer = new Layer();
         newStaff->AddChild(newLayer);
+        this->UpdateStaffIndex(newStaff);
 
         // Find index to insert new staff
         ListOfObjects staves = parent->FindAllDescendantsByType(STAFF, false);
@@ -1003,6 +994,7 @@ bool EditorToolkitNeume::Merge(std::vector<std::string> elementIds)
         fillLayer->MoveChildrenFrom(sourceLayer);
         assert(sourceLayer->GetChildCount() == 0);
         Object *parent = sourceStaff->GetParent();
+        m_staffIndex.Remove(sourceStaff);
         parent->DeleteChild(sourceStaff);
     }
     // Set the bounding box for the staff to the new bounds
@@ -1012,6 +1004,7 @@ bool EditorToolkitNeume::Merge(std::vector<std::string> elementIds)
     staffZone->SetLrx(lrx);
     staffZone->SetLry(lry);
     staffZone->SetRotate(0);
+    this->UpdateStaffIndex(fillStaff);
 
     fillLayer->ReorderByXPos();
 
@@ -1056,8 +1049,8 @@ bool EditorToolkitNeume::Set(std::string elementId, std::string attrType, std::s
     else if (AttModule::SetVisual(element, attrType, attrValue))
         success = true;
     if (success && m_doc->GetType() != Facs) {
-        m_doc->PrepareData();
-        m_doc->GetDrawingPage()->LayOut(true);
+        m_doc->MarkDataChanged(element);
+        this->UpdateDoc(true);
     }
     m_infoObject.import("status", success ? "OK" : "FAILURE");
     m_infoObject.import("message", success ? "" : "Could not set attribute '" + attrType + "' to '" + attrValue + "'.");
@@ -1215,8 +1208,9 @@ bool EditorToolkitNeume::SetClef(std::string elementId, std::string shape)
         }
     }
     if (success && m_doc->GetType() != Facs) {
-        m_doc->PrepareData();
-        m_doc->GetDrawingPage()->LayOut(true);
+        // The elements adjusted by pitch are in the layer of the clef
+        m_doc->MarkDataChanged(clef);
+        this->UpdateDoc(true);
     }
     m_infoObject.import("status", "OK");
     m_infoObject.import("message", "");
@@ -1311,6 +1305,8 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
         }
     }
     layer->ClearRelinquishedChildren();
+    this->UpdateStaffIndex(staff);
+    this->UpdateStaffIndex(splitStaff);
     m_infoObject.import("status", "OK");
     m_infoObject.import("message", "");
     m_infoObject.import("uuid", splitStaff->GetID());
@@ -1349,6 +1345,13 @@ bool EditorToolkitNeume::Remove(std::string elementId)
             fi->AttachZone(NULL);
         }
     }
+    // Do not keep the staves being deleted in the staff index
+    if (obj->Is(STAFF)) {
+        m_staffIndex.Remove(obj);
+    }
+    else if (obj->FindDescendantByType(STAFF)) {
+        m_staffIndexIsValid = false;
+    }
     if (isClef) {
         // y position of pitched elements (like neumes) is determined by their pitches
         // so when deleting a clef, the position on a page that a pitch value is associated with could change
@@ -1495,6 +1498,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
         }
         zone->Modify();
         staff->GetParent()->StableSort(StaffSort());
+        this->UpdateStaffIndex(staff);
     }
     else if (obj->Is(SYL)) {
         Syl *syl = vrv_cast<Syl *>(obj);
@@ -2304,8 +2308,9 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds, std
         return false;
     }
     if (success1 && success2 && m_doc->GetType() != Facs) {
-        m_doc->PrepareData();
-        m_doc->GetDrawingPage()->LayOut(true);
+        m_doc->MarkDataChanged(firstNc);
+        m_doc->MarkDataChanged(secondNc);
+        this->UpdateDoc(true);
     }
     m_infoObject.import("status", "OK");
     m_infoObject.import("message", "");
@@ -2354,10 +2359,6 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    ListOfObjects stavesList = m_doc->FindAllDescendantsByType(STAFF, false);
-
-    std::vector<Object *> staves(stavesList.begin(), stavesList.end());
-
     ClosestBB comp;
 
     if (element->GetFacsimileInterface()->HasFacs()) {
@@ -2385,13 +2386,9 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    Staff *staff = NULL;
+    Staff *staff = this->FindClosestStaff(comp.x, comp.y);
 
-    if (staves.size() > 0) {
-        std::sort(staves.begin(), staves.end(), comp);
-        staff = dynamic_cast<Staff *>(staves.front());
-    }
-    else {
+    if (!staff) {
         LogError("Could not find any staves. This should not happen");
         m_infoObject.import("status", "FAILURE");
         m_infoObject.import("message", "Could not find any staves. This should not happen");
@@ -2908,4 +2905,92 @@ bool EditorToolkitNeume::AdjustClefLineFromPosition(Clef *clef, Staff *staff)
     return true;
 }
 
+Staff *EditorToolkitNeume::FindClosestStaff(int x, int y)
+{
+    if (!m_staffIndexIsValid) this->BuildStaffIndex();
+
+    // Staves without facsimile cannot be compared, use the first one
+    if (m_staffIndex.GetSize() == 0) return dynamic_cast<Staff *>(m_doc->FindDescendantByType(STAFF, false));
+
+    ClosestBB comp;
+    comp.x = x;
+    comp.y = y;
+
+    // Search in growing squares around the point. A staff at a distance within the radius has its box intersecting
+    // the square, which is enlarged vertically by the slope of the staves (the distance is measured on the rotated
+    // zone) and by one unit for the rounding of the distance.
+    for (double radius = 128.0;; radius *= 4.0) {
+        const double height = radius * (1.0 + m_staffIndexMaxSlope) + 2.0;
+        const double x1 = std::max((double)m_staffIndexX1, x - radius - 1.0);
+        const double x2 = std::min((double)m_staffIndexX2, x + radius + 1.0);
+        const double y1 = std::max((double)m_staffIndexY1, y - height);
+        const double y2 = std::min((double)m_staffIndexY2, y + height);
+        const bool coversIndex = (x1 == m_staffIndexX1) && (x2 == m_staffIndexX2) && (y1 == m_staffIndexY1)
+            && (y2 == m_staffIndexY2);
+
+        Staff *closest = NULL;
+        int closestDistance = 0;
+        if ((x1 <= x2) && (y1 <= y2)) {
+            for (const Object *object : m_staffIndex.FindInRect(x1, y1, x2, y2)) {
+                const Zone *zone = vrv_cast<const Staff *>(object)->GetZone();
+                assert(zone);
+                const int distance = comp.distanceToBB(
+                    zone->GetUlx(), zone->GetUly(), zone->GetLrx(), zone->GetLry(), zone->GetRotate());
+                if (!closest || (distance < closestDistance)) {
+                    closest = const_cast<Staff *>(vrv_cast<const Staff *>(object));
+                    closestDistance = distance;
+                }
+            }
+        }
+        if (closest && (closestDistance <= radius)) return closest;
+        if (coversIndex) return closest;
+    }
+}
+
+void EditorToolkitNeume::BuildStaffIndex()
+{
+    m_staffIndex.Reset();
+    m_staffIndexMaxSlope = 0.0;
+    m_staffIndexX1 = m_staffIndexY1 = std::numeric_limits<int>::max();
+    m_staffIndexX2 = m_staffIndexY2 = std::numeric_limits<int>::min();
+
+    ListOfObjects staves = m_doc->FindAllDescendantsByType(STAFF, false);
+    for (Object *object : staves) {
+        this->InsertInStaffIndex(vrv_cast<Staff *>(object));
+    }
+    m_staffIndex.Build();
+    m_staffIndexIsValid = true;
+}
+
+void EditorToolkitNeume::InsertInStaffIndex(Staff *staff)
+{
+    assert(staff);
+
+    if (!staff->HasFacs() || !staff->GetZone()) return;
+
+    const Zone *zone = staff->GetZone();
+    // The box covers the zone shifted by the rotation from the left to the right of the staff (see ClosestBB)
+    const double slope = tan(zone->GetRotate() * M_PI / 180.0);
+    const int shift = (zone->GetLrx() - zone->GetUlx()) * slope;
+    const int x1 = std::min(zone->GetUlx(), zone->GetLrx());
+    const int x2 = std::max(zone->GetUlx(), zone->GetLrx());
+    const int y1 = std::min({ zone->GetUly(), zone->GetLry(), zone->GetUly() - shift, zone->GetLry() - shift });
+    const int y2 = std::max({ zone->GetUly(), zone->GetLry(), zone->GetUly() - shift, zone->GetLry() - shift });
+    m_staffIndex.Insert(staff, x1, y1, x2, y2);
+
+    m_staffIndexMaxSlope = std::max(m_staffIndexMaxSlope, std::abs(slope));
+    m_staffIndexX1 = std::min(m_staffIndexX1, x1);
+    m_staffIndexY1 = std::min(m_staffIndexY1, y1);
+    m_staffIndexX2 = std::max(m_staffIndexX2, x2);
+    m_staffIndexY2 = std::max(m_staffIndexY2, y2);
+}
+
+void EditorToolkitNeume::UpdateStaffIndex(Staff *staff)
+{
+    if (!m_staffIndexIsValid) return;
+
+    m_staffIndex.Remove(staff);
+    this->InsertInStaffIndex(staff);
+}
+
 } // namespace vrv
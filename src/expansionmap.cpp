@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <functional>
 #include <iostream>
 
 //----------------------------------------------------------------------------
@@ -18,6 +19,7 @@
 #include "expansion.h"
 #include "linkinginterface.h"
 #include "plistinterface.h"
+#include "systemmilestone.h"
 #include "timeinterface.h"
 #include "vrv.h"
 
@@ -34,9 +36,11 @@ ExpansionMap::~ExpansionMap() {}
 void ExpansionMap::Reset()
 {
     m_map.clear();
+    m_sharedRepeats.clear();
 }
 
-void ExpansionMap::Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &existingList, Object *prevSect)
+void ExpansionMap::Expand(
+    const xsdAnyURI_List &expansionList, xsdAnyURI_List &existingList, Object *prevSect, bool shared)
 {
     assert(prevSect);
     // find all siblings of expansion element to know what in MEI file
@@ -64,10 +68,25 @@ void ExpansionMap::Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &e
             }
             Expansion *currExpansion = vrv_cast<Expansion *>(currSect);
             assert(currExpansion);
-            Expand(currExpansion->GetPlist(), existingList, currSect);
+            Expand(currExpansion->GetPlist(), existingList, currSect, shared);
         }
         else {
-            if (std::find(existingList.begin(), existingList.end(), s)
+            if (shared
+                && (std::find(existingList.begin(), existingList.end(), s) != existingList.end())) { // shared repeat
+
+                // add the IDs the clone would have to m_map, with "-rend2" for the first repetition etc.
+                std::vector<std::string> oldIds;
+                oldIds.push_back(currSect->GetID());
+                this->GetIDList(currSect, oldIds);
+                for (const std::string &oldId : oldIds) {
+                    this->AddExpandedIDToExpansionMap(
+                        oldId, oldId + "-rend" + std::to_string(this->GetExpansionIDsForElement(oldId).size() + 1));
+                }
+
+                // the content is played again after the previous element, which remains the one to follow
+                m_sharedRepeats.push_back({ prevSect->GetID(), currSect->GetID() });
+            }
+            else if (std::find(existingList.begin(), existingList.end(), s)
                 != existingList.end()) { // section exists in list
 
                 // clone current section/ending/rdg/lem and rename it, adding -"rend2" for the first repetition etc.
@@ -235,11 +254,71 @@ std::vector<std::string> ExpansionMap::GetExpansionIDsForElement(const std::stri
     }
 }
 
+std::string ExpansionMap::GetRepeatID(const std::string &xmlId, int repeat) const
+{
+    if (repeat < 2) return xmlId;
+    auto list = m_map.find(xmlId);
+    if ((list == m_map.end()) || (repeat > (int)list->second.size())) return xmlId;
+    return list->second.at(repeat - 1);
+}
+
+std::vector<int> ExpansionMap::GetSharedPlaybackOrder(const std::vector<const Object *> &objects) const
+{
+    std::map<const Object *, int> positions;
+    std::map<std::string, int> positionsByID;
+    for (int i = 0; i < (int)objects.size(); ++i) {
+        positions[objects.at(i)] = i;
+        positionsByID[objects.at(i)->GetID()] = i;
+    }
+
+    // The repeated elements are resolved by ID in the objects
+    std::vector<std::pair<int, int>> sharedRepeats;
+    for (const auto &[prevSectID, currSectID] : m_sharedRepeats) {
+        auto prevSect = positionsByID.find(prevSectID);
+        auto currSect = positionsByID.find(currSectID);
+        if ((prevSect == positionsByID.end()) || (currSect == positionsByID.end())) {
+            sharedRepeats.push_back({ -1, -1 });
+            continue;
+        }
+        sharedRepeats.push_back({ prevSect->second, currSect->second });
+    }
+
+    std::vector<int> playbackOrder;
+    playbackOrder.reserve(objects.size());
+
+    // Add the objects from first to last and the repeats following them. A repeat includes only the repeats added
+    // before itself to the expansion, as a clone would do, which also ends the recursion. The repeats following the
+    // last object of a repeat are not part of it.
+    std::function<void(int, int, int)> addObjects = [&](int first, int last, int repeatCount) {
+        for (int i = first; i <= last; ++i) {
+            playbackOrder.push_back(i);
+            if ((i == last) && (repeatCount < (int)sharedRepeats.size())) break;
+            for (int r = 0; r < repeatCount; ++r) {
+                const auto &[prevSect, currSect] = sharedRepeats.at(r);
+                if ((prevSect == -1) || (GetLastObject(objects.at(prevSect)) != objects.at(i))) continue;
+                auto end = positions.find(GetLastObject(objects.at(currSect)));
+                if (end == positions.end()) continue;
+                addObjects(currSect, end->second, r);
+            }
+        }
+    };
+    addObjects(0, (int)objects.size() - 1, (int)sharedRepeats.size());
+
+    return playbackOrder;
+}
+
 bool ExpansionMap::HasExpansionMap()
 {
     return (m_map.empty()) ? false : true;
 }
 
+const Object *ExpansionMap::GetLastObject(const Object *object)
+{
+    const SystemMilestoneInterface *interface = dynamic_cast<const SystemMilestoneInterface *>(object);
+    if (interface && interface->IsSystemMilestone()) return interface->GetEnd();
+    return object;
+}
+
 void ExpansionMap::GetIDList(Object *object, std::vector<std::string> &idList)
 {
     for (Object *o : object->GetChildren()) {
@@ -868,6 +868,92 @@ std::pair<int, int> FloatingCurvePositioner::CalcDirectionalLeftRightAdjustment(
     return { leftAdjustment, rightAdjustment };
 }
 
+std::vector<CurveAdjustment> FloatingCurvePositioner::CalcSpannedElementAdjustments(int margin) const
+{
+    const int count = (int)m_spannedElements.size();
+    std::vector<CurveAdjustment> adjustments(count, { 0, 0, false });
+
+    Point points[4];
+    // We need to get the points because then stored points are relative
+    this->GetPoints(points);
+
+    // for lisability
+    const Point p1 = points[0];
+    const Point p2 = points[3];
+
+    Point topBezier[4], bottomBezier[4];
+    BoundingBox::CalcThickBezier(points, this->GetThickness(), topBezier, bottomBezier);
+
+    // Gather the bounding boxes overlapping horizontally with the curve
+    // Elements below the curve are compared with its bottom bezier, the other ones with its top bezier
+    std::vector<int> indices;
+    std::vector<int> lefts, rights, boxYs, positionIndices;
+    std::vector<bool> belows;
+    std::vector<int> topPositions, bottomPositions;
+    Accessor type = SELF;
+    for (int i = 0; i < count; ++i) {
+        const CurveSpannedElement *spannedElement = m_spannedElements.at(i);
+        if (spannedElement->m_discarded) continue;
+
+        const BoundingBox *boundingBox = spannedElement->m_boundingBox;
+        assert(boundingBox);
+        assert(boundingBox->HasSelfBB());
+
+        const int left = boundingBox->GetLeftBy(type);
+        const int right = boundingBox->GetRightBy(type);
+        if ((p2.x < left - margin) || (p1.x > right + margin)) continue;
+
+        // For selected types use the cut out boundary
+        int boxY = spannedElement->m_isBelow ? boundingBox->GetTopBy(type) : boundingBox->GetBottomBy(type);
+        if (boundingBox->Is(ACCID)) {
+            const Resources *resources = vrv_cast<const Object *>(boundingBox)->GetDocResources();
+            if (resources) {
+                boxY = spannedElement->m_isBelow ? boundingBox->GetCutOutTop(*resources)
+                                                 : boundingBox->GetCutOutBottom(*resources);
+            }
+        }
+
+        std::vector<int> &positions = spannedElement->m_isBelow ? bottomPositions : topPositions;
+        indices.push_back(i);
+        lefts.push_back(left);
+        rights.push_back(right);
+        boxYs.push_back(boxY);
+        belows.push_back(spannedElement->m_isBelow);
+        positionIndices.push_back((int)positions.size());
+        positions.push_back(left);
+        positions.push_back(right);
+    }
+
+    const std::vector<int> topValues = BoundingBox::CalcBezierAtPositions(topBezier, topPositions);
+    const std::vector<int> bottomValues = BoundingBox::CalcBezierAtPositions(bottomBezier, bottomPositions);
+
+    // Now calculate the left and right adjustments
+    for (int j = 0; j < (int)indices.size(); ++j) {
+        const std::vector<int> &values = belows.at(j) ? bottomValues : topValues;
+        const int k = positionIndices.at(j);
+        int leftY = (p1.x < lefts.at(j)) ? values.at(k) : p1.y;
+        int rightY = (p2.x > rights.at(j)) ? values.at(k + 1) : p2.y;
+
+        CurveAdjustment &adjustment = adjustments.at(indices.at(j));
+        if (belows.at(j)) {
+            leftY -= margin;
+            rightY -= margin;
+            adjustment.left = std::max(boxYs.at(j) - leftY, 0);
+            adjustment.right = std::max(boxYs.at(j) - rightY, 0);
+        }
+        else {
+            leftY += margin;
+            rightY += margin;
+            adjustment.left = std::max(leftY - boxYs.at(j), 0);
+            adjustment.right = std::max(rightY - boxYs.at(j), 0);
+        }
+        // Everything is above or below - we can discard the element
+        adjustment.discard = ((adjustment.left == 0) && (adjustment.right == 0));
+    }
+
+    return adjustments;
+}
+
 void FloatingCurvePositioner::GetPoints(Point points[4]) const
 {
     points[0] = m_points[0];
@@ -25,6 +25,7 @@
 #include "miscfunctor.h"
 #include "note.h"
 #include "options.h"
+#include "profiler.h"
 #include "smufl.h"
 #include "staff.h"
 #include "staffdef.h"
@@ -504,11 +505,13 @@ FunctorCode GraceAligner::AcceptEnd(ConstFunctor &functor) const
 Alignment::Alignment() : Object(ALIGNMENT)
 {
     this->Reset();
+    Profiler::Count(PROFILER_ALIGNMENTS_CREATED);
 }
 
 Alignment::Alignment(double time, AlignmentType type) : Object(ALIGNMENT)
 {
     this->Reset();
+    Profiler::Count(PROFILER_ALIGNMENTS_CREATED);
     m_time = time;
     m_type = type;
 }
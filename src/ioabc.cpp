@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <sstream>
@@ -50,6 +51,7 @@
 #include "syl.h"
 #include "tempo.h"
 #include "text.h"
+#include "threadpool.h"
 #include "tie.h"
 #include "trill.h"
 #include "tuplet.h"
@@ -66,16 +68,31 @@ namespace vrv {
 
 #ifndef NO_ABC_SUPPORT
 
-// Global variables:
-std::string abcLine;
+// Global variables (per thread since the tunes of a collection can be imported concurrently):
+thread_local std::string abcLine;
 #define MAX_DATA_LEN 1024 // One line of the abc file would not be that long!
-char dataKey[MAX_DATA_LEN];
-char dataValue[MAX_DATA_LEN]; // ditto as above
+thread_local char dataKey[MAX_DATA_LEN];
+thread_local char dataValue[MAX_DATA_LEN]; // ditto as above
 
 const std::string pitch = "FCGDAEB";
 const std::string shorthandDecoration = ".~HLMOPSTuv";
-std::string keyPitchAlter = "";
-int keyPitchAlterAmount = 0;
+thread_local std::string keyPitchAlter = "";
+thread_local int keyPitchAlterAmount = 0;
+
+// The number of tunes of a collection imported before their mdivs are moved to the document
+#define ABC_TUNE_BATCH_SIZE 64
+
+/**
+ * A read-only stream buffer over a range of the input for parsing a tune without copying it
+ */
+class ABCTuneBuffer : public std::streambuf {
+public:
+    ABCTuneBuffer(const char *data, size_t length)
+    {
+        char *begin = const_cast<char *>(data);
+        this->setg(begin, begin, begin + length);
+    }
+};
 
 //----------------------------------------------------------------------------
 // ABCInput
@@ -92,11 +109,111 @@ ABCInput::~ABCInput() {}
 
 bool ABCInput::Import(const std::string &abc)
 {
+    m_tunes = SplitTunes(abc);
+    // Without a thread pool, collections are parsed sequentially as a single stream
+    if ((m_tunes.size() > 1) && m_doc->GetThreadPool()) {
+        this->ImportCollection(abc);
+        return true;
+    }
+
     std::istringstream in_stream(abc);
     ParseABC(in_stream);
     return true;
 }
 
+std::vector<ABCTune> ABCInput::SplitTunes(const std::string &abc)
+{
+    std::vector<ABCTune> tunes;
+
+    size_t lineStart = 0;
+    int lineNum = 1;
+    while (lineStart < abc.size()) {
+        size_t lineEnd = abc.find('\n', lineStart);
+        if (lineEnd == std::string::npos) lineEnd = abc.size();
+
+        const char *line = abc.data() + lineStart;
+        const size_t lineLength = lineEnd - lineStart;
+        if ((lineLength >= 2) && (line[1] == ':')) {
+            if (line[0] == 'X') {
+                if (!tunes.empty()) tunes.back().m_length = lineStart - tunes.back().m_offset;
+                ABCTune tune;
+                tune.m_n = atoi(std::string(line + 2, lineLength - 2).c_str());
+                tune.m_offset = lineStart;
+                tune.m_line = lineNum;
+                tunes.push_back(tune);
+            }
+            else if ((line[0] == 'T') && !tunes.empty() && tunes.back().m_title.empty()) {
+                std::string title(line + 2, lineLength - 2);
+                const size_t first = title.find_first_not_of(' ');
+                const size_t last = title.find_last_not_of(" \r");
+                tunes.back().m_title = (first == std::string::npos) ? "" : title.substr(first, last - first + 1);
+            }
+        }
+
+        lineStart = lineEnd + 1;
+        ++lineNum;
+    }
+    if (!tunes.empty()) tunes.back().m_length = abc.size() - tunes.back().m_offset;
+
+    return tunes;
+}
+
+void ABCInput::ImportCollection(const std::string &abc)
+{
+    // initialize doc
+    m_doc->Reset();
+    m_doc->SetType(Raw);
+    this->CreateHeader();
+
+    // Read the file header once, its fields apply to every tune
+    ABCTuneBuffer headerBuffer(abc.data(), m_tunes.front().m_offset);
+    std::istream header(&headerBuffer);
+    this->ReadFileHeader(header);
+
+    // Draw the seeds of the ids in the order of the tunes (and one for resuming afterwards)
+    // This makes the ids independent of the number of threads and of the order in which the tunes are processed
+    std::vector<uint32_t> seeds(m_tunes.size() + 1);
+    for (uint32_t &seed : seeds) seed = Object::GenerateSeed();
+
+    ThreadPool *threadPool = m_doc->GetThreadPool();
+    assert(threadPool);
+    for (size_t first = 0; first < m_tunes.size(); first += ABC_TUNE_BATCH_SIZE) {
+        const int count = (int)std::min(m_tunes.size() - first, (size_t)ABC_TUNE_BATCH_SIZE);
+        std::vector<Doc *> tuneDocs(count, NULL);
+
+        auto importTune = [this, &abc, &seeds, &tuneDocs, first](int i) {
+            const ABCTune &tune = m_tunes.at(first + i);
+            Doc *tuneDoc = new Doc();
+            tuneDoc->SetOptions(m_doc->GetOptions());
+            Object::SeedID(seeds.at(first + i));
+            ABCInput tuneInput(tuneDoc);
+            tuneInput.m_fileHeader = m_fileHeader;
+            tuneInput.m_lineNum = tune.m_line;
+            tuneInput.CreateHeader();
+            ABCTuneBuffer buffer(abc.data() + tune.m_offset, tune.m_length);
+            std::istream infile(&buffer);
+            tuneInput.ParseTunes(infile);
+            tuneDocs.at(i) = tuneDoc;
+        };
+        threadPool->Run(count, importTune);
+
+        // Move the mdivs and the work entries in the order of the tunes
+        for (Doc *tuneDoc : tuneDocs) {
+            pugi::xml_node workList = tuneDoc->m_header.child("meiHead").child("workList");
+            for (pugi::xml_node work : workList.children("work")) {
+                m_workList.append_copy(work);
+            }
+            while (tuneDoc->GetChildCount() > 0) {
+                m_doc->AddChild(tuneDoc->DetachChild(0));
+            }
+            delete tuneDoc;
+        }
+    }
+    Object::SeedID(seeds.back());
+
+    m_doc->ConvertToPageBasedDoc();
+}
+
 //////////////////////////////
 //
 // parseABC --
@@ -108,9 +225,36 @@ void ABCInput::ParseABC(std::istream &infile)
     m_doc->Reset();
     m_doc->SetType(Raw);
 
+    CreateHeader();
+    this->ParseTunes(infile);
+
+    m_doc->ConvertToPageBasedDoc();
+}
+
+void ABCInput::ReadFileHeader(std::istream &infile)
+{
+    while (!infile.eof()) {
+        std::getline(infile, abcLine);
+        ++m_lineNum;
+        this->AddFileHeaderField(abcLine);
+    }
+}
+
+void ABCInput::AddFileHeaderField(const std::string &line)
+{
+    if ((line.length() < 3) || (line.at(1) != ':') || (line.at(0) == '%')) return;
+    // the fields specific to a tune are ignored
+    if ((line.at(0) == 'K') || (line.at(0) == 'T') || (line.at(0) == 'w') || (line.at(0) == 'W')
+        || (line.at(0) == 'X')) {
+        return;
+    }
+    m_fileHeader.push_back(std::make_pair(line, m_lineNum));
+}
+
+void ABCInput::ParseTunes(std::istream &infile)
+{
     Score *score = NULL;
     Section *section = NULL;
-    CreateHeader();
     while (!infile.eof()) {
         std::getline(infile, abcLine);
         ++m_lineNum;
@@ -137,6 +281,8 @@ void ABCInput::ParseABC(std::istream &infile)
         }
         else if (!m_mdiv || !score || !section) {
             // if m_div is not initialized - we didn't read X element, so continue until we do
+            // the information fields before the first X element are the file header
+            if (!m_mdiv) this->AddFileHeaderField(abcLine);
             continue;
         }
         if (abcLine.empty() || (abcLine.find_first_not_of(' ') == std::string::npos)) {
@@ -170,8 +316,6 @@ void ABCInput::ParseABC(std::istream &infile)
     m_composer.clear();
     m_info.clear();
     m_title.clear();
-
-    m_doc->ConvertToPageBasedDoc();
 }
 
 /**********************************
@@ -828,6 +972,14 @@ void ABCInput::parseReferenceNumber(const std::string &referenceNumberString)
     m_info.clear();
     m_origin.clear();
     m_title.clear();
+
+    // apply the fields of the file header, which the fields of the tune header can override
+    const int lineNum = m_lineNum;
+    for (const auto &[line, fieldLineNum] : m_fileHeader) {
+        m_lineNum = fieldLineNum;
+        this->readInformationField(line.at(0), line.substr(2));
+    }
+    m_lineNum = lineNum;
 }
 
 void ABCInput::PrintInformationFields(Score *score)
@@ -697,8 +697,10 @@ bool HumdrumInput::convertHumdrum()
     for (int i = 0; i < m_infiles.getCount(); ++i) {
         if (m_infiles[i].hasGlobalFilters()) {
             filter.run(m_infiles[i]);
-            if (filter.hasHumdrumText()) {
-                m_infiles[i].readString(filter.getHumdrumText());
+            // Get the text once since hasHumdrumText() would copy it as well
+            const std::string text = filter.getHumdrumText();
+            if (!text.empty()) {
+                m_infiles[i].readString(text);
             }
             else {
                 // should have auto updated itself in the filter.
@@ -710,8 +712,9 @@ bool HumdrumInput::convertHumdrum()
     // at the universal level.
     if (m_infiles.hasUniversalFilters()) {
         filter.runUniversal(m_infiles);
-        if (filter.hasHumdrumText()) {
-            m_infiles.readString(filter.getHumdrumText());
+        const std::string text = filter.getHumdrumText();
+        if (!text.empty()) {
+            m_infiles.readString(text);
         }
     }
 
@@ -720,8 +723,9 @@ bool HumdrumInput::convertHumdrum()
     for (int i = 0; i < m_infiles.getCount(); ++i) {
         if (hasNoStaves(m_infiles[i])) {
             kernify.run(m_infiles[i]);
-            if (kernify.hasHumdrumText()) {
-                m_infiles[i].readString(kernify.getHumdrumText());
+            const std::string text = kernify.getHumdrumText();
+            if (!text.empty()) {
+                m_infiles[i].readString(text);
             }
             else {
                 // should have auto updated itself in the kernify filter.
@@ -155,6 +155,100 @@ namespace vrv {
 const std::vector<std::string> MEIInput::s_editorialElementNames = { "abbr", "add", "app", "annot", "choice", "corr",
     "damage", "del", "expan", "orig", "ref", "reg", "restore", "sic", "subst", "supplied", "unclear" };
 
+const std::unordered_map<std::string, std::pair<MEIInput::ElementReader, int>> MEIInput::s_elementReaders = {
+    { "accid", { &MEIInput::ReadAccid, CHILDREN_LAYER } },
+    { "anchoredText", { &MEIInput::ReadAnchoredText, CHILDREN_MEASURE } },
+    { "arpeg", { &MEIInput::ReadArpeg, CHILDREN_MEASURE } },
+    { "artic", { &MEIInput::ReadArtic, CHILDREN_LAYER } },
+    { "barLine", { &MEIInput::ReadBarLine, CHILDREN_LAYER } },
+    { "beam", { &MEIInput::ReadBeam, CHILDREN_LAYER } },
+    { "beamSpan", { &MEIInput::ReadBeamSpan, CHILDREN_MEASURE } },
+    { "beatRpt", { &MEIInput::ReadBeatRpt, CHILDREN_LAYER } },
+    { "bracketSpan", { &MEIInput::ReadBracketSpan, CHILDREN_MEASURE } },
+    { "breath", { &MEIInput::ReadBreath, CHILDREN_MEASURE } },
+    { "bTrem", { &MEIInput::ReadBTrem, CHILDREN_LAYER } },
+    { "caesura", { &MEIInput::ReadCaesura, CHILDREN_MEASURE } },
+    { "chord", { &MEIInput::ReadChord, CHILDREN_LAYER } },
+    { "clef", { &MEIInput::ReadClef, CHILDREN_LAYER | CHILDREN_SCOREDEF | CHILDREN_STAFFDEF } },
+    { "course", { &MEIInput::ReadCourse, CHILDREN_TUNING } },
+    { "custos", { &MEIInput::ReadCustos, CHILDREN_LAYER } },
+    { "dir", { &MEIInput::ReadDir, CHILDREN_MEASURE } },
+    { "dot", { &MEIInput::ReadDot, CHILDREN_LAYER } },
+    { "dynam", { &MEIInput::ReadDynam, CHILDREN_MEASURE } },
+    { "f", { &MEIInput::ReadF, CHILDREN_FB } },
+    { "fermata", { &MEIInput::ReadFermata, CHILDREN_MEASURE } },
+    { "fig", { &MEIInput::ReadFig, CHILDREN_RUNNING | CHILDREN_TEXT } },
+    { "fing", { &MEIInput::ReadFing, CHILDREN_MEASURE } },
+    { "fTrem", { &MEIInput::ReadFTrem, CHILDREN_LAYER } },
+    { "gliss", { &MEIInput::ReadGliss, CHILDREN_MEASURE } },
+    { "graceGrp", { &MEIInput::ReadGraceGrp, CHILDREN_LAYER } },
+    { "graphic", { &MEIInput::ReadGraphic, CHILDREN_SYMBOLDEF } },
+    { "grpSym", { &MEIInput::ReadGrpSym, CHILDREN_SCOREDEF | CHILDREN_STAFFGRP } },
+    { "hairpin", { &MEIInput::ReadHairpin, CHILDREN_MEASURE } },
+    { "halfmRpt", { &MEIInput::ReadHalfmRpt, CHILDREN_LAYER } },
+    { "harm", { &MEIInput::ReadHarm, CHILDREN_MEASURE } },
+    { "instrDef", { &MEIInput::ReadInstrDef, CHILDREN_LAYERDEF | CHILDREN_STAFFDEF | CHILDREN_STAFFGRP } },
+    { "keyAccid", { &MEIInput::ReadKeyAccid, CHILDREN_LAYER } },
+    { "keySig", { &MEIInput::ReadKeySig, CHILDREN_LAYER | CHILDREN_SCOREDEF | CHILDREN_STAFFDEF } },
+    { "label", { &MEIInput::ReadLabel, CHILDREN_LAYER | CHILDREN_LAYERDEF | CHILDREN_STAFFDEF | CHILDREN_STAFFGRP } },
+    { "labelAbbr",
+        { &MEIInput::ReadLabelAbbr, CHILDREN_LAYER | CHILDREN_LAYERDEF | CHILDREN_STAFFDEF | CHILDREN_STAFFGRP } },
+    { "layer", { &MEIInput::ReadLayer, CHILDREN_STAFF } },
+    { "layerDef", { &MEIInput::ReadLayerDef, CHILDREN_STAFFDEF } },
+    { "lb", { &MEIInput::ReadLb, CHILDREN_TEXT } },
+    { "ligature", { &MEIInput::ReadLigature, CHILDREN_LAYER } },
+    { "lv", { &MEIInput::ReadLv, CHILDREN_MEASURE } },
+    { "mensur", { &MEIInput::ReadMensur, CHILDREN_LAYER | CHILDREN_SCOREDEF | CHILDREN_STAFFDEF } },
+    { "meterSig",
+        { &MEIInput::ReadMeterSig, CHILDREN_LAYER | CHILDREN_METERSIGGRP | CHILDREN_SCOREDEF | CHILDREN_STAFFDEF } },
+    { "meterSigGrp", { &MEIInput::ReadMeterSigGrp, CHILDREN_LAYER | CHILDREN_SCOREDEF | CHILDREN_STAFFDEF } },
+    { "mNum", { &MEIInput::ReadMNum, CHILDREN_MEASURE } },
+    { "mordent", { &MEIInput::ReadMordent, CHILDREN_MEASURE } },
+    { "mRest", { &MEIInput::ReadMRest, CHILDREN_LAYER } },
+    { "mRpt", { &MEIInput::ReadMRpt, CHILDREN_LAYER } },
+    { "mRpt2", { &MEIInput::ReadMRpt2, CHILDREN_LAYER } },
+    { "mSpace", { &MEIInput::ReadMSpace, CHILDREN_LAYER } },
+    { "multiRest", { &MEIInput::ReadMultiRest, CHILDREN_LAYER } },
+    { "multiRpt", { &MEIInput::ReadMultiRpt, CHILDREN_LAYER } },
+    { "nc", { &MEIInput::ReadNc, CHILDREN_LAYER } },
+    { "neume", { &MEIInput::ReadNeume, CHILDREN_LAYER } },
+    { "note", { &MEIInput::ReadNote, CHILDREN_LAYER } },
+    { "num", { &MEIInput::ReadNum, CHILDREN_TEXT } },
+    { "octave", { &MEIInput::ReadOctave, CHILDREN_MEASURE } },
+    { "ornam", { &MEIInput::ReadOrnam, CHILDREN_MEASURE } },
+    { "pedal", { &MEIInput::ReadPedal, CHILDREN_MEASURE } },
+    { "pgFoot", { &MEIInput::ReadPgFoot, CHILDREN_SCOREDEF } },
+    { "pgFoot2", { &MEIInput::ReadPgFoot2, CHILDREN_SCOREDEF } },
+    { "pgHead", { &MEIInput::ReadPgHead, CHILDREN_SCOREDEF } },
+    { "pgHead2", { &MEIInput::ReadPgHead2, CHILDREN_SCOREDEF } },
+    { "phrase", { &MEIInput::ReadPhrase, CHILDREN_MEASURE } },
+    { "pitchInflection", { &MEIInput::ReadPitchInflection, CHILDREN_MEASURE } },
+    { "plica", { &MEIInput::ReadPlica, CHILDREN_LAYER } },
+    { "proport", { &MEIInput::ReadProport, CHILDREN_LAYER } },
+    { "reh", { &MEIInput::ReadReh, CHILDREN_MEASURE } },
+    { "rend", { &MEIInput::ReadRend, CHILDREN_RUNNING | CHILDREN_TEXT } },
+    { "rest", { &MEIInput::ReadRest, CHILDREN_LAYER } },
+    { "slur", { &MEIInput::ReadSlur, CHILDREN_MEASURE } },
+    { "space", { &MEIInput::ReadSpace, CHILDREN_LAYER } },
+    { "staff", { &MEIInput::ReadStaff, CHILDREN_MEASURE } },
+    { "staffGrp", { &MEIInput::ReadStaffGrp, CHILDREN_SCOREDEF } },
+    { "stem", { &MEIInput::ReadStem, CHILDREN_LAYER } },
+    { "svg", { &MEIInput::ReadSvg, CHILDREN_SYMBOLDEF | CHILDREN_TEXT } },
+    { "syl", { &MEIInput::ReadSyl, CHILDREN_LAYER } },
+    { "syllable", { &MEIInput::ReadSyllable, CHILDREN_LAYER } },
+    { "symbol", { &MEIInput::ReadSymbol, CHILDREN_TEXT } },
+    { "symbolTable", { &MEIInput::ReadSymbolTable, CHILDREN_SCOREDEF } },
+    { "tabDurSym", { &MEIInput::ReadTabDurSym, CHILDREN_LAYER } },
+    { "tabGrp", { &MEIInput::ReadTabGrp, CHILDREN_LAYER } },
+    { "tempo", { &MEIInput::ReadTempo, CHILDREN_MEASURE } },
+    { "tie", { &MEIInput::ReadTie, CHILDREN_MEASURE } },
+    { "trill", { &MEIInput::ReadTrill, CHILDREN_MEASURE } },
+    { "tuning", { &MEIInput::ReadTuning, CHILDREN_STAFFDEF } },
+    { "tuplet", { &MEIInput::ReadTuplet, CHILDREN_LAYER } },
+    { "turn", { &MEIInput::ReadTurn, CHILDREN_MEASURE } },
+    { "verse", { &MEIInput::ReadVerse, CHILDREN_LAYER } },
+};
+
 //----------------------------------------------------------------------------
 // MEIOutput
 //----------------------------------------------------------------------------
@@ -175,7 +269,11 @@ MEIOutput::~MEIOutput() {}
 
 bool MEIOutput::Export()
 {
+    return this->Export(m_streamStringOutput);
+}
 
+bool MEIOutput::Export(std::ostream &output)
+{
     if (m_removeIds) {
         FindAllReferencedObjectsFunctor findAllReferencedObjects(&m_referredObjects);
         // When saving page-based MEI we also want to keep IDs for milestone elements
@@ -268,7 +366,7 @@ bool MEIOutput::Export()
         }
 
         std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-        meiDoc.save(m_streamStringOutput, indent.c_str(), output_flags);
+        meiDoc.save(output, indent.c_str(), output_flags);
     }
     catch (char *str) {
         LogError("%s", str);
@@ -289,6 +387,15 @@ std::string MEIOutput::GetOutput()
     return output;
 }
 
+bool MEIOutput::GetOutput(std::ostream &output)
+{
+    const bool success = this->Export(output);
+
+    this->Reset();
+
+    return success;
+}
+
 bool MEIOutput::WriteObject(Object *object)
 {
     if (this->IsScoreBasedMEI() && this->HasFilter()) {
@@ -3298,18 +3405,26 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
 {
     m_hasScoreDef = false;
     m_readingScoreBased = false;
+    m_discardReadNodes = false;
+    m_expandExpansions = true;
     m_meiversion = meiVersion_MEIVERSION_NONE;
 }
 
 MEIInput::~MEIInput() {}
 
 bool MEIInput::Import(const std::string &mei)
+{
+    return this->ImportBuffer(mei.c_str(), mei.size());
+}
+
+bool MEIInput::ImportBuffer(const char *data, size_t length)
 {
     try {
         m_doc->Reset();
         m_doc->SetType(Raw);
         pugi::xml_document doc;
-        doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+        doc.load_buffer(
+            data, length, (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol, pugi::encoding_utf8);
         pugi::xml_node root = doc.first_child();
         return this->ReadDoc(root);
     }
@@ -3890,9 +4005,15 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
         }
 
         const bool allMdivVisible = m_doc->GetOptions()->m_mdivAll.GetValue();
+        // The XML nodes are discarded once read - the XML tree and the Doc tree then do not need to be kept in full
+        m_discardReadNodes = true;
         success = this->ReadMdivChildren(m_doc, body, allMdivVisible);
+        m_discardReadNodes = false;
+        // Discard what remains of the body before the Doc is processed
+        m_selectedMdiv = pugi::xml_node();
+        music.remove_child(body);
 
-        if (success) {
+        if (success && m_expandExpansions) {
             m_doc->ExpandExpansions();
         }
 
@@ -4198,9 +4319,10 @@ bool MEIInput::ReadMdivChildren(Object *parent, pugi::xml_node parentNode, bool
         return true;
     }
 
-    pugi::xml_node current;
+    pugi::xml_node current, next;
     bool success = true;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    for (current = parentNode.first_child(); current; current = next) {
+        next = current.next_sibling();
         // We make the mdiv visible if already set or if matching the desired selection
         bool makeVisible = (isVisible || (m_selectedMdiv == current));
         if (!success) break;
@@ -4209,7 +4331,10 @@ bool MEIInput::ReadMdivChildren(Object *parent, pugi::xml_node parentNode, bool
         }
         else if (std::string(current.name()) == "score") {
             // Possibly skip content on load
-            if (!isVisible && m_doc->GetOptions()->m_loadSelectedMdivOnly.GetValue()) continue;
+            if (!isVisible && m_doc->GetOptions()->m_loadSelectedMdivOnly.GetValue()) {
+                if (m_discardReadNodes) parentNode.remove_child(current);
+                continue;
+            }
             // Read only the first score
             success = this->ReadScore(parent, current);
             if (parentNode.last_child() != current) {
@@ -4254,8 +4379,9 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
 
     if (!success) return false;
 
-    pugi::xml_node current;
-    for (current = scoreDef.next_sibling(); current; current = current.next_sibling()) {
+    pugi::xml_node current, next;
+    for (current = scoreDef.next_sibling(); current; current = next) {
+        next = current.next_sibling();
         if (!success) break;
         this->NormalizeAttributes(current);
         std::string elementName = std::string(current.name());
@@ -4283,6 +4409,7 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
         else {
             LogWarning("Element <%s> within <score> is not supported and will be ignored ", elementName.c_str());
         }
+        if (m_discardReadNodes) score.remove_child(current);
     }
 
     this->ReadUnsupportedAttr(score, vrvScore);
@@ -4314,9 +4441,10 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
         || dynamic_cast<EditorialElement *>(parent));
 
     bool success = true;
-    pugi::xml_node current;
+    pugi::xml_node current, next;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    for (current = parentNode.first_child(); current; current = next) {
+        next = current.next_sibling();
         if (!success) break;
         this->NormalizeAttributes(current);
         // editorial
@@ -4375,6 +4503,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
         else {
             LogWarning("Unsupported '<%s>' within <section>", current.name());
         }
+        if (m_discardReadNodes) parentNode.remove_child(current);
     }
     return success;
 }
@@ -4729,45 +4858,9 @@ bool MEIInput::ReadScoreDefChildren(Object *parent, pugi::xml_node parentNode)
         if (this->IsEditorialElementName(current.name())) {
             success = this->ReadEditorialElement(parent, current, EDITORIAL_SCOREDEF);
         }
-        // clef, keySig, etc.
-        else if (std::string(current.name()) == "clef") {
-            success = this->ReadClef(parent, current);
-        }
-        else if (std::string(current.name()) == "grpSym") {
-            success = this->ReadGrpSym(parent, current);
-        }
-        else if (std::string(current.name()) == "keySig") {
-            success = this->ReadKeySig(parent, current);
-        }
-        else if (std::string(current.name()) == "mensur") {
-            success = this->ReadMensur(parent, current);
-        }
-        else if (std::string(current.name()) == "meterSig") {
-            success = this->ReadMeterSig(parent, current);
-        }
-        else if (std::string(current.name()) == "meterSigGrp") {
-            success = this->ReadMeterSigGrp(parent, current);
-        }
-        // headers and footers
-        else if (std::string(current.name()) == "pgFoot") {
-            success = this->ReadPgFoot(parent, current);
-        }
-        else if (std::string(current.name()) == "pgFoot2") {
-            success = this->ReadPgFoot2(parent, current);
-        }
-        else if (std::string(current.name()) == "pgHead") {
-            success = this->ReadPgHead(parent, current);
-        }
-        else if (std::string(current.name()) == "pgHead2") {
-            success = this->ReadPgHead2(parent, current);
-        }
-        // symbolTable
-        else if (std::string(current.name()) == "symbolTable") {
-            success = this->ReadSymbolTable(parent, current);
-        }
         // content
-        else if (std::string(current.name()) == "staffGrp") {
-            success = this->ReadStaffGrp(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_SCOREDEF)) {
+            success = (this->*reader)(parent, current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -4826,17 +4919,8 @@ bool MEIInput::ReadStaffGrpChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadEditorialElement(parent, current, EDITORIAL_STAFFGRP);
         }
         // content
-        else if (std::string(current.name()) == "grpSym") {
-            success = this->ReadGrpSym(parent, current);
-        }
-        else if (std::string(current.name()) == "instrDef") {
-            success = this->ReadInstrDef(parent, current);
-        }
-        else if (std::string(current.name()) == "label") {
-            success = this->ReadLabel(parent, current);
-        }
-        else if (std::string(current.name()) == "labelAbbr") {
-            success = this->ReadLabelAbbr(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_STAFFGRP)) {
+            success = (this->*reader)(parent, current);
         }
         else if (std::string(current.name()) == "staffGrp") {
             success = this->ReadStaffGrp(parent, current);
@@ -4960,11 +5044,8 @@ bool MEIInput::ReadRunningChildren(Object *parent, pugi::xml_node parentNode, Ob
             success = this->ReadEditorialElement(parent, xmlElement, EDITORIAL_RUNNING, filter);
         }
         // content
-        else if (elementName == "fig") {
-            success = this->ReadFig(parent, xmlElement);
-        }
-        else if (elementName == "rend") {
-            success = this->ReadRend(parent, xmlElement);
+        else if (ElementReader reader = this->GetElementReader(elementName, CHILDREN_RUNNING)) {
+            success = (this->*reader)(parent, xmlElement);
         }
         // xml comment
         else if (elementName == "") {
@@ -5021,37 +5102,9 @@ bool MEIInput::ReadStaffDefChildren(Object *parent, pugi::xml_node parentNode)
     pugi::xml_node current;
     for (current = parentNode.first_child(); current; current = current.next_sibling()) {
         if (!success) break;
-        // clef, keySig, etc.
-        else if (std::string(current.name()) == "clef") {
-            success = this->ReadClef(parent, current);
-        }
-        else if (std::string(current.name()) == "keySig") {
-            success = this->ReadKeySig(parent, current);
-        }
-        else if (std::string(current.name()) == "mensur") {
-            success = this->ReadMensur(parent, current);
-        }
-        else if (std::string(current.name()) == "meterSig") {
-            success = this->ReadMeterSig(parent, current);
-        }
-        else if (std::string(current.name()) == "meterSigGrp") {
-            success = this->ReadMeterSigGrp(parent, current);
-        }
         // content
-        else if (std::string(current.name()) == "instrDef") {
-            success = this->ReadInstrDef(parent, current);
-        }
-        else if (std::string(current.name()) == "label") {
-            success = this->ReadLabel(parent, current);
-        }
-        else if (std::string(current.name()) == "labelAbbr") {
-            success = this->ReadLabelAbbr(parent, current);
-        }
-        else if (std::string(current.name()) == "layerDef") {
-            success = this->ReadLayerDef(parent, current);
-        }
-        else if (std::string(current.name()) == "tuning") {
-            success = this->ReadTuning(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_STAFFDEF)) {
+            success = (this->*reader)(parent, current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -5087,8 +5140,8 @@ bool MEIInput::ReadTuningChildren(Object *parent, pugi::xml_node parentNode)
     for (current = parentNode.first_child(); current; current = current.next_sibling()) {
         if (!success) break;
         // content
-        else if (std::string(current.name()) == "course") {
-            success = this->ReadCourse(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_TUNING)) {
+            success = (this->*reader)(parent, current);
         }
         else {
             LogWarning("Unsupported '<%s>' within <staffGrp>", current.name());
@@ -5208,14 +5261,9 @@ bool MEIInput::ReadLayerDefChildren(Object *parent, pugi::xml_node parentNode)
         const std::string currentName = current.name();
         if (!success)
             break;
-        else if (currentName == "instrDef") {
-            success = this->ReadInstrDef(parent, current);
-        }
-        else if (currentName == "label") {
-            success = this->ReadLabel(parent, current);
-        }
-        else if (currentName == "labelAbbr") {
-            success = this->ReadLabelAbbr(parent, current);
+        // content
+        else if (ElementReader reader = this->GetElementReader(currentName, CHILDREN_LAYERDEF)) {
+            success = (this->*reader)(parent, current);
         }
         // xml comment
         else if (currentName == "") {
@@ -5275,89 +5323,8 @@ bool MEIInput::ReadMeasureChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadEditorialElement(parent, current, EDITORIAL_MEASURE);
         }
         // content
-        else if (currentName == "anchoredText") {
-            success = this->ReadAnchoredText(parent, current);
-        }
-        else if (currentName == "arpeg") {
-            success = this->ReadArpeg(parent, current);
-        }
-        else if (currentName == "beamSpan") {
-            success = this->ReadBeamSpan(parent, current);
-        }
-        else if (currentName == "bracketSpan") {
-            success = this->ReadBracketSpan(parent, current);
-        }
-        else if (currentName == "breath") {
-            success = this->ReadBreath(parent, current);
-        }
-        else if (currentName == "caesura") {
-            success = this->ReadCaesura(parent, current);
-        }
-        else if (currentName == "dir") {
-            success = this->ReadDir(parent, current);
-        }
-        else if (currentName == "dynam") {
-            success = this->ReadDynam(parent, current);
-        }
-        else if (currentName == "fermata") {
-            success = this->ReadFermata(parent, current);
-        }
-        else if (currentName == "fing") {
-            success = this->ReadFing(parent, current);
-        }
-        else if (currentName == "gliss") {
-            success = this->ReadGliss(parent, current);
-        }
-        else if (currentName == "hairpin") {
-            success = this->ReadHairpin(parent, current);
-        }
-        else if (currentName == "harm") {
-            success = this->ReadHarm(parent, current);
-        }
-        else if (currentName == "lv") {
-            success = this->ReadLv(parent, current);
-        }
-        else if (currentName == "mNum") {
-            success = this->ReadMNum(parent, current);
-        }
-        else if (currentName == "mordent") {
-            success = this->ReadMordent(parent, current);
-        }
-        else if (currentName == "octave") {
-            success = this->ReadOctave(parent, current);
-        }
-        else if (currentName == "ornam") {
-            success = this->ReadOrnam(parent, current);
-        }
-        else if (currentName == "pedal") {
-            success = this->ReadPedal(parent, current);
-        }
-        else if (currentName == "phrase") {
-            success = this->ReadPhrase(parent, current);
-        }
-        else if (currentName == "pitchInflection") {
-            success = this->ReadPitchInflection(parent, current);
-        }
-        else if (currentName == "reh") {
-            success = this->ReadReh(parent, current);
-        }
-        else if (currentName == "slur") {
-            success = this->ReadSlur(parent, current);
-        }
-        else if (currentName == "staff") {
-            success = this->ReadStaff(parent, current);
-        }
-        else if (currentName == "tempo") {
-            success = this->ReadTempo(parent, current);
-        }
-        else if (currentName == "tie") {
-            success = this->ReadTie(parent, current);
-        }
-        else if (currentName == "trill") {
-            success = this->ReadTrill(parent, current);
-        }
-        else if (currentName == "turn") {
-            success = this->ReadTurn(parent, current);
+        else if (ElementReader reader = this->GetElementReader(currentName, CHILDREN_MEASURE)) {
+            success = (this->*reader)(parent, current);
         }
         else if (currentName == "tupletSpan") {
             if (!ReadTupletSpanAsTuplet(dynamic_cast<Measure *>(parent), current)) {
@@ -5399,8 +5366,8 @@ bool MEIInput::ReadMeterSigGrpChildren(Object *parent, pugi::xml_node parentNode
     for (current = parentNode.first_child(); current; current = current.next_sibling()) {
         if (!success) break;
         // content
-        else if (std::string(current.name()) == "meterSig") {
-            success = this->ReadMeterSig(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_METERSIGGRP)) {
+            success = (this->*reader)(parent, current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -5896,8 +5863,8 @@ bool MEIInput::ReadFbChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadEditorialElement(parent, current, EDITORIAL_FB);
         }
         // content
-        else if (std::string(current.name()) == "f") {
-            success = this->ReadF(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_FB)) {
+            success = (this->*reader)(parent, current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -5952,8 +5919,8 @@ bool MEIInput::ReadStaffChildren(Object *parent, pugi::xml_node parentNode)
             success = this->ReadEditorialElement(parent, current, EDITORIAL_STAFF);
         }
         // content
-        else if (std::string(current.name()) == "layer") {
-            success = this->ReadLayer(parent, current);
+        else if (ElementReader reader = this->GetElementReader(current.name(), CHILDREN_STAFF)) {
+            success = (this->*reader)(parent, current);
         }
         // xml comment
         else if (std::string(current.name()) == "") {
@@ -6011,128 +5978,8 @@ bool MEIInput::ReadLayerChildren(Object *parent, pugi::xml_node parentNode, Obje
             success = this->ReadEditorialElement(parent, xmlElement, EDITORIAL_LAYER, filter);
         }
         // content
-        else if (elementName == "accid") {
-            success = this->ReadAccid(parent, xmlElement);
-        }
-        else if (elementName == "artic") {
-            success = this->ReadArtic(parent, xmlElement);
-        }
-        else if (elementName == "barLine") {
-            success = this->ReadBarLine(parent, xmlElement);
-        }
-        else if (elementName == "beam") {
-            success = this->ReadBeam(parent, xmlElement);
-        }
-        else if (elementName == "beatRpt") {
-            success = this->ReadBeatRpt(parent, xmlElement);
-        }
-        else if (elementName == "bTrem") {
-            success = this->ReadBTrem(parent, xmlElement);
-        }
-        else if (elementName == "chord") {
-            success = this->ReadChord(parent, xmlElement);
-        }
-        else if (elementName == "clef") {
-            success = this->ReadClef(parent, xmlElement);
-        }
-        else if (elementName == "custos") {
-            success = this->ReadCustos(parent, xmlElement);
-        }
-        else if (elementName == "dot") {
-            success = this->ReadDot(parent, xmlElement);
-        }
-        else if (elementName == "fTrem") {
-            success = this->ReadFTrem(parent, xmlElement);
-        }
-        else if (elementName == "graceGrp") {
-            success = this->ReadGraceGrp(parent, xmlElement);
-        }
-        else if (elementName == "halfmRpt") {
-            success = this->ReadHalfmRpt(parent, xmlElement);
-        }
-        else if (elementName == "keyAccid") {
-            success = this->ReadKeyAccid(parent, xmlElement);
-        }
-        else if (elementName == "keySig") {
-            success = this->ReadKeySig(parent, xmlElement);
-        }
-        else if (elementName == "label") {
-            success = this->ReadLabel(parent, xmlElement);
-        }
-        else if (elementName == "labelAbbr") {
-            success = this->ReadLabelAbbr(parent, xmlElement);
-        }
-        else if (elementName == "ligature") {
-            success = this->ReadLigature(parent, xmlElement);
-        }
-        else if (elementName == "mensur") {
-            success = this->ReadMensur(parent, xmlElement);
-        }
-        else if (elementName == "meterSig") {
-            success = this->ReadMeterSig(parent, xmlElement);
-        }
-        else if (elementName == "meterSigGrp") {
-            success = this->ReadMeterSigGrp(parent, xmlElement);
-        }
-        else if (elementName == "nc") {
-            success = this->ReadNc(parent, xmlElement);
-        }
-        else if (elementName == "neume") {
-            success = this->ReadNeume(parent, xmlElement);
-        }
-        else if (elementName == "note") {
-            success = this->ReadNote(parent, xmlElement);
-        }
-        else if (elementName == "rest") {
-            success = this->ReadRest(parent, xmlElement);
-        }
-        else if (elementName == "mRest") {
-            success = this->ReadMRest(parent, xmlElement);
-        }
-        else if (elementName == "mRpt") {
-            success = this->ReadMRpt(parent, xmlElement);
-        }
-        else if (elementName == "mRpt2") {
-            success = this->ReadMRpt2(parent, xmlElement);
-        }
-        else if (elementName == "mSpace") {
-            success = this->ReadMSpace(parent, xmlElement);
-        }
-        else if (elementName == "multiRest") {
-            success = this->ReadMultiRest(parent, xmlElement);
-        }
-        else if (elementName == "multiRpt") {
-            success = this->ReadMultiRpt(parent, xmlElement);
-        }
-        else if (elementName == "plica") {
-            success = this->ReadPlica(parent, xmlElement);
-        }
-        else if (elementName == "proport") {
-            success = this->ReadProport(parent, xmlElement);
-        }
-        else if (elementName == "space") {
-            success = this->ReadSpace(parent, xmlElement);
-        }
-        else if (elementName == "stem") {
-            success = this->ReadStem(parent, xmlElement);
-        }
-        else if (elementName == "syl") {
-            success = this->ReadSyl(parent, xmlElement);
-        }
-        else if (elementName == "syllable") {
-            success = this->ReadSyllable(parent, xmlElement);
-        }
-        else if (elementName == "tabDurSym") {
-            success = this->ReadTabDurSym(parent, xmlElement);
-        }
-        else if (elementName == "tabGrp") {
-            success = this->ReadTabGrp(parent, xmlElement);
-        }
-        else if (elementName == "tuplet") {
-            success = this->ReadTuplet(parent, xmlElement);
-        }
-        else if (elementName == "verse") {
-            success = this->ReadVerse(parent, xmlElement);
+        else if (ElementReader reader = this->GetElementReader(elementName, CHILDREN_LAYER)) {
+            success = (this->*reader)(parent, xmlElement);
         }
         // xml comment
         else if (elementName == "") {
@@ -6882,23 +6729,8 @@ bool MEIInput::ReadTextChildren(Object *parent, pugi::xml_node parentNode, Objec
             success = this->ReadEditorialElement(parent, xmlElement, EDITORIAL_TEXT, filter);
         }
         // content
-        else if (elementName == "fig") {
-            success = this->ReadFig(parent, xmlElement);
-        }
-        else if (elementName == "lb") {
-            success = this->ReadLb(parent, xmlElement);
-        }
-        else if (elementName == "num") {
-            success = this->ReadNum(parent, xmlElement);
-        }
-        else if (elementName == "rend") {
-            success = this->ReadRend(parent, xmlElement);
-        }
-        else if (elementName == "svg") {
-            success = this->ReadSvg(parent, xmlElement);
-        }
-        else if (elementName == "symbol") {
-            success = this->ReadSymbol(parent, xmlElement);
+        else if (ElementReader reader = this->GetElementReader(elementName, CHILDREN_TEXT)) {
+            success = (this->*reader)(parent, xmlElement);
         }
         else if (xmlElement.text()) {
             bool trimLeft = (i == 0);
@@ -6941,11 +6773,8 @@ bool MEIInput::ReadSymbolDefChildren(Object *parent, pugi::xml_node parentNode,
             continue;
         }
         // content
-        else if (elementName == "graphic") {
-            success = this->ReadGraphic(parent, xmlElement);
-        }
-        else if (elementName == "svg") {
-            success = this->ReadSvg(parent, xmlElement);
+        else if (ElementReader reader = this->GetElementReader(elementName, CHILDREN_SYMBOLDEF)) {
+            success = (this->*reader)(parent, xmlElement);
         }
         // xml comment
         else if (elementName == "") {
@@ -7946,6 +7775,13 @@ bool MEIInput::IsEditorialElementName(std::string elementName)
     return false;
 }
 
+MEIInput::ElementReader MEIInput::GetElementReader(const std::string &elementName, ChildrenContext context) const
+{
+    auto i = MEIInput::s_elementReaders.find(elementName);
+    if ((i == MEIInput::s_elementReaders.end()) || !(i->second.second & context)) return NULL;
+    return i->second.first;
+}
+
 void MEIInput::NormalizeAttributes(pugi::xml_node &xmlElement)
 {
     for (auto elem : xmlElement.attributes()) {
@@ -0,0 +1,107 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        mappedfile.cpp
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "mappedfile.h"
+
+//----------------------------------------------------------------------------
+
+#include <fstream>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#define VRV_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// MappedFile
+//----------------------------------------------------------------------------
+
+MappedFile::MappedFile()
+{
+    m_data = NULL;
+    m_size = 0;
+    m_isMapped = false;
+}
+
+MappedFile::~MappedFile()
+{
+    this->Close();
+}
+
+bool MappedFile::Open(const std::string &filename)
+{
+    this->Close();
+
+#ifdef VRV_MMAP
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) != 0) || !S_ISREG(fileStat.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    m_size = (size_t)fileStat.st_size;
+    // An empty file cannot be mapped
+    if (m_size == 0) {
+        close(fd);
+        return true;
+    }
+
+    void *data = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping remains valid once the file descriptor is closed
+    close(fd);
+    if (data == MAP_FAILED) {
+        m_size = 0;
+        return false;
+    }
+    // The content is read once from the beginning to the end
+    madvise(data, m_size, MADV_SEQUENTIAL);
+
+    m_data = static_cast<const char *>(data);
+    m_isMapped = true;
+    return true;
+#else
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open()) return false;
+
+    in.seekg(0, std::ios::end);
+    std::streamsize fileSize = (std::streamsize)in.tellg();
+    in.clear();
+    in.seekg(0, std::ios::beg);
+    if (fileSize < 0) return false;
+
+    m_buffer.resize(fileSize);
+    in.read(m_buffer.data(), fileSize);
+
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+#endif
+}
+
+void MappedFile::Close()
+{
+#ifdef VRV_MMAP
+    if (m_isMapped) munmap(const_cast<char *>(m_data), m_size);
+#endif
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = NULL;
+    m_size = 0;
+    m_isMapped = false;
+}
+
+} // namespace vrv
@@ -503,6 +503,12 @@ int Measure::EnclosesTime(int time) const
     return 0;
 }
 
+double Measure::GetScoreTimeOffset(int repeat) const
+{
+    if ((repeat < 1) || repeat > (int)m_scoreTimeOffset.size()) return 0;
+    return m_scoreTimeOffset.at(repeat - 1);
+}
+
 double Measure::GetRealTimeOffsetMilliseconds(int repeat) const
 {
     if ((repeat < 1) || repeat > (int)m_realTimeOffsetMilliseconds.size()) return 0;
@@ -12,6 +12,7 @@
 #include "arpeg.h"
 #include "beatrpt.h"
 #include "btrem.h"
+#include "expansionmap.h"
 #include "featureextractor.h"
 #include "ftrem.h"
 #include "gracegrp.h"
@@ -219,10 +220,12 @@ FunctorCode InitMaxMeasureDurationFunctor::VisitLayerElement(LayerElement *layer
 
 FunctorCode InitMaxMeasureDurationFunctor::VisitMeasure(Measure *measure)
 {
-    measure->ClearScoreTimeOffset();
+    // The offsets of the previous calculation are cleared at the first visit and added for each repeat
+    if (m_visitedMeasures.insert(measure).second) {
+        measure->ClearScoreTimeOffset();
+        measure->ClearRealTimeOffset();
+    }
     measure->AddScoreTimeOffset(m_currentScoreTime);
-
-    measure->ClearRealTimeOffset();
     measure->AddRealTimeOffset(m_currentRealTimeSeconds * 1000.0);
 
     return FUNCTOR_CONTINUE;
@@ -300,6 +303,8 @@ FunctorCode InitTimemapTiesFunctor::VisitTie(Tie *tie)
 InitMIDIFunctor::InitMIDIFunctor() : ConstFunctor()
 {
     m_currentTempo = MIDI_TEMPO;
+    m_hasTrackDependencies = false;
+    m_scoreCount = 0;
 }
 
 FunctorCode InitMIDIFunctor::VisitArpeg(const Arpeg *arpeg)
@@ -326,6 +331,20 @@ FunctorCode InitMIDIFunctor::VisitArpeg(const Arpeg *arpeg)
     return FUNCTOR_CONTINUE;
 }
 
+FunctorCode InitMIDIFunctor::VisitBeatRpt(const BeatRpt *beatRpt)
+{
+    m_hasTrackDependencies = true;
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitMIDIFunctor::VisitLayerElement(const LayerElement *layerElement)
+{
+    if (layerElement->HasSameasLink()) m_hasTrackDependencies = true;
+
+    return FUNCTOR_CONTINUE;
+}
+
 FunctorCode InitMIDIFunctor::VisitMeasure(const Measure *measure)
 {
     m_currentTempo = measure->GetCurrentTempo();
@@ -333,6 +352,13 @@ FunctorCode InitMIDIFunctor::VisitMeasure(const Measure *measure)
     return FUNCTOR_CONTINUE;
 }
 
+FunctorCode InitMIDIFunctor::VisitScore(const Score *score)
+{
+    ++m_scoreCount;
+
+    return FUNCTOR_CONTINUE;
+}
+
 //----------------------------------------------------------------------------
 // GenerateMIDIFunctor
 //----------------------------------------------------------------------------
@@ -549,8 +575,8 @@ FunctorCode GenerateMIDIFunctor::VisitLayerElement(const LayerElement *layerElem
 
 FunctorCode GenerateMIDIFunctor::VisitMeasure(const Measure *measure)
 {
-    // Here we need to update the m_totalTime from the starting time of the measure.
-    m_totalTime = measure->GetLastTimeOffset();
+    // Here we need to update the m_totalTime from the starting time of the measure (for its current repeat).
+    m_totalTime = measure->GetScoreTimeOffset(++m_measureRepeats[measure]);
 
     if (measure->GetCurrentTempo() != m_currentTempo) {
         m_currentTempo = measure->GetCurrentTempo();
@@ -717,7 +743,8 @@ FunctorCode GenerateMIDIFunctor::VisitScoreDef(const ScoreDef *scoreDef)
         const Object *next = parent->GetNext(scoreDef);
         if (next && next->Is(MEASURE)) {
             const Measure *nextMeasure = vrv_cast<const Measure *>(next);
-            totalTime = nextMeasure->GetLastTimeOffset();
+            auto repeat = m_measureRepeats.find(nextMeasure);
+            totalTime = nextMeasure->GetScoreTimeOffset((repeat != m_measureRepeats.end()) ? repeat->second + 1 : 1);
         }
     }
     const double currentTick = totalTime * m_midiFile->getTPQ();
@@ -874,6 +901,8 @@ GenerateTimemapFunctor::GenerateTimemapFunctor(Timemap *timemap) : ConstFunctor(
     m_currentTempo = MIDI_TEMPO;
     m_cueExclusion = false;
     m_timemap = timemap;
+    m_expansionMap = NULL;
+    m_currentRepeat = 1;
 }
 
 FunctorCode GenerateTimemapFunctor::VisitLayerElement(const LayerElement *layerElement)
@@ -891,8 +920,9 @@ FunctorCode GenerateTimemapFunctor::VisitLayerElement(const LayerElement *layerE
 
 FunctorCode GenerateTimemapFunctor::VisitMeasure(const Measure *measure)
 {
-    m_scoreTimeOffset = measure->GetLastTimeOffset();
-    m_realTimeOffsetMilliseconds = measure->GetLastRealTimeOffset();
+    m_currentRepeat = ++m_measureRepeats[measure];
+    m_scoreTimeOffset = measure->GetScoreTimeOffset(m_currentRepeat);
+    m_realTimeOffsetMilliseconds = measure->GetRealTimeOffsetMilliseconds(m_currentRepeat);
     m_currentTempo = measure->GetCurrentTempo();
 
     this->AddTimemapEntry(measure);
@@ -948,9 +978,13 @@ void GenerateTimemapFunctor::AddTimemapEntry(const Object *object)
         // ensure that it is equal to scoreTimeStart:
         startEntry.qstamp = scoreTimeStart;
 
+        // The element ID of the current repeat in a shared expansion
+        const std::string id
+            = (m_expansionMap) ? m_expansionMap->GetRepeatID(object->GetID(), m_currentRepeat) : object->GetID();
+
         // Store the element ID in list to turn on at given time - note or rest
-        if (!isRest) startEntry.notesOn.push_back(object->GetID());
-        if (isRest) startEntry.restsOn.push_back(object->GetID());
+        if (!isRest) startEntry.notesOn.push_back(id);
+        if (isRest) startEntry.restsOn.push_back(id);
 
         // Also add the tempo
         startEntry.tempo = m_currentTempo;
@@ -964,15 +998,15 @@ void GenerateTimemapFunctor::AddTimemapEntry(const Object *object)
         endEntry.qstamp = scoreTimeEnd;
 
         // Store the element ID in list to turn off at given time - notes or rest
-        if (!isRest) endEntry.notesOff.push_back(object->GetID());
-        if (isRest) endEntry.restsOff.push_back(object->GetID());
+        if (!isRest) endEntry.notesOff.push_back(id);
+        if (isRest) endEntry.restsOff.push_back(id);
     }
     else if (object->Is(MEASURE)) {
 
         const Measure *measure = vrv_cast<const Measure *>(object);
         assert(measure);
 
-        // Deal with repeated music later, for now get the last times.
+        // The times of the current repeat of the measure
         double scoreTimeStart = m_scoreTimeOffset;
         double realTimeStart = round(m_realTimeOffsetMilliseconds);
 
@@ -983,7 +1017,8 @@ void GenerateTimemapFunctor::AddTimemapEntry(const Object *object)
         startEntry.qstamp = scoreTimeStart;
 
         // Add the measureOn
-        startEntry.measureOn = measure->GetID();
+        startEntry.measureOn
+            = (m_expansionMap) ? m_expansionMap->GetRepeatID(measure->GetID(), m_currentRepeat) : measure->GetID();
     }
 }
 
@@ -9,11 +9,29 @@
 
 //----------------------------------------------------------------------------
 
+#include <sstream>
+
+//----------------------------------------------------------------------------
+
+#include "dot.h"
+#include "ending.h"
+#include "hairpin.h"
 #include "layer.h"
+#include "linkinginterface.h"
+#include "measure.h"
+#include "mrpt.h"
+#include "note.h"
 #include "page.h"
+#include "plistinterface.h"
+#include "spatialindex.h"
 #include "staff.h"
+#include "syl.h"
 #include "system.h"
+#include "timeinterface.h"
+#include "timestamp.h"
+#include "turn.h"
 #include "verse.h"
+#include "vrv.h"
 
 //----------------------------------------------------------------------------
 
@@ -99,22 +117,376 @@ FunctorCode GetAlignmentLeftRightFunctor::VisitObject(const Object *object)
     return FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// GetPreparedDataFunctor
+//----------------------------------------------------------------------------
+
+GetPreparedDataFunctor::GetPreparedDataFunctor() : ConstFunctor() {}
+
+FunctorCode GetPreparedDataFunctor::VisitObject(const Object *object)
+{
+    std::stringstream data;
+
+    if (object->HasInterface(INTERFACE_TIME_SPANNING)) {
+        const TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+        assert(interface);
+        data << " start:" << this->GetReference(interface->GetStart());
+        data << " end:" << this->GetReference(interface->GetEnd());
+    }
+    else if (object->HasInterface(INTERFACE_TIME_POINT)) {
+        const TimePointInterface *interface = object->GetTimePointInterface();
+        assert(interface);
+        data << " start:" << this->GetReference(interface->GetStart());
+    }
+    if (object->HasInterface(INTERFACE_PLIST)) {
+        const PlistInterface *interface = object->GetPlistInterface();
+        assert(interface);
+        for (const Object *ref : interface->GetRefs()) data << " ref:" << this->GetReference(ref);
+    }
+    if (object->HasInterface(INTERFACE_LINKING)) {
+        const LinkingInterface *interface = object->GetLinkingInterface();
+        assert(interface);
+        if (interface->GetNextLink()) data << " next:" << this->GetReference(interface->GetNextLink());
+        if (interface->GetSameasLink()) data << " sameas:" << this->GetReference(interface->GetSameasLink());
+    }
+    if (object->IsLayerElement()) {
+        const LayerElement *layerElement = vrv_cast<const LayerElement *>(object);
+        assert(layerElement);
+        if (layerElement->m_crossStaff) data << " crossStaff:" << this->GetReference(layerElement->m_crossStaff);
+        if (layerElement->m_crossLayer) data << " crossLayer:" << this->GetReference(layerElement->m_crossLayer);
+        if (layerElement->GetDrawingCueSize()) data << " cueSize";
+        if (layerElement->GetIsInBeamSpan()) data << " inBeamSpan";
+    }
+    if (object->IsFloatingObject()) {
+        const FloatingObject *floatingObject = vrv_cast<const FloatingObject *>(object);
+        assert(floatingObject);
+        if (floatingObject->GetDrawingGrpId() != 0) data << " grpId:" << floatingObject->GetDrawingGrpId();
+    }
+
+    if (object->Is(DOT)) {
+        const Dot *dot = vrv_cast<const Dot *>(object);
+        assert(dot);
+        data << " previous:" << this->GetReference(dot->m_drawingPreviousElement);
+        data << " next:" << this->GetReference(dot->m_drawingNextElement);
+    }
+    else if (object->Is(HAIRPIN)) {
+        const Hairpin *hairpin = vrv_cast<const Hairpin *>(object);
+        assert(hairpin);
+        data << " leftLink:" << this->GetReference(hairpin->GetLeftLink());
+        data << " rightLink:" << this->GetReference(hairpin->GetRightLink());
+    }
+    else if (object->Is(LAYER)) {
+        const Layer *layer = vrv_cast<const Layer *>(object);
+        assert(layer);
+        if (layer->HasCrossStaffFromAbove()) data << " crossStaffFromAbove";
+        if (layer->HasCrossStaffFromBelow()) data << " crossStaffFromBelow";
+    }
+    else if (object->Is(MEASURE)) {
+        const Measure *measure = vrv_cast<const Measure *>(object);
+        assert(measure);
+        if (measure->GetDrawingEnding()) data << " ending:" << this->GetReference(measure->GetDrawingEnding());
+    }
+    else if (object->Is(MRPT)) {
+        const MRpt *mRpt = vrv_cast<const MRpt *>(object);
+        assert(mRpt);
+        data << " measureCount:" << mRpt->m_drawingMeasureCount;
+    }
+    else if (object->Is(NOTE)) {
+        const Note *note = vrv_cast<const Note *>(object);
+        assert(note);
+        if (note->GetStemSameasNote()) data << " stemSameas:" << this->GetReference(note->GetStemSameasNote());
+    }
+    else if (object->Is(STAFF)) {
+        const Staff *staff = vrv_cast<const Staff *>(object);
+        assert(staff);
+        for (const Object *element : staff->m_timeSpanningElements) {
+            data << " timeSpanning:" << this->GetReference(element);
+        }
+    }
+    else if (object->Is(SYL)) {
+        const Syl *syl = vrv_cast<const Syl *>(object);
+        assert(syl);
+        if (syl->m_nextWordSyl) data << " nextWordSyl:" << this->GetReference(syl->m_nextWordSyl);
+    }
+    else if (object->Is(TURN)) {
+        const Turn *turn = vrv_cast<const Turn *>(object);
+        assert(turn);
+        if (turn->m_drawingEndElement) data << " end:" << this->GetReference(turn->m_drawingEndElement);
+    }
+
+    if (!data.str().empty()) {
+        m_preparedData.push_back(object->GetID() + data.str());
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+std::string GetPreparedDataFunctor::GetReference(const Object *object) const
+{
+    if (!object) return "none";
+
+    // Timestamps are created again when the data is prepared
+    if (object->Is(TIMESTAMP_ATTR)) {
+        const TimestampAttr *timestampAttr = vrv_cast<const TimestampAttr *>(object);
+        assert(timestampAttr);
+        const Object *measure = timestampAttr->GetFirstAncestor(MEASURE);
+        return StringFormat(
+            "%s@%f", (measure) ? measure->GetID().c_str() : "", timestampAttr->GetActualDurPos());
+    }
+    return object->GetID();
+}
+
+//----------------------------------------------------------------------------
+// InitDataDependenciesFunctor
+//----------------------------------------------------------------------------
+
+InitDataDependenciesFunctor::InitDataDependenciesFunctor(bool fromPreparedData) : ConstFunctor(), CollectAndProcess()
+{
+    m_fromPreparedData = fromPreparedData;
+    m_currentIndex = 0;
+    m_lastIndex = 0;
+    m_currentLayerN = { VRV_UNSET, VRV_UNSET };
+    m_currentLayerHasMRpt = false;
+}
+
+void InitDataDependenciesFunctor::AddRangeTo(const Object *object)
+{
+    if (!object) return;
+
+    const Measure *measure = vrv_cast<const Measure *>(object->GetFirstAncestor(MEASURE));
+    if (measure) this->AddRange(m_currentIndex, measure->GetIndex());
+}
+
+void InitDataDependenciesFunctor::AddRange(int index1, int index2)
+{
+    if ((index1 == 0) || (index2 == 0) || (index1 == index2)) return;
+
+    m_ranges.push_back({ std::min(index1, index2), std::max(index1, index2) });
+}
+
+void InitDataDependenciesFunctor::AddReference(const std::string &uri)
+{
+    const std::string id = ExtractIDFragment(uri);
+    m_references.push_back({ m_currentIndex, id });
+    m_referenceIndices.insert({ id, 0 });
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitDocEnd(const Doc *doc)
+{
+    if (this->IsCollectingData()) return FUNCTOR_CONTINUE;
+
+    // Lyric connectors and mRpt sequences still open at the end depend on the last measure
+    for (const auto &sylStart : m_sylStarts) {
+        this->AddRange(sylStart.second, m_lastIndex);
+    }
+    for (const auto &mRptStart : m_mRptStarts) {
+        this->AddRange(mRptStart.second, m_lastIndex);
+    }
+
+    for (const auto &reference : m_references) {
+        this->AddRange(reference.first, m_referenceIndices.at(reference.second));
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitDot(const Dot *dot)
+{
+    if (this->IsProcessingData() && m_fromPreparedData) {
+        this->AddRangeTo(dot->m_drawingPreviousElement);
+        this->AddRangeTo(dot->m_drawingNextElement);
+    }
+
+    // Call parent one too
+    return this->VisitLayerElement(dot);
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitLayer(const Layer *layer)
+{
+    const Staff *staff = vrv_cast<const Staff *>(layer->GetFirstAncestor(STAFF));
+    assert(staff);
+    m_currentLayerN = { staff->GetN(), layer->GetN() };
+    m_currentLayerHasMRpt = false;
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitLayerEnd(const Layer *layer)
+{
+    if (this->IsCollectingData()) return FUNCTOR_CONTINUE;
+
+    // The mRpt are numbered by sequence (see PrepareRptFunctor)
+    auto iter = m_mRptStarts.find(m_currentLayerN);
+    if (m_currentLayerHasMRpt) {
+        if (iter == m_mRptStarts.end()) m_mRptStarts[m_currentLayerN] = m_currentIndex;
+    }
+    else if (iter != m_mRptStarts.end()) {
+        // A mRpt in this measure would continue the sequence
+        this->AddRange(iter->second, m_currentIndex);
+        m_mRptStarts.erase(iter);
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitMeasure(const Measure *measure)
+{
+    m_currentIndex = measure->GetIndex();
+    m_lastIndex = std::max(m_lastIndex, m_currentIndex);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitMeasureEnd(const Measure *measure)
+{
+    m_currentIndex = 0;
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitMRpt(const MRpt *mRpt)
+{
+    m_currentLayerHasMRpt = true;
+
+    // Call parent one too
+    return this->VisitLayerElement(mRpt);
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitObject(const Object *object)
+{
+    // Objects outside the measures are always prepared again
+    if (m_currentIndex == 0) return FUNCTOR_CONTINUE;
+
+    if (this->IsCollectingData()) {
+        if (object->HasInterface(INTERFACE_TIME_SPANNING)) {
+            const TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+            assert(interface);
+            if (interface->HasStartid()) this->AddReference(interface->GetStartid());
+            if (interface->HasEndid()) {
+                this->AddReference(interface->GetEndid());
+            }
+            else if (interface->HasTstamp2()) {
+                this->AddRange(m_currentIndex, m_currentIndex + interface->GetTstamp2().first);
+            }
+        }
+        else if (object->HasInterface(INTERFACE_TIME_POINT)) {
+            const TimePointInterface *interface = object->GetTimePointInterface();
+            assert(interface);
+            if (interface->HasStartid()) this->AddReference(interface->GetStartid());
+        }
+        if (object->HasInterface(INTERFACE_PLIST)) {
+            const PlistInterface *interface = object->GetPlistInterface();
+            assert(interface);
+            for (const std::string &uri : interface->GetPlist()) this->AddReference(uri);
+        }
+        if (object->HasInterface(INTERFACE_LINKING)) {
+            const LinkingInterface *interface = object->GetLinkingInterface();
+            assert(interface);
+            if (interface->HasNext()) this->AddReference(interface->GetNext());
+            if (interface->HasSameas()) this->AddReference(interface->GetSameas());
+        }
+        if (object->Is(NOTE)) {
+            const Note *note = vrv_cast<const Note *>(object);
+            assert(note);
+            if (note->HasStemSameas()) this->AddReference(note->GetStemSameas());
+        }
+        return FUNCTOR_CONTINUE;
+    }
+
+    if (!m_referenceIndices.empty()) {
+        auto iter = m_referenceIndices.find(object->GetID());
+        if (iter != m_referenceIndices.end()) iter->second = m_currentIndex;
+    }
+
+    if (!m_fromPreparedData) return FUNCTOR_CONTINUE;
+
+    if (object->HasInterface(INTERFACE_TIME_SPANNING)) {
+        const TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+        assert(interface);
+        this->AddRangeTo(interface->GetStart());
+        this->AddRangeTo(interface->GetEnd());
+    }
+    else if (object->HasInterface(INTERFACE_TIME_POINT)) {
+        const TimePointInterface *interface = object->GetTimePointInterface();
+        assert(interface);
+        this->AddRangeTo(interface->GetStart());
+    }
+    if (object->HasInterface(INTERFACE_PLIST)) {
+        const PlistInterface *interface = object->GetPlistInterface();
+        assert(interface);
+        for (const Object *ref : interface->GetRefs()) this->AddRangeTo(ref);
+    }
+    if (object->HasInterface(INTERFACE_LINKING)) {
+        const LinkingInterface *interface = object->GetLinkingInterface();
+        assert(interface);
+        this->AddRangeTo(interface->GetNextLink());
+        this->AddRangeTo(interface->GetSameasLink());
+    }
+    if (object->Is(NOTE)) {
+        const Note *note = vrv_cast<const Note *>(object);
+        assert(note);
+        this->AddRangeTo(note->GetStemSameasNote());
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitSyl(const Syl *syl)
+{
+    const Verse *verse = vrv_cast<const Verse *>(syl->GetFirstAncestor(VERSE, MAX_NOTE_DEPTH));
+    if (this->IsProcessingData() && verse) {
+        // The connector of the previous syl of the verse ends here (see PrepareLyricsFunctor)
+        const std::tuple<int, int, int> verseN = { m_currentLayerN.first, m_currentLayerN.second, verse->GetN() };
+        auto iter = m_sylStarts.find(verseN);
+        if (iter != m_sylStarts.end()) {
+            this->AddRange(iter->second, m_currentIndex);
+            m_sylStarts.erase(iter);
+        }
+        if ((syl->GetWordpos() == sylLog_WORDPOS_i) || (syl->GetWordpos() == sylLog_WORDPOS_m)
+            || (syl->GetCon() == sylLog_CON_u)) {
+            m_sylStarts[verseN] = m_currentIndex;
+        }
+    }
+
+    // Call parent one too
+    return this->VisitLayerElement(syl);
+}
+
+FunctorCode InitDataDependenciesFunctor::VisitTurn(const Turn *turn)
+{
+    if (this->IsProcessingData() && m_fromPreparedData) {
+        this->AddRangeTo(turn->m_drawingEndElement);
+    }
+
+    // Call parent one too
+    return this->VisitControlElement(turn);
+}
+
 //----------------------------------------------------------------------------
 // InitProcessingListsFunctor
 //----------------------------------------------------------------------------
 
-InitProcessingListsFunctor::InitProcessingListsFunctor() : ConstFunctor() {}
+InitProcessingListsFunctor::InitProcessingListsFunctor() : Functor() {}
 
-FunctorCode InitProcessingListsFunctor::VisitLayer(const Layer *layer)
+const std::vector<Layer *> &InitProcessingListsFunctor::GetLayers(int staffN, int layerN) const
+{
+    static const std::vector<Layer *> noLayers;
+
+    auto iter = m_layers.find({ staffN, layerN });
+    return (iter != m_layers.end()) ? iter->second : noLayers;
+}
+
+FunctorCode InitProcessingListsFunctor::VisitLayer(Layer *layer)
 {
     const Staff *staff = vrv_cast<const Staff *>(layer->GetFirstAncestor(STAFF));
     assert(staff);
     m_layerTree.child[staff->GetN()].child[layer->GetN()];
+    m_layers[{ staff->GetN(), layer->GetN() }].push_back(layer);
 
     return FUNCTOR_CONTINUE;
 }
 
-FunctorCode InitProcessingListsFunctor::VisitVerse(const Verse *verse)
+FunctorCode InitProcessingListsFunctor::VisitVerse(Verse *verse)
 {
     const Staff *staff = verse->GetAncestorStaff();
     const Layer *layer = vrv_cast<const Layer *>(verse->GetFirstAncestor(LAYER));
@@ -125,6 +497,43 @@ FunctorCode InitProcessingListsFunctor::VisitVerse(const Verse *verse)
     return FUNCTOR_SIBLINGS;
 }
 
+//----------------------------------------------------------------------------
+// InitSpatialIndexFunctor
+//----------------------------------------------------------------------------
+
+InitSpatialIndexFunctor::InitSpatialIndexFunctor(SpatialIndex *spatialIndex) : ConstFunctor()
+{
+    m_spatialIndex = spatialIndex;
+}
+
+FunctorCode InitSpatialIndexFunctor::VisitObject(const Object *object)
+{
+    // The bounding boxes of floating objects are the ones of their positioners
+    if (object->IsFloatingObject()) return FUNCTOR_CONTINUE;
+
+    if (!object->HasSelfBB() || object->HasEmptyBB()) return FUNCTOR_CONTINUE;
+
+    m_spatialIndex->Insert(
+        object, object->GetSelfLeft(), object->GetSelfBottom(), object->GetSelfRight(), object->GetSelfTop());
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitSpatialIndexFunctor::VisitSystem(const System *system)
+{
+    for (const Object *child : system->m_systemAligner.GetChildren()) {
+        const StaffAlignment *staffAlignment = vrv_cast<const StaffAlignment *>(child);
+        assert(staffAlignment);
+        for (const FloatingPositioner *positioner : staffAlignment->GetFloatingPositioners()) {
+            if (!positioner->HasSelfBB() || positioner->HasEmptyBB()) continue;
+            m_spatialIndex->Insert(positioner->GetObject(), positioner->GetSelfLeft(), positioner->GetSelfBottom(),
+                positioner->GetSelfRight(), positioner->GetSelfTop());
+        }
+    }
+
+    return this->VisitObject(system);
+}
+
 //----------------------------------------------------------------------------
 // ReorderByXPosFunctor
 //----------------------------------------------------------------------------
@@ -41,6 +41,7 @@
 #include "note.h"
 #include "page.h"
 #include "plistinterface.h"
+#include "profiler.h"
 #include "resetfunctor.h"
 #include "savefunctor.h"
 #include "score.h"
@@ -196,6 +197,7 @@ void Object::Init(ClassId classId, const std::string &classIdStr)
     m_classId = classId;
     m_classIdStr = classIdStr;
     m_parent = NULL;
+    Profiler::Count(PROFILER_OBJECTS_CREATED);
     // Flags
     m_isAttribute = false;
     m_isModified = true;
@@ -1018,6 +1020,9 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         return;
     }
 
+    // Measure the outermost call when profiling
+    ProfilerScope profilerScope(functor);
+
     // Update the current score stored in the document
     this->UpdateDocumentScore(functor.GetDirection());
 
@@ -1075,6 +1080,9 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         return;
     }
 
+    // Measure the outermost call when profiling
+    ProfilerScope profilerScope(functor);
+
     // Update the current score stored in the document
     const_cast<Object *>(this)->UpdateDocumentScore(functor.GetDirection());
 
@@ -1245,6 +1253,13 @@ void Object::SeedID(uint32_t seed)
     }
 }
 
+uint32_t Object::GenerateSeed()
+{
+    // A seed of 0 would make the seeded thread start randomly
+    const uint32_t seed = Hash(++s_xmlIDCounter);
+    return (seed != 0) ? seed : 1;
+}
+
 std::string Object::GenerateHashID()
 {
     uint32_t nr = Hash(++s_xmlIDCounter);
@@ -1568,12 +1583,9 @@ void TextListInterface::FilterList(ListOfConstObjects &childList) const
 // ObjectFactory methods
 //----------------------------------------------------------------------------
 
-thread_local MapOfStrConstructors ObjectFactory::s_ctorsRegistry;
-thread_local MapOfStrClassIds ObjectFactory::s_classIdsRegistry;
-
 ObjectFactory *ObjectFactory::GetInstance()
 {
-    static thread_local ObjectFactory factory;
+    static ObjectFactory factory;
     return &factory;
 }
 
@@ -1581,8 +1593,8 @@ Object *ObjectFactory::Create(std::string name)
 {
     Object *object = NULL;
 
-    MapOfStrConstructors::iterator it = s_ctorsRegistry.find(name);
-    if (it != s_ctorsRegistry.end()) object = it->second();
+    MapOfStrConstructors::iterator it = m_ctorsRegistry.find(name);
+    if (it != m_ctorsRegistry.end()) object = it->second();
 
     if (object) {
         return object;
@@ -1597,8 +1609,8 @@ ClassId ObjectFactory::GetClassId(std::string name)
 {
     ClassId classId = OBJECT;
 
-    MapOfStrClassIds::iterator it = s_classIdsRegistry.find(name);
-    if (it != s_classIdsRegistry.end()) {
+    MapOfStrClassIds::iterator it = m_classIdsRegistry.find(name);
+    if (it != m_classIdsRegistry.end()) {
         classId = it->second;
     }
     else {
@@ -1611,8 +1623,8 @@ ClassId ObjectFactory::GetClassId(std::string name)
 void ObjectFactory::GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds)
 {
     for (const std::string &str : classStrings) {
-        if (s_classIdsRegistry.count(str) > 0) {
-            classIds.push_back(s_classIdsRegistry.at(str));
+        if (m_classIdsRegistry.count(str) > 0) {
+            classIds.push_back(m_classIdsRegistry.at(str));
         }
         else {
             LogDebug("Class name '%s' could not be matched", str.c_str());
@@ -1622,8 +1634,8 @@ void ObjectFactory::GetClassIds(const std::vector<std::string> &classStrings, st
 
 void ObjectFactory::Register(std::string name, ClassId classId, std::function<Object *(void)> function)
 {
-    s_ctorsRegistry[name] = function;
-    s_classIdsRegistry[name] = classId;
+    m_ctorsRegistry[name] = function;
+    m_classIdsRegistry[name] = classId;
 }
 
 } // namespace vrv
@@ -44,6 +44,9 @@ const std::map<int, std::string> Option::s_multiRestStyle = { { MULTIRESTSTYLE_a
 const std::map<int, std::string> Option::s_pedalStyle = { { PEDALSTYLE_NONE, "auto" }, { PEDALSTYLE_line, "line" },
     { PEDALSTYLE_pedstar, "pedstar" }, { PEDALSTYLE_altpedstar, "altpedstar" } };
 
+const std::map<int, std::string> Option::s_prepareData = { { PREPAREDATA_full, "full" },
+    { PREPAREDATA_incremental, "incremental" }, { PREPAREDATA_validate, "validate" } };
+
 const std::map<int, std::string> Option::s_systemDivider = { { SYSTEMDIVIDER_none, "none" },
     { SYSTEMDIVIDER_auto, "auto" }, { SYSTEMDIVIDER_left, "left" }, { SYSTEMDIVIDER_left_right, "left-right" } };
 
@@ -916,6 +919,14 @@ Options::Options()
     m_allPages.SetShortOption('a', true);
     m_baseOptions.AddOption(&m_allPages);
 
+    m_batch.SetInfo("Batch",
+        "Convert all the files listed in a file (one path or glob pattern per line, use \"-\" for the standard "
+        "input) and output a JSON summary; the output file is the output directory");
+    m_batch.Init("");
+    m_batch.SetKey("batch");
+    m_batch.SetShortOption('b', true);
+    m_baseOptions.AddOption(&m_batch);
+
     m_inputFrom.SetInfo("Input from",
         "Select input format from: \"abc\", \"darms\", \"humdrum\", \"mei\", \"pae\", \"xml\" (musicxml)");
     m_inputFrom.Init("mei");
@@ -923,6 +934,12 @@ Options::Options()
     m_inputFrom.SetShortOption('f', false);
     m_baseOptions.AddOption(&m_inputFrom);
 
+    m_batchJobs.SetInfo("Batch jobs", "Number of files converted concurrently in batch mode (0 for one per core)");
+    m_batchJobs.Init(0, 0, 256);
+    m_batchJobs.SetKey("batchJobs");
+    m_batchJobs.SetShortOption('j', true);
+    m_baseOptions.AddOption(&m_batchJobs);
+
     m_logLevel.SetInfo("Log level", "Set the log level: \"off\", \"error\", \"warning\", \"info\", or \"debug\"");
     m_logLevel.Init("warning");
     m_logLevel.SetKey("logLevel");
@@ -1023,6 +1040,11 @@ Options::Options()
     m_expand.Init("");
     this->Register(&m_expand, "expand", &m_general);
 
+    m_expandShared.SetInfo("Expand shared",
+        "Share the repeated elements of the expansion instead of cloning them, for the MIDI and timemap output");
+    m_expandShared.Init(false);
+    this->Register(&m_expandShared, "expandShared", &m_general);
+
     m_footer.SetInfo("Footer", "Control footer layout");
     m_footer.Init(FOOTER_auto, &Option::s_footer);
     this->Register(&m_footer, "footer", &m_general);
@@ -1062,6 +1084,7 @@ Options::Options()
 
     m_mmOutput.SetInfo("MM output", "Specify that the output in the SVG is given in mm (default is px)");
     m_mmOutput.Init(false);
+    m_mmOutput.SetRenderOnly(true);
     this->Register(&m_mmOutput, "mmOutput", &m_general);
 
     m_moveScoreDefinitionToStaff.SetInfo("Move score definition to staff",
@@ -1079,20 +1102,24 @@ Options::Options()
 
     m_outputIndent.SetInfo("Output indentation", "Output indentation value for MEI and SVG");
     m_outputIndent.Init(3, 1, 10);
+    m_outputIndent.SetRenderOnly(true);
     this->Register(&m_outputIndent, "outputIndent", &m_general);
 
     m_outputFormatRaw.SetInfo(
         "Raw formatting for MEI output", "Writes MEI out with no line indenting or non-content newlines.");
     m_outputFormatRaw.Init(false);
+    m_outputFormatRaw.SetRenderOnly(true);
     this->Register(&m_outputFormatRaw, "outputFormatRaw", &m_general);
 
     m_outputIndentTab.SetInfo("Output indentation with tab", "Output indentation with tabulation for MEI and SVG");
     m_outputIndentTab.Init(false);
+    m_outputIndentTab.SetRenderOnly(true);
     this->Register(&m_outputIndentTab, "outputIndentTab", &m_general);
 
     m_outputSmuflXmlEntities.SetInfo(
         "Output SMuFL XML entities", "Output SMuFL characters as XML entities instead of hex byte codes ");
     m_outputSmuflXmlEntities.Init(false);
+    m_outputSmuflXmlEntities.SetRenderOnly(true);
     this->Register(&m_outputSmuflXmlEntities, "outputSmuflXmlEntities", &m_general);
 
     m_pageHeight.SetInfo("Page height", "The page height");
@@ -1123,12 +1150,24 @@ Options::Options()
     m_pedalStyle.Init(PEDALSTYLE_NONE, &Option::s_pedalStyle);
     this->Register(&m_pedalStyle, "pedalStyle", &m_general);
 
+    m_prepareData.SetInfo(
+        "Prepare data", "The preparation of the data after an edit (validate compares incremental with full)");
+    m_prepareData.Init(PREPAREDATA_full, &Option::s_prepareData);
+    m_prepareData.SetRenderOnly(true);
+    this->Register(&m_prepareData, "prepareData", &m_general);
+
     m_preserveAnalyticalMarkup.SetInfo("Preserve analytical markup", "Preserves the analytical markup in MEI");
     m_preserveAnalyticalMarkup.Init(false);
     this->Register(&m_preserveAnalyticalMarkup, "preserveAnalyticalMarkup", &m_general);
 
+    m_profile.SetInfo("Profile", "Collect timings and counters for the processing stages (see getProfile)");
+    m_profile.Init(false);
+    m_profile.SetRenderOnly(true);
+    this->Register(&m_profile, "profile", &m_general);
+
     m_removeIds.SetInfo("Remove IDs in MEI", "Remove XML IDs in the MEI output that are not referenced");
     m_removeIds.Init(false);
+    m_removeIds.SetRenderOnly(true);
     this->Register(&m_removeIds, "removeIds", &m_general);
 
     m_scaleToPageSize.SetInfo(
@@ -1138,6 +1177,7 @@ Options::Options()
 
     m_showRuntime.SetInfo("Show runtime on CLI", "Display the total runtime on command-line");
     m_showRuntime.Init(false);
+    m_showRuntime.SetRenderOnly(true);
     this->Register(&m_showRuntime, "showRuntime", &m_general);
 
     m_shrinkToFit.SetInfo("Shrink content to fit page", "Scale down page content to fit the page height if needed");
@@ -1146,6 +1186,7 @@ Options::Options()
 
     m_smuflTextFont.SetInfo("Smufl text font", "Specify if the smufl text font is embedded, linked, or ignored");
     m_smuflTextFont.Init(SMUFLTEXTFONT_embedded, &Option::s_smuflTextFont);
+    m_smuflTextFont.SetRenderOnly(true);
     this->Register(&m_smuflTextFont, "smuflTextFont", &m_general);
 
     m_staccatoCenter.SetInfo(
@@ -1155,37 +1196,55 @@ Options::Options()
 
     m_svgBoundingBoxes.SetInfo("Svg bounding boxes viewbox on svg root", "Include bounding boxes in SVG output");
     m_svgBoundingBoxes.Init(false);
+    m_svgBoundingBoxes.SetRenderOnly(true);
     this->Register(&m_svgBoundingBoxes, "svgBoundingBoxes", &m_general);
 
     m_svgCss.SetInfo("SVG additional CSS", "CSS (as a string) to be added to the SVG output");
     m_svgCss.Init("");
+    m_svgCss.SetRenderOnly(true);
     this->Register(&m_svgCss, "svgCss", &m_general);
 
     m_svgViewBox.SetInfo("Use viewbox on svg root", "Use viewBox on svg root element for easy scaling of document");
     m_svgViewBox.Init(false);
+    m_svgViewBox.SetRenderOnly(true);
     this->Register(&m_svgViewBox, "svgViewBox", &m_general);
 
     m_svgHtml5.SetInfo("Output SVG for HTML5 embedding",
         "Write data-id and data-class attributes for JS usage and id clash avoidance");
     m_svgHtml5.Init(false);
+    m_svgHtml5.SetRenderOnly(true);
     this->Register(&m_svgHtml5, "svgHtml5", &m_general);
 
     m_svgFormatRaw.SetInfo(
         "Raw formatting for SVG output", "Writes SVG out with no line indenting or non-content newlines");
     m_svgFormatRaw.Init(false);
+    m_svgFormatRaw.SetRenderOnly(true);
     this->Register(&m_svgFormatRaw, "svgFormatRaw", &m_general);
 
+    m_svgPageCache.SetInfo("Cache the SVG pages",
+        "Keep the SVG of the rendered pages so that a scale change only rescales them without rendering them again");
+    m_svgPageCache.Init(false);
+    m_svgPageCache.SetRenderOnly(true);
+    this->Register(&m_svgPageCache, "svgPageCache", &m_general);
+
     m_svgRemoveXlink.SetInfo("Remove xlink: from href attributes",
         "Removes the xlink: prefix on href attributes for compatibility with some newer browsers");
     m_svgRemoveXlink.Init(false);
+    m_svgRemoveXlink.SetRenderOnly(true);
     this->Register(&m_svgRemoveXlink, "svgRemoveXlink", &m_general);
 
     m_svgAdditionalAttribute.SetInfo("Add additional attribute in SVG",
         "Add additional attribute for graphical elements in SVG as \"data-*\", for "
         "example, \"note@pname\" would add a \"data-pname\" to all note elements");
     m_svgAdditionalAttribute.Init();
+    m_svgAdditionalAttribute.SetRenderOnly(true);
     this->Register(&m_svgAdditionalAttribute, "svgAdditionalAttribute", &m_general);
 
+    m_threads.SetInfo("Threads", "Number of threads used for concurrent processing (0 or 1 for none)");
+    m_threads.Init(0, 0, 64);
+    m_threads.SetRenderOnly(true);
+    this->Register(&m_threads, "threads", &m_general);
+
     m_unit.SetInfo("Unit", "The MEI unit (1⁄2 of the distance between the staff lines)");
     m_unit.Init(9.0, 4.5, 12.0, true);
     this->Register(&m_unit, "unit", &m_general);
@@ -1210,6 +1269,7 @@ Options::Options()
     m_xmlIdChecksum.SetInfo(
         "XML IDs based on checksum", "Seed the generator for XML IDs using the checksum of the input data");
     m_xmlIdChecksum.Init(false);
+    m_xmlIdChecksum.SetRenderOnly(true);
     this->Register(&m_xmlIdChecksum, "xmlIdChecksum", &m_general);
 
     /********* General layout *********/
@@ -1792,10 +1852,12 @@ Options::Options()
 
     m_midiNoCue.SetInfo("MIDI playback of cue notes", "Skip cue notes in MIDI output");
     m_midiNoCue.Init(false);
+    m_midiNoCue.SetRenderOnly(true);
     this->Register(&m_midiNoCue, "midiNoCue", &m_midi);
 
     m_midiTempoAdjustment.SetInfo("MIDI tempo adjustment", "The MIDI tempo adjustment factor");
     m_midiTempoAdjustment.Init(1.0, 0.2, 4.0);
+    m_midiTempoAdjustment.SetRenderOnly(true);
     this->Register(&m_midiTempoAdjustment, "midiTempoAdjustment", &m_midi);
 
     /********* Deprecated options *********/
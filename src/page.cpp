@@ -59,10 +59,12 @@
 #include "pgfoot2.h"
 #include "pghead.h"
 #include "pghead2.h"
+#include "profiler.h"
 #include "resetfunctor.h"
 #include "score.h"
 #include "staff.h"
 #include "system.h"
+#include "threadpool.h"
 #include "view.h"
 #include "vrv.h"
 
@@ -281,6 +283,8 @@ void Page::LayOutTranscription(bool force)
 
 void Page::ResetAligners()
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "ResetAligners");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -362,6 +366,8 @@ void Page::ResetAligners()
 
 void Page::LayOutHorizontally()
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "LayOutHorizontally");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -469,6 +475,8 @@ void Page::LayOutHorizontallyWithCache(bool restore)
 
 void Page::LayOutVertically()
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "LayOutVertically");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -481,7 +489,7 @@ void Page::LayOutVertically()
     this->Process(resetVerticalAlignment);
 
     CalcLedgerLinesFunctor calcLedgerLines(doc);
-    this->Process(calcLedgerLines);
+    this->ProcessSystems(calcLedgerLines);
 
     // Align the content of the page using system aligners
     // After this:
@@ -503,15 +511,19 @@ void Page::LayOutVertically()
 
     // Adjust the position of the beams in regards of layer elements
     AdjustBeamsFunctor adjustBeams(doc);
-    this->Process(adjustBeams);
+    this->ProcessSystems(adjustBeams);
 
     // Adjust the position of the tuplets
     AdjustTupletsYFunctor adjustTupletsY(doc);
-    this->Process(adjustTupletsY);
+    this->ProcessSystems(adjustTupletsY);
 
     // Adjust the position of the slurs
     AdjustSlursFunctor adjustSlurs(doc);
-    this->Process(adjustSlurs);
+    const std::function<void(const AdjustSlursFunctor &)> mergeCrossStaffSlurs
+        = [&adjustSlurs](const AdjustSlursFunctor &systemAdjustSlurs) {
+              if (systemAdjustSlurs.HasCrossStaffSlurs()) adjustSlurs.SetCrossStaffSlurs(true);
+          };
+    this->ProcessSystems(adjustSlurs, mergeCrossStaffSlurs);
 
     // At this point slurs must not be reinitialized, otherwise the adjustment we just did was in vain
     view.SetSlurHandling(SlurHandling::Drawing);
@@ -524,15 +536,15 @@ void Page::LayOutVertically()
 
     // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
     CalcBBoxOverflowsFunctor calcBBoxOverflows(doc);
-    this->Process(calcBBoxOverflows);
+    this->ProcessSystems(calcBBoxOverflows);
 
     // Adjust the positioners of floating elements (slurs, hairpin, dynam, etc)
     AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
-    this->Process(adjustFloatingPositioners);
+    this->ProcessSystems(adjustFloatingPositioners);
 
     // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
     AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
-    this->Process(adjustStaffOverlap);
+    this->ProcessSystems(adjustStaffOverlap);
 
     // Set the Y position of each StaffAlignment
     // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
@@ -551,7 +563,7 @@ void Page::LayOutVertically()
         view.SetSlurHandling(SlurHandling::Initialize);
         view.SetPage(this->GetIdx(), false);
         view.DrawCurrentPage(&bBoxDC, false);
-        this->Process(adjustSlurs);
+        this->ProcessSystems(adjustSlurs);
     }
 
     doc->SetCurrentScore(this->m_score);
@@ -571,8 +583,83 @@ void Page::LayOutVertically()
     this->Process(alignSystems);
 }
 
+template <class FUNCTOR>
+void Page::ProcessSystems(FUNCTOR &functor, const std::function<void(const FUNCTOR &)> &merge)
+{
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+
+    // Only the functors marked as thread safe are run concurrently
+    ThreadPool *threadPool = doc->GetThreadPool();
+    if (!threadPool || !functor.IsThreadSafe()) {
+        this->Process(functor);
+        return;
+    }
+
+    // This mirrors Object::Process for a forward traversal without filters
+    assert(functor.GetDirection() == FORWARD);
+    assert(!functor.GetFilters());
+
+    if (functor.GetCode() == FUNCTOR_STOP) return;
+
+    // Process the consecutive systems concurrently
+    std::vector<System *> concurrentSystems;
+    auto processConcurrentSystems = [&]() {
+        if (concurrentSystems.empty()) return;
+
+#ifndef NDEBUG
+        const bool wasModified = this->IsModified();
+#endif
+
+        std::vector<FUNCTOR> systemFunctors(concurrentSystems.size(), functor);
+        threadPool->Run((int)concurrentSystems.size(),
+            [&concurrentSystems, &systemFunctors](int i) { concurrentSystems.at(i)->Process(systemFunctors.at(i)); });
+        concurrentSystems.clear();
+
+        // Any modification would have been propagated to the page
+        assert(wasModified || !this->IsModified());
+
+        for (const FUNCTOR &systemFunctor : systemFunctors) {
+            // Stopping is order dependent and cannot be processed concurrently
+            assert(systemFunctor.GetCode() != FUNCTOR_STOP);
+            if (merge) merge(systemFunctor);
+        }
+    };
+
+    functor.SetCode(this->Accept(functor));
+
+    // Do not go any deeper in this case
+    if (functor.GetCode() == FUNCTOR_SIBLINGS) {
+        functor.SetCode(FUNCTOR_CONTINUE);
+        return;
+    }
+
+    for (Object *child : this->GetChildren()) {
+        if (functor.GetCode() == FUNCTOR_STOP) break;
+        // Systems sharing elements with other systems are processed with the functor itself once the preceding
+        // systems are done and before the following ones are started, as in the sequential processing.
+        // The lazily-built list of the current scoreDef is the only one read outside the system, so we also stay
+        // sequential if it is not up-to-date since it would otherwise be rebuilt from several threads.
+        if (child->Is(SYSTEM) && !vrv_cast<System *>(child)->m_systemAligner.HasCrossSystemPositioners()
+            && !doc->GetCurrentScoreDef()->IsModified()) {
+            concurrentSystems.push_back(vrv_cast<System *>(child));
+            continue;
+        }
+        // Other children (e.g., score milestones changing the current scoreDef) are also processed in order
+        processConcurrentSystems();
+        child->Process(functor);
+    }
+    processConcurrentSystems();
+
+    if (functor.ImplementsEndInterface()) {
+        functor.SetCode(this->AcceptEnd(functor));
+    }
+}
+
 void Page::JustifyHorizontally()
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "JustifyHorizontally");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -599,6 +686,8 @@ void Page::JustifyHorizontally()
 
 void Page::JustifyVertically()
 {
+    ProfilerScope profilerScope(PROFILER_LAYOUT, "JustifyVertically");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -749,6 +838,7 @@ void Page::AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc)
     Filters filters;
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    // The page is traversed with filters since AdjustSylSpacingFunctor also visits the systems and the measures
     for (staves = verseTree.child.begin(); staves != verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
@@ -66,13 +66,6 @@ FunctorCode PrepareDataInitializationFunctor::VisitChord(Chord *chord)
     return FUNCTOR_CONTINUE;
 }
 
-FunctorCode PrepareDataInitializationFunctor::VisitFloatingObject(FloatingObject *floatingObject)
-{
-    floatingObject->ResetDrawingObjectIDs();
-
-    return FUNCTOR_CONTINUE;
-}
-
 FunctorCode PrepareDataInitializationFunctor::VisitKeySig(KeySig *keySig)
 {
     // Clear and regenerate attribute children
@@ -1214,7 +1207,8 @@ FunctorCode PrepareLayerElementPartsFunctor::VisitTuplet(Tuplet *tuplet)
         }
     }
     // Is a beam or bTrem the only child? (will not work with editorial elements)
-    if (tuplet->GetChildCount() == 1) {
+    // The bracket and the num added when the data was prepared before are not counted
+    if (tuplet->GetChildCount() - tuplet->GetChildCount(TUPLET_BRACKET) - tuplet->GetChildCount(TUPLET_NUM) == 1) {
         if ((tuplet->GetChildCount(BEAM) == 1) || (tuplet->GetChildCount(BTREM) == 1)) beamed = true;
     }
 
@@ -1481,6 +1475,8 @@ PrepareFloatingGrpsFunctor::PrepareFloatingGrpsFunctor(Doc *doc) : DocFunctor(do
 
 FunctorCode PrepareFloatingGrpsFunctor::VisitDir(Dir *dir)
 {
+    // The groups are set again for the entire document also when only some measures are prepared
+    dir->SetDrawingGrpId(0);
     if (dir->HasVgrp()) {
         dir->SetDrawingGrpId(-dir->GetVgrp());
     }
@@ -1490,6 +1486,7 @@ FunctorCode PrepareFloatingGrpsFunctor::VisitDir(Dir *dir)
 
 FunctorCode PrepareFloatingGrpsFunctor::VisitDynam(Dynam *dynam)
 {
+    dynam->SetDrawingGrpId(0);
     if (dynam->HasVgrp()) {
         dynam->SetDrawingGrpId(-dynam->GetVgrp());
     }
@@ -1504,6 +1501,7 @@ FunctorCode PrepareFloatingGrpsFunctor::VisitDynam(Dynam *dynam)
 
 FunctorCode PrepareFloatingGrpsFunctor::VisitEnding(Ending *ending)
 {
+    ending->SetDrawingGrpId(0);
     if (m_previousEnding) {
         // We need to group the previous and this ending - the previous one should have a grpId
         if (m_previousEnding->GetDrawingGrpId() == 0) {
@@ -1520,6 +1518,10 @@ FunctorCode PrepareFloatingGrpsFunctor::VisitEnding(Ending *ending)
 
 FunctorCode PrepareFloatingGrpsFunctor::VisitHairpin(Hairpin *hairpin)
 {
+    // The links are set again at the end of the measure (see VisitMeasureEnd)
+    hairpin->SetDrawingGrpId(0);
+    hairpin->SetLeftLink(NULL);
+    hairpin->SetRightLink(NULL);
     if (hairpin->HasVgrp()) {
         hairpin->SetDrawingGrpId(-hairpin->GetVgrp());
     }
@@ -1655,6 +1657,7 @@ FunctorCode PrepareFloatingGrpsFunctor::VisitMeasureEnd(Measure *measure)
 
 FunctorCode PrepareFloatingGrpsFunctor::VisitPedal(Pedal *pedal)
 {
+    pedal->SetDrawingGrpId(0);
     if (pedal->HasVgrp()) {
         pedal->SetDrawingGrpId(-pedal->GetVgrp());
     }
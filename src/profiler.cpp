@@ -0,0 +1,176 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        profiler.cpp
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "profiler.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <typeinfo>
+
+#ifdef __GNUG__
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "functor.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Static members
+//----------------------------------------------------------------------------
+
+std::atomic<int> Profiler::s_enabledCount(0);
+std::atomic<long> Profiler::s_counters[PROFILER_COUNTER_COUNT] = {};
+std::mutex Profiler::s_mutex;
+std::map<std::string, Profiler::Timing> Profiler::s_timings[PROFILER_CATEGORY_COUNT];
+thread_local ProfilerScope *ProfilerScope::s_current = NULL;
+
+static const char *s_categoryNames[PROFILER_CATEGORY_COUNT] = { "toolkit", "io", "layout", "functors" };
+static const char *s_counterNames[PROFILER_COUNTER_COUNT]
+    = { "objectsVisited", "objectsCreated", "alignmentsCreated" };
+
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+void Profiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (int i = 0; i < PROFILER_CATEGORY_COUNT; ++i) {
+        s_timings[i].clear();
+    }
+    for (int i = 0; i < PROFILER_COUNTER_COUNT; ++i) {
+        s_counters[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::AddTiming(
+    ProfilerCategory category, const std::string &name, double seconds, double selfSeconds, long visits)
+{
+    assert((category >= 0) && (category < PROFILER_CATEGORY_COUNT));
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    Timing &timing = s_timings[category][name];
+    ++timing.calls;
+    timing.seconds += seconds;
+    timing.selfSeconds += selfSeconds;
+    timing.visits += visits;
+}
+
+std::string Profiler::GetReport()
+{
+    jsonxx::Object report;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (int i = 0; i < PROFILER_CATEGORY_COUNT; ++i) {
+        jsonxx::Object category;
+        for (const auto &entry : s_timings[i]) {
+            jsonxx::Object timing;
+            timing << "calls" << entry.second.calls;
+            timing << "time" << entry.second.seconds;
+            timing << "self" << entry.second.selfSeconds;
+            if (i == PROFILER_FUNCTOR) timing << "visits" << entry.second.visits;
+            category << entry.first << timing;
+        }
+        report << s_categoryNames[i] << category;
+    }
+
+    jsonxx::Object counters;
+    for (int i = 0; i < PROFILER_COUNTER_COUNT; ++i) {
+        counters << s_counterNames[i] << s_counters[i].load(std::memory_order_relaxed);
+    }
+    report << "counters" << counters;
+
+    return report.json();
+}
+
+//----------------------------------------------------------------------------
+// ProfilerScope
+//----------------------------------------------------------------------------
+
+ProfilerScope::ProfilerScope(ProfilerCategory category, const char *name)
+{
+    m_functor = NULL;
+    m_category = category;
+    m_name = name;
+    m_parent = NULL;
+    m_nestedSeconds = 0.0;
+    m_active = Profiler::IsEnabled();
+    if (m_active) {
+        m_parent = s_current;
+        s_current = this;
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+ProfilerScope::ProfilerScope(FunctorBase &functor)
+{
+    m_functor = NULL;
+    m_category = PROFILER_FUNCTOR;
+    m_name = NULL;
+    m_parent = NULL;
+    m_nestedSeconds = 0.0;
+    m_active = false;
+
+    if (!Profiler::IsEnabled()) return;
+
+    Profiler::Count(PROFILER_OBJECTS_VISITED);
+
+    m_functor = &functor;
+    const int depth = m_functor->GetProcessDepth();
+    m_functor->SetProcessDepth(depth + 1);
+    // Only the outermost call is measured
+    if (depth == 0) {
+        m_active = true;
+        m_parent = s_current;
+        s_current = this;
+        m_functor->ResetVisitCount();
+        m_start = std::chrono::steady_clock::now();
+    }
+    m_functor->IncreaseVisitCount();
+}
+
+ProfilerScope::~ProfilerScope()
+{
+    if (m_functor) m_functor->SetProcessDepth(m_functor->GetProcessDepth() - 1);
+
+    if (!m_active) return;
+
+    using namespace std::chrono;
+    const double elapsed = duration<double, seconds::period>(steady_clock::now() - m_start).count();
+
+    s_current = m_parent;
+    if (m_parent && (m_parent->m_category == m_category)) m_parent->m_nestedSeconds += elapsed;
+
+    if (!m_functor) {
+        Profiler::AddTiming(m_category, m_name, elapsed, elapsed - m_nestedSeconds);
+        return;
+    }
+
+    // Name the timing after the functor class
+    std::string name = typeid(*m_functor).name();
+#ifdef __GNUG__
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name.c_str(), NULL, NULL, &status);
+    if (status == 0) name = demangled;
+    free(demangled);
+#endif
+    if (name.compare(0, 6, "class ") == 0) name.erase(0, 6);
+    if (name.compare(0, 5, "vrv::") == 0) name.erase(0, 5);
+
+    Profiler::AddTiming(m_category, name, elapsed, elapsed - m_nestedSeconds, m_functor->GetVisitCount());
+}
+
+} // namespace vrv
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <mutex>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -23,11 +24,15 @@
 
 namespace vrv {
 
+/** The maximum number of entries in the text extent cache before it gets emptied */
+static const size_t TEXT_EXTENT_CACHE_MAX_SIZE = 65536;
+
 //----------------------------------------------------------------------------
 // Static members with some default values
 //----------------------------------------------------------------------------
 
-thread_local std::string Resources::s_defaultPath = VRV_RESOURCE_DIR;
+std::string Resources::s_defaultPath = VRV_RESOURCE_DIR;
+std::mutex Resources::s_defaultPathMutex;
 const Resources::StyleAttributes Resources::k_defaultStyle{ data_FONTWEIGHT::FONTWEIGHT_normal,
     data_FONTSTYLE::FONTSTYLE_normal };
 
@@ -46,8 +51,21 @@ void SetDefaultResourcePath(const std::string &path)
 
 Resources::Resources()
 {
-    m_path = s_defaultPath;
+    m_path = Resources::GetDefaultPath();
     m_currentStyle = k_defaultStyle;
+    m_currentAsciiGlyphs = NULL;
+}
+
+std::string Resources::GetDefaultPath()
+{
+    std::lock_guard<std::mutex> lock(s_defaultPathMutex);
+    return s_defaultPath;
+}
+
+void Resources::SetDefaultPath(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(s_defaultPathMutex);
+    s_defaultPath = path;
 }
 
 bool Resources::InitFonts()
@@ -82,6 +100,7 @@ bool Resources::InitFonts()
     }
 
     m_currentStyle = k_defaultStyle;
+    this->UpdateCurrentAsciiGlyphs();
 
     return true;
 }
@@ -130,11 +149,17 @@ void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontSt
         LogWarning("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
         m_currentStyle = k_defaultStyle;
     }
+    this->UpdateCurrentAsciiGlyphs();
 }
 
 const Glyph *Resources::GetTextGlyph(char32_t code) const
 {
-    const StyleAttributes style = (m_textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
+    // Fast path for ASCII chars with the flat table of the current style
+    if (code < std::tuple_size<AsciiGlyphTable>::value) {
+        return (m_currentAsciiGlyphs) ? (*m_currentAsciiGlyphs)[code] : NULL;
+    }
+
+    const StyleAttributes style = this->GetUsedTextStyle();
     if (m_textFont.count(style) == 0) return NULL;
 
     const GlyphTable &currentTable = m_textFont.at(style);
@@ -145,6 +170,61 @@ const Glyph *Resources::GetTextGlyph(char32_t code) const
     return &currentTable.at(code);
 }
 
+Resources::StyleAttributes Resources::GetUsedTextStyle() const
+{
+    return (m_textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
+}
+
+void Resources::UpdateCurrentAsciiGlyphs() const
+{
+    const StyleAttributes style = this->GetUsedTextStyle();
+    m_currentAsciiGlyphs = (m_asciiTextGlyphs.count(style) != 0) ? &m_asciiTextGlyphs.at(style) : NULL;
+}
+
+size_t Resources::TextExtentKeyHash::operator()(const TextExtentKey &key) const
+{
+    size_t hash = std::hash<std::u32string>()(key.m_text);
+    const size_t params = ((size_t)key.m_pointSize << 16) ^ ((size_t)key.m_style.first << 8)
+        ^ ((size_t)key.m_style.second << 4) ^ ((size_t)key.m_isSmufl << 1) ^ (size_t)key.m_typeSize;
+    hash ^= params + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+Resources::TextExtentKey Resources::MakeTextExtentKey(
+    const std::u32string &text, int pointSize, bool isSmufl, bool typeSize) const
+{
+    // SMuFL extents do not depend on the text style
+    const StyleAttributes style = (isSmufl) ? k_defaultStyle : this->GetUsedTextStyle();
+    return { text, pointSize, style, isSmufl, typeSize };
+}
+
+bool Resources::GetCachedTextExtent(
+    const std::u32string &text, int pointSize, bool isSmufl, bool typeSize, TextExtend &extend) const
+{
+    const TextExtentKey key = this->MakeTextExtentKey(text, pointSize, isSmufl, typeSize);
+    std::shared_lock<std::shared_mutex> lock(m_textExtentCacheMutex);
+    TextExtentCache::const_iterator it = m_textExtentCache.find(key);
+    if (it == m_textExtentCache.end()) return false;
+    extend = it->second;
+    return true;
+}
+
+void Resources::SetCachedTextExtent(
+    const std::u32string &text, int pointSize, bool isSmufl, bool typeSize, const TextExtend &extend) const
+{
+    TextExtentKey key = this->MakeTextExtentKey(text, pointSize, isSmufl, typeSize);
+    std::unique_lock<std::shared_mutex> lock(m_textExtentCacheMutex);
+    // Keep the memory bounded with very large documents with mostly unique strings
+    if (m_textExtentCache.size() >= TEXT_EXTENT_CACHE_MAX_SIZE) m_textExtentCache.clear();
+    m_textExtentCache.emplace(std::move(key), extend);
+}
+
+void Resources::ResetTextExtentCache()
+{
+    std::unique_lock<std::shared_mutex> lock(m_textExtentCacheMutex);
+    m_textExtentCache.clear();
+}
+
 char32_t Resources::GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar)
 {
     char32_t smuflChar = unicodeChar;
@@ -217,6 +297,8 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
     }
 
     m_fontName = fontName;
+    // Extents can use glyphs of the music font
+    this->ResetTextExtentCache();
     return true;
 }
 
@@ -265,6 +347,15 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
             currentTable[code] = glyph;
         }
     }
+
+    // Rebuild the flat ASCII table since the glyphs in the table might have changed
+    AsciiGlyphTable &asciiTable = m_asciiTextGlyphs[style];
+    for (char32_t code = 0; code < asciiTable.size(); ++code) {
+        asciiTable[code] = (currentTable.count(code) != 0) ? &currentTable.at(code) : NULL;
+    }
+    this->UpdateCurrentAsciiGlyphs();
+    this->ResetTextExtentCache();
+
     return true;
 }
 
@@ -661,16 +661,16 @@ void Slur::FilterSpannedElements(FloatingCurvePositioner *curve, const BezierCur
     const int dist = bezierCurve.p2.x - bezierCurve.p1.x;
 
     const ArrayOfCurveSpannedElements *spannedElements = curve->GetSpannedElements();
+    const std::vector<CurveAdjustment> adjustments = curve->CalcSpannedElementAdjustments(margin);
 
-    for (CurveSpannedElement *spannedElement : *spannedElements) {
+    for (int i = 0; i < (int)spannedElements->size(); ++i) {
+        CurveSpannedElement *spannedElement = spannedElements->at(i);
 
         if (spannedElement->m_discarded) {
             continue;
         }
 
-        bool discard = false;
-        const int intersection = curve->CalcDirectionalAdjustment(
-            spannedElement->m_boundingBox, spannedElement->m_isBelow, discard, margin);
+        const int intersection = std::max(adjustments.at(i).left, adjustments.at(i).right);
         const int xMiddle
             = (spannedElement->m_boundingBox->GetSelfLeft() + spannedElement->m_boundingBox->GetSelfRight()) / 2.0;
         const float distanceRatio = float(xMiddle - bezierCurve.p1.x) / float(dist);
@@ -705,15 +705,15 @@ NearEndCollision Slur::DetectCollisionsNearEnd(
     if (bezierCurve.p1.x >= bezierCurve.p2.x) return nearEndCollision;
 
     const ArrayOfCurveSpannedElements *spannedElements = curve->GetSpannedElements();
-    for (CurveSpannedElement *spannedElement : *spannedElements) {
+    const std::vector<CurveAdjustment> adjustments = curve->CalcSpannedElementAdjustments(margin);
+    for (int i = 0; i < (int)spannedElements->size(); ++i) {
+        CurveSpannedElement *spannedElement = spannedElements->at(i);
         if (spannedElement->m_discarded) {
             continue;
         }
 
-        bool discard = false;
-        int intersectionLeft, intersectionRight;
-        std::tie(intersectionLeft, intersectionRight) = curve->CalcDirectionalLeftRightAdjustment(
-            spannedElement->m_boundingBox, spannedElement->m_isBelow, discard, margin);
+        const int intersectionLeft = adjustments.at(i).left;
+        const int intersectionRight = adjustments.at(i).right;
 
         if ((intersectionLeft > 0) || (intersectionRight > 0)) {
             Point points[4];
@@ -753,18 +753,18 @@ std::pair<int, int> Slur::CalcEndPointShift(
     const int dist = bezierCurve.p2.x - bezierCurve.p1.x;
 
     const ArrayOfCurveSpannedElements *spannedElements = curve->GetSpannedElements();
-    for (CurveSpannedElement *spannedElement : *spannedElements) {
+    const std::vector<CurveAdjustment> adjustments = curve->CalcSpannedElementAdjustments(margin);
+    for (int i = 0; i < (int)spannedElements->size(); ++i) {
+        CurveSpannedElement *spannedElement = spannedElements->at(i);
 
         if (spannedElement->m_discarded) {
             continue;
         }
 
-        bool discard = false;
-        int intersectionLeft, intersectionRight;
-        std::tie(intersectionLeft, intersectionRight) = curve->CalcDirectionalLeftRightAdjustment(
-            spannedElement->m_boundingBox, spannedElement->m_isBelow, discard, margin);
+        const int intersectionLeft = adjustments.at(i).left;
+        const int intersectionRight = adjustments.at(i).right;
 
-        if (discard) {
+        if (adjustments.at(i).discard) {
             spannedElement->m_discarded = true;
             continue;
         }
@@ -1018,18 +1018,18 @@ ControlPointAdjustment Slur::CalcControlPointVerticalShift(
 
     const ArrayOfCurveSpannedElements *spannedElements = curve->GetSpannedElements();
 
-    for (CurveSpannedElement *spannedElement : *spannedElements) {
+    const std::vector<CurveAdjustment> adjustments = curve->CalcSpannedElementAdjustments(margin);
+    for (int i = 0; i < (int)spannedElements->size(); ++i) {
+        CurveSpannedElement *spannedElement = spannedElements->at(i);
 
         if (spannedElement->m_discarded) {
             continue;
         }
 
-        bool discard = false;
-        int intersectionLeft, intersectionRight;
-        std::tie(intersectionLeft, intersectionRight) = curve->CalcDirectionalLeftRightAdjustment(
-            spannedElement->m_boundingBox, spannedElement->m_isBelow, discard, margin);
+        const int intersectionLeft = adjustments.at(i).left;
+        const int intersectionRight = adjustments.at(i).right;
 
-        if (discard) {
+        if (adjustments.at(i).discard) {
             spannedElement->m_discarded = true;
             continue;
         }
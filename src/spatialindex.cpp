@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        spatialindex.cpp
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "spatialindex.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <unordered_set>
+#include <utility>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+/** The maximum number of children of a node */
+static const int NODE_CAPACITY = 16;
+
+//----------------------------------------------------------------------------
+// SpatialIndex
+//----------------------------------------------------------------------------
+
+SpatialIndex::SpatialIndex()
+{
+    this->Reset();
+}
+
+void SpatialIndex::Reset()
+{
+    m_entries.clear();
+    m_levels.clear();
+    m_packedCount = 0;
+    m_removedCount = 0;
+    m_isBuilt = false;
+}
+
+void SpatialIndex::Insert(const Object *object, int x1, int y1, int x2, int y2)
+{
+    assert(object);
+
+    m_entries.push_back({ { std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2) }, object });
+
+    // Pack the tree again once the boxes searched linearly become too many
+    if (m_isBuilt && (this->GetUnpackedCount() > std::max(4 * NODE_CAPACITY, m_packedCount / 4))) this->Build();
+}
+
+void SpatialIndex::Remove(const Object *object)
+{
+    for (Entry &entry : m_entries) {
+        if (entry.m_object != object) continue;
+        entry.m_object = NULL;
+        ++m_removedCount;
+    }
+
+    if (m_isBuilt && (m_removedCount > std::max(4 * NODE_CAPACITY, m_packedCount / 4))) this->Build();
+}
+
+void SpatialIndex::Build()
+{
+    m_levels.clear();
+
+    if (m_removedCount > 0) {
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                            [](const Entry &entry) { return (entry.m_object == NULL); }),
+            m_entries.end());
+        m_removedCount = 0;
+    }
+
+    if (!m_entries.empty()) {
+        m_levels.push_back(this->PackLevel(m_entries));
+        // Group the nodes until we have a single root node
+        while (m_levels.back().size() > 1) {
+            std::vector<Node> upperLevel = this->PackLevel(m_levels.back());
+            m_levels.push_back(std::move(upperLevel));
+        }
+    }
+
+    m_packedCount = (int)m_entries.size();
+    m_isBuilt = true;
+}
+
+template <class ITEM> std::vector<SpatialIndex::Node> SpatialIndex::PackLevel(std::vector<ITEM> &items) const
+{
+    const int count = (int)items.size();
+    const int nodeCount = (count + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    // The items are split in vertical slices of sliceCount nodes each
+    const int sliceCount = (int)std::ceil(std::sqrt((double)nodeCount));
+    const int sliceSize = sliceCount * NODE_CAPACITY;
+
+    // Sorting by doubled centers avoids the rounding of the division
+    auto centerX = [](const ITEM &item) { return (long long)item.m_rect.m_x1 + item.m_rect.m_x2; };
+    auto centerY = [](const ITEM &item) { return (long long)item.m_rect.m_y1 + item.m_rect.m_y2; };
+
+    std::sort(items.begin(), items.end(),
+        [&centerX](const ITEM &item1, const ITEM &item2) { return centerX(item1) < centerX(item2); });
+    for (int first = 0; first < count; first += sliceSize) {
+        const int last = std::min(first + sliceSize, count);
+        std::sort(items.begin() + first, items.begin() + last,
+            [&centerY](const ITEM &item1, const ITEM &item2) { return centerY(item1) < centerY(item2); });
+    }
+
+    std::vector<Node> nodes;
+    nodes.reserve(nodeCount);
+    for (int first = 0; first < count; first += NODE_CAPACITY) {
+        Node node;
+        node.m_first = first;
+        node.m_count = std::min(NODE_CAPACITY, count - first);
+        node.m_rect = items.at(first).m_rect;
+        for (int i = first + 1; i < first + node.m_count; ++i) {
+            const Rect &rect = items.at(i).m_rect;
+            node.m_rect.m_x1 = std::min(node.m_rect.m_x1, rect.m_x1);
+            node.m_rect.m_y1 = std::min(node.m_rect.m_y1, rect.m_y1);
+            node.m_rect.m_x2 = std::max(node.m_rect.m_x2, rect.m_x2);
+            node.m_rect.m_y2 = std::max(node.m_rect.m_y2, rect.m_y2);
+        }
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+template <class VISITOR> void SpatialIndex::Search(const Rect &query, VISITOR visitor) const
+{
+    // The boxes not packed yet
+    for (int i = m_packedCount; i < (int)m_entries.size(); ++i) {
+        if (m_entries[i].m_object && m_entries[i].m_rect.Intersects(query)) visitor(m_entries[i]);
+    }
+
+    if (m_levels.empty()) return;
+
+    // The nodes to visit as (level, index) pairs, starting with the root level
+    std::vector<std::pair<int, int>> stack;
+    const int rootLevel = (int)m_levels.size() - 1;
+    for (int i = 0; i < (int)m_levels.at(rootLevel).size(); ++i) stack.push_back({ rootLevel, i });
+
+    while (!stack.empty()) {
+        const auto [level, index] = stack.back();
+        stack.pop_back();
+        const Node &node = m_levels[level][index];
+        if (!node.m_rect.Intersects(query)) continue;
+        for (int child = node.m_first; child < node.m_first + node.m_count; ++child) {
+            if (level > 0) {
+                stack.push_back({ level - 1, child });
+            }
+            else if (m_entries[child].m_object && m_entries[child].m_rect.Intersects(query)) {
+                visitor(m_entries[child]);
+            }
+        }
+    }
+}
+
+std::vector<const Object *> SpatialIndex::FindAtPoint(int x, int y) const
+{
+    std::vector<const Entry *> entries;
+    this->Search({ x, y, x, y }, [&entries](const Entry &entry) { entries.push_back(&entry); });
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry *entry1, const Entry *entry2) {
+        return entry1->m_rect.GetArea() < entry2->m_rect.GetArea();
+    });
+
+    // An object with several boxes is listed once with its smallest box
+    std::vector<const Object *> objects;
+    std::unordered_set<const Object *> found;
+    for (const Entry *entry : entries) {
+        if (found.insert(entry->m_object).second) objects.push_back(entry->m_object);
+    }
+    return objects;
+}
+
+std::vector<const Object *> SpatialIndex::FindInRect(int x1, int y1, int x2, int y2, bool contained) const
+{
+    const Rect query = { std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2) };
+
+    std::vector<const Entry *> entries;
+    this->Search(query, [&entries, &query, contained](const Entry &entry) {
+        if (!contained || query.Contains(entry.m_rect)) entries.push_back(&entry);
+    });
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry *entry1, const Entry *entry2) {
+        if (entry1->m_rect.m_x1 != entry2->m_rect.m_x1) return (entry1->m_rect.m_x1 < entry2->m_rect.m_x1);
+        return (entry1->m_rect.m_y2 > entry2->m_rect.m_y2);
+    });
+
+    std::vector<const Object *> objects;
+    std::unordered_set<const Object *> found;
+    for (const Entry *entry : entries) {
+        if (found.insert(entry->m_object).second) objects.push_back(entry->m_object);
+    }
+    return objects;
+}
+
+} // namespace vrv
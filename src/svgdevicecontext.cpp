@@ -115,33 +115,17 @@ void SvgDeviceContext::IncludeTextFont(const std::string &fontname, const Resour
     css.text().set(cssContent.c_str());
 }
 
-void SvgDeviceContext::Commit(bool xml_declaration)
+void SvgDeviceContext::Commit(bool xml_declaration, std::ostream &output)
 {
     if (m_committed) {
         return;
     }
 
     // take care of width/height once userScale is updated
-    double height = (double)this->GetHeight() * this->GetUserScaleY();
-    double width = (double)this->GetWidth() * this->GetUserScaleX();
-    const char *format = "%gpx";
-
-    if (m_mmOutput) {
-        height /= 10;
-        width /= 10;
-        format = "%gmm";
-    }
-    else {
-        const auto [baseWidth, baseHeight] = this->GetBaseSize();
-        if (baseWidth && baseHeight) {
-            height = baseHeight;
-            width = baseWidth;
-        }
-        else {
-            height = std::ceil(height);
-            width = std::ceil(width);
-        }
-    }
+    assert(this->GetUserScaleX() == this->GetUserScaleY());
+    const auto [width, height] = SvgDeviceContext::GetRootSize(
+        this->GetWidth(), this->GetHeight(), this->GetUserScaleX(), m_mmOutput, this->GetBaseSize());
+    const char *format = (m_mmOutput) ? "%gmm" : "%gpx";
 
     if (m_svgViewBox) {
         m_svgNode.prepend_attribute("viewBox") = StringFormat("0 0 %g %g", width, height).c_str();
@@ -203,9 +187,9 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     pugi::xml_node desc = m_svgNode.prepend_child("desc");
     desc.text().set(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
 
-    // save the glyph data to m_outdata
+    // save the glyph data to the output
     std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-    m_svgDoc.save(m_outdata, indent.c_str(), output_flags);
+    m_svgDoc.save(output, indent.c_str(), output_flags);
 
     m_committed = true;
 }
@@ -1148,11 +1132,52 @@ std::string SvgDeviceContext::GetColor(int color)
 
 std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
-    if (!m_committed) Commit(xml_declaration);
+    if (!m_committed) this->Commit(xml_declaration, m_outdata);
 
     return m_outdata.str();
 }
 
+void SvgDeviceContext::WriteSVG(std::ostream &output, bool xml_declaration)
+{
+    if (!m_committed) {
+        this->Commit(xml_declaration, output);
+    }
+    else {
+        output << m_outdata.str();
+    }
+}
+
+std::pair<double, double> SvgDeviceContext::GetRootSize(
+    int width, int height, double userScale, bool mmOutput, std::pair<int, int> baseSize)
+{
+    double rootHeight = (double)height * userScale;
+    double rootWidth = (double)width * userScale;
+
+    if (mmOutput) {
+        rootHeight /= 10;
+        rootWidth /= 10;
+    }
+    else if (baseSize.first && baseSize.second) {
+        rootHeight = baseSize.second;
+        rootWidth = baseSize.first;
+    }
+    else {
+        rootHeight = std::ceil(rootHeight);
+        rootWidth = std::ceil(rootWidth);
+    }
+
+    return { rootWidth, rootHeight };
+}
+
+std::string SvgDeviceContext::GetRootSizeAttributes(std::pair<double, double> rootSize, bool mmOutput, bool viewBox)
+{
+    if (viewBox) {
+        return StringFormat("viewBox=\"0 0 %g %g\"", rootSize.first, rootSize.second);
+    }
+    const char *format = (mmOutput) ? "width=\"%gmm\" height=\"%gmm\"" : "width=\"%gpx\" height=\"%gpx\"";
+    return StringFormat(format, rootSize.first, rootSize.second);
+}
+
 void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int height)
 {
     std::string s;
@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.cpp
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "threadpool.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool(int threadCount)
+{
+    m_task = NULL;
+    m_taskCount = 0;
+    m_nextTask = 0;
+    m_pendingTasks = 0;
+    m_generation = 0;
+    m_stop = false;
+
+    // The calling thread is the first one
+    for (int i = 1; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_runCondition.notify_all();
+    for (std::thread &worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Run(int taskCount, const std::function<void(int)> &task)
+{
+    if (taskCount <= 0) return;
+
+    // Nothing to distribute
+    if (m_workers.empty() || (taskCount == 1)) {
+        for (int i = 0; i < taskCount; ++i) task(i);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    assert(!m_task);
+    m_task = &task;
+    m_taskCount = taskCount;
+    m_nextTask = 0;
+    m_pendingTasks = taskCount;
+    ++m_generation;
+    m_runCondition.notify_all();
+
+    this->ProcessTasks(lock);
+
+    m_doneCondition.wait(lock, [this] { return (m_pendingTasks == 0); });
+    m_task = NULL;
+}
+
+void ThreadPool::ProcessTasks(std::unique_lock<std::mutex> &lock)
+{
+    while (m_task && (m_nextTask < m_taskCount)) {
+        const int index = m_nextTask++;
+        const std::function<void(int)> *task = m_task;
+        lock.unlock();
+        (*task)(index);
+        lock.lock();
+        if (--m_pendingTasks == 0) m_doneCondition.notify_all();
+    }
+}
+
+void ThreadPool::WorkerLoop()
+{
+    unsigned long generation = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_runCondition.wait(lock, [this, generation] { return (m_stop || (m_generation != generation)); });
+        if (m_stop) return;
+        generation = m_generation;
+        this->ProcessTasks(lock);
+    }
+}
+
+} // namespace vrv
@@ -29,12 +29,15 @@
 #include "iomusxml.h"
 #include "iopae.h"
 #include "layer.h"
+#include "mappedfile.h"
 #include "measure.h"
+#include "miscfunctor.h"
 #include "nc.h"
 #include "neume.h"
 #include "note.h"
 #include "options.h"
 #include "page.h"
+#include "profiler.h"
 #include "runtimeclock.h"
 #include "score.h"
 #include "slur.h"
@@ -44,7 +47,6 @@
 
 //----------------------------------------------------------------------------
 
-#include "MidiFile.h"
 #include "crc.h"
 #include "jsonxx.h"
 
@@ -58,19 +60,52 @@ const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 const char *ZIP_SIGNATURE = "\x50\x4B\x03\x04";
 
+// Set the value of a mapped option from the JSON value with the same key
+static void SetOptionValue(Option *opt, const jsonxx::Object &json, const std::string &key)
+{
+    if (json.has<jsonxx::Number>(key)) {
+        opt->SetValueDbl(json.get<jsonxx::Number>(key));
+        // LogInfo("Double: %f", json.get<jsonxx::Number>(key));
+    }
+    else if (json.has<jsonxx::Boolean>(key)) {
+        opt->SetValueBool(json.get<jsonxx::Boolean>(key));
+        // LogInfo("Bool: %d", json.get<jsonxx::Boolean>(key));
+    }
+    else if (json.has<jsonxx::String>(key)) {
+        opt->SetValue(json.get<jsonxx::String>(key));
+        // LogInfo("String: %s", json.get<jsonxx::String>(key).c_str());
+    }
+    else if (json.has<jsonxx::Array>(key)) {
+        jsonxx::Array values = json.get<jsonxx::Array>(key);
+        std::vector<std::string> strValues;
+        for (int i = 0; i < (int)values.size(); ++i) {
+            if (values.has<jsonxx::String>(i)) strValues.push_back(values.get<jsonxx::String>(i));
+            // LogDebug("String: %s", values.get<jsonxx::String>(i).c_str());
+        }
+        opt->SetValueArray(strValues);
+    }
+    else if (json.has<jsonxx::Object>(key)) {
+        const OptionJson *optJson = dynamic_cast<OptionJson *>(opt);
+        if (optJson && (optJson->GetSource() == JsonSource::String)) {
+            const jsonxx::Object value = json.get<jsonxx::Object>(key);
+            opt->SetValue(value.json());
+        }
+    }
+    else {
+        LogError("Unsupported type for option '%s'", key.c_str());
+    }
+}
+
 //----------------------------------------------------------------------------
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_inputFrom = AUTO;
     m_outputTo = UNKNOWN;
 
     m_humdrumBuffer = NULL;
-    m_cString = NULL;
 
     if (initFont) {
         Resources &resources = m_doc.GetResourcesForModification();
@@ -80,6 +115,7 @@ Toolkit::Toolkit(bool initFont)
     m_options = m_doc.GetOptions();
 
     m_editorToolkit = NULL;
+    m_profilerEnabled = false;
 
 #ifndef NO_RUNTIME
     m_runtimeClock = NULL;
@@ -92,14 +128,11 @@ Toolkit::~Toolkit()
         free(m_humdrumBuffer);
         m_humdrumBuffer = NULL;
     }
-    if (m_cString) {
-        free(m_cString);
-        m_cString = NULL;
-    }
     if (m_editorToolkit) {
         delete m_editorToolkit;
         m_editorToolkit = NULL;
     }
+    this->EnableProfiler(false);
 #ifndef NO_RUNTIME
     if (m_runtimeClock) {
         delete m_runtimeClock;
@@ -115,6 +148,8 @@ std::string Toolkit::GetResourcePath() const
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
+    this->ResetPageCaches();
+
     Resources &resources = m_doc.GetResourcesForModification();
     resources.SetPath(path);
     return resources.InitFonts();
@@ -122,6 +157,8 @@ bool Toolkit::SetResourcePath(const std::string &path)
 
 bool Toolkit::SetFont(const std::string &fontName)
 {
+    this->ResetPageCaches();
+
     Resources &resources = m_doc.GetResourcesForModification();
     const bool ok = resources.SetFont(fontName);
     if (!ok) LogWarning("Font '%s' could not be loaded", fontName.c_str());
@@ -130,11 +167,17 @@ bool Toolkit::SetFont(const std::string &fontName)
 
 bool Toolkit::SetScale(int scale)
 {
+    // The scale changes the layout only when scaling to the page size
+    if (m_options->m_scaleToPageSize.GetValue() && (scale != m_options->m_scale.GetValue())) {
+        this->ResetPageCaches();
+    }
     return m_options->m_scale.SetValue(scale);
 }
 
 bool Toolkit::Select(const std::string &selection)
 {
+    this->ResetPageCaches();
+
     return m_docSelection.Parse(selection);
 }
 
@@ -292,41 +335,26 @@ FileFormat Toolkit::IdentifyInputFrom(const std::string &data)
 
 bool Toolkit::LoadFile(const std::string &filename)
 {
-    if (this->IsUTF16(filename)) {
-        return this->LoadUTF16File(filename);
-    }
-    if (this->IsZip(filename)) {
-        return this->LoadZipFile(filename);
-    }
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "LoadFile");
 
-    std::ifstream in(filename.c_str());
-    if (!in.is_open()) {
+    MappedFile file;
+    if (!file.Open(filename)) {
         return false;
     }
 
-    in.seekg(0, std::ios::end);
-    std::streamsize fileSize = (std::streamsize)in.tellg();
-    in.clear();
-    in.seekg(0, std::ios::beg);
-
-    // read the file into the std::string:
-    std::string content(fileSize, 0);
-    in.read(&content[0], fileSize);
+    if (this->IsUTF16(file.GetData(), file.GetSize())) {
+        return this->LoadUTF16Data(file.GetData(), file.GetSize());
+    }
+    if (this->IsZip(file.GetData(), file.GetSize())) {
+        return this->LoadZipDataBuffer((const unsigned char *)file.GetData(), (int)file.GetSize());
+    }
 
-    return this->LoadData(content);
+    return this->LoadData(file.GetData(), file.GetSize());
 }
 
-bool Toolkit::IsUTF16(const std::string &filename)
+bool Toolkit::IsUTF16(const char *data, size_t length) const
 {
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    char data[2];
-    memset(data, 0, 2);
-    fin.read(data, 2);
-    fin.close();
+    if (length < 2) return false;
 
     if (memcmp(data, UTF_16_LE_BOM, 2) == 0) return true;
     if (memcmp(data, UTF_16_BE_BOM, 2) == 0) return true;
@@ -334,26 +362,15 @@ bool Toolkit::IsUTF16(const std::string &filename)
     return false;
 }
 
-bool Toolkit::LoadUTF16File(const std::string &filename)
+bool Toolkit::LoadUTF16Data(const char *data, size_t length)
 {
-    /// Loading a UTF-16 file with basic conversion ot UTF-8
-    /// This is called after checking if the file has a UTF-16 BOM
+    /// Loading UTF-16 data with basic conversion ot UTF-8
+    /// This is called after checking if the data has a UTF-16 BOM
 
     LogWarning("The file seems to be UTF-16 - trying to convert to UTF-8");
 
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    fin.seekg(0, std::ios::end);
-    std::streamsize wfileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-
-    fin.seekg(0, std::wios::beg);
-
-    std::u16string u16data((wfileSize / 2) + 1, '\0');
-    fin.read((char *)&u16data[0], wfileSize);
+    std::u16string u16data((length / 2) + 1, '\0');
+    memcpy(&u16data[0], data, length);
 
     // order of the bytes has to be flipped
     if (u16data.at(0) == u'\uFFFE') {
@@ -377,46 +394,15 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
     return this->LoadData(utf8line);
 }
 
-bool Toolkit::IsZip(const std::string &filename)
+bool Toolkit::IsZip(const char *data, size_t length) const
 {
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    char data[4];
-    memset(data, 0, 4);
-    fin.read(data, 4);
-    fin.close();
+    if (length < 4) return false;
 
     if (memcmp(data, ZIP_SIGNATURE, 4) == 0) return true;
 
     return false;
 }
 
-bool Toolkit::LoadZipFile(const std::string &filename)
-{
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    fin.seekg(0, std::ios::end);
-    std::streamsize fileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-    fin.seekg(0, std::wios::beg);
-
-    std::vector<unsigned char> bytes;
-    bytes.reserve(fileSize + 1);
-
-    unsigned char buffer;
-    while (fin.read((char *)&buffer, sizeof(unsigned char))) {
-        bytes.push_back(buffer);
-    }
-
-    return this->LoadZipData(bytes);
-}
-
 bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
 {
 #ifndef NO_MXL_SUPPORT
@@ -465,20 +451,12 @@ bool Toolkit::LoadZipDataBuffer(const unsigned char *data, int length)
 
 bool Toolkit::LoadData(const std::string &data)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "LoadData");
+
     std::string newData;
     Input *input = NULL;
 
-    m_doc.m_expansionMap.Reset();
-
-    if (m_options->m_xmlIdChecksum.GetValue()) {
-        crcInit();
-        unsigned int cr = crcFast((unsigned char *)data.c_str(), (int)data.size());
-        Object::SeedID(cr);
-    }
-
-#ifndef NO_HUMDRUM_SUPPORT
-    this->ClearHumdrumBuffer();
-#endif
+    this->ResetLoadedData(data.c_str(), data.size());
 
     auto inputFormat = m_inputFrom;
     if (inputFormat == AUTO) {
@@ -696,6 +674,7 @@ bool Toolkit::LoadData(const std::string &data)
 
     // load the file
     if (inputFormat != HUMDRUM) {
+        ProfilerScope importScope(PROFILER_IO, "Import");
         if (!input->Import(newData.size() ? newData : data)) {
             LogError("Error importing data");
             delete input;
@@ -703,20 +682,84 @@ bool Toolkit::LoadData(const std::string &data)
         }
     }
 
-    bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
-    int footerOption = m_options->m_footer.GetValue();
-    // With adjusted page height, show the footer if explicitly set (i.e., not with "auto")
-    // generate the page header and footer if necessary
-    if ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always)) {
-        m_doc.GenerateFooter();
+    return this->ProcessImportedData(input, inputFormat);
+}
+
+bool Toolkit::LoadData(const char *data, size_t length)
+{
+    auto inputFormat = m_inputFrom;
+    if (inputFormat == AUTO) {
+        // Only the beginning of the data is looked at for identifying it
+        inputFormat = IdentifyInputFrom(std::string(data, std::min(length, (size_t)2000)));
     }
-    if (m_options->m_header.GetValue() == HEADER_auto) {
-        m_doc.GenerateHeader();
+
+    // Only the MEI and MusicXML importers read the buffer directly
+    if ((inputFormat != MEI) && (inputFormat != MUSICXML)) {
+        return this->LoadData(std::string(data, length));
     }
 
-    // generate missing measure numbers
-    // TODO better move this to PrepareData()
-    m_doc.GenerateMeasureNumbers();
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "LoadData");
+
+    this->ResetLoadedData(data, length);
+
+    Input *input = NULL;
+    if (inputFormat == MEI) {
+        input = new MEIInput(&m_doc);
+    }
+    else {
+        input = new MusicXmlInput(&m_doc);
+    }
+
+    // load the buffer
+    {
+        ProfilerScope importScope(PROFILER_IO, "Import");
+        if (!input->ImportBuffer(data, length)) {
+            LogError("Error importing data");
+            delete input;
+            return false;
+        }
+    }
+
+    return this->ProcessImportedData(input, inputFormat);
+}
+
+void Toolkit::ResetLoadedData(const char *data, size_t length)
+{
+    m_doc.m_expansionMap.Reset();
+    m_abcTuneIndex.clear();
+    this->ResetPageCaches();
+
+    if (m_options->m_xmlIdChecksum.GetValue()) {
+        crcInit();
+        unsigned int cr = crcFast((const unsigned char *)data, (int)length);
+        Object::SeedID(cr);
+    }
+
+#ifndef NO_HUMDRUM_SUPPORT
+    this->ClearHumdrumBuffer();
+#endif
+}
+
+bool Toolkit::ProcessImportedData(Input *input, FileFormat inputFormat)
+{
+    assert(input);
+
+#ifndef NO_ABC_SUPPORT
+    if (inputFormat == ABC) {
+        jsonxx::Array tuneIndex;
+        for (const ABCTune &tune : vrv_cast<ABCInput *>(input)->GetTunes()) {
+            jsonxx::Object tuneEntry;
+            tuneEntry << "n" << tune.m_n;
+            tuneEntry << "title" << tune.m_title;
+            tuneEntry << "offset" << tune.m_offset;
+            tuneEntry << "length" << tune.m_length;
+            tuneIndex << tuneEntry;
+        }
+        m_abcTuneIndex = tuneIndex.json();
+    }
+#endif
+
+    this->GenerateImplicitElements();
 
     // transpose the content if necessary
     if (m_options->m_transpose.IsSet() || m_options->m_transposeMdiv.IsSet()
@@ -784,7 +827,6 @@ bool Toolkit::LoadData(const std::string &data)
         }
     }
 
-    delete input;
     m_view.SetDoc(&m_doc);
 
 #if defined NO_HUMDRUM_SUPPORT
@@ -800,13 +842,43 @@ bool Toolkit::LoadData(const std::string &data)
         case NOTATIONTYPE_cmn: m_editorToolkit = new EditorToolkitCMN(&m_doc, &m_view); break;
         default: m_editorToolkit = new EditorToolkitCMN(&m_doc, &m_view);
     }
+    m_editorToolkit->SetPageBasedData(input->GetLayoutInformation() == LAYOUT_DONE);
 #endif
 
+    delete input;
+
     return true;
 }
 
+void Toolkit::GenerateImplicitElements()
+{
+    bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
+    int footerOption = m_options->m_footer.GetValue();
+    // With adjusted page height, show the footer if explicitly set (i.e., not with "auto")
+    // generate the page header and footer if necessary
+    if ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always)) {
+        m_doc.GenerateFooter();
+    }
+    if (m_options->m_header.GetValue() == HEADER_auto) {
+        m_doc.GenerateHeader();
+    }
+
+    // generate missing measure numbers
+    // TODO better move this to PrepareData()
+    m_doc.GenerateMeasureNumbers();
+}
+
 std::string Toolkit::GetMEI(const std::string &jsonOptions)
 {
+    std::ostringstream output;
+    this->GetMEI(jsonOptions, output);
+    return output.str();
+}
+
+bool Toolkit::GetMEI(const std::string &jsonOptions, std::ostream &output)
+{
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "GetMEI");
+
     bool scoreBased = true;
     bool basic = false;
     bool ignoreHeader = false;
@@ -843,7 +915,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
 
     if (this->GetPageCount() == 0) {
         LogWarning("No data loaded");
-        return "";
+        return false;
     }
 
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
@@ -852,7 +924,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     if (m_doc.HasSelection()) {
         if (!scoreBased) {
             LogError("Page-based MEI output is not possible when a selection is set.");
-            return "";
+            return false;
         }
         hadSelection = true;
         m_doc.DeactiveateSelection();
@@ -873,12 +945,15 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     if (!lastMeasure.empty()) meioutput.SetLastMeasure(lastMeasure);
     if (!mdiv.empty()) meioutput.SetMdiv(mdiv);
 
-    std::string output = meioutput.GetOutput();
+    const bool success = meioutput.GetOutput(output);
 
-    if (hadSelection) m_doc.ReactivateSelection(false);
+    if (hadSelection) {
+        m_doc.ReactivateSelection(false);
+        this->ResetPageCaches();
+    }
 
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return output;
+    return success;
 }
 
 std::string Toolkit::ValidatePAEFile(const std::string &filename)
@@ -896,11 +971,14 @@ std::string Toolkit::ValidatePAE(const std::string &data)
     PAEInput input(&m_doc);
     input.Import(data);
     m_doc.Reset();
+    this->ResetPageCaches();
     return input.GetValidationLog().json();
 }
 
 bool Toolkit::SaveFile(const std::string &filename, const std::string &jsonOptions)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "SaveFile");
+
     std::string output = this->GetMEI(jsonOptions);
     if (output.empty()) {
         return false;
@@ -1069,41 +1147,15 @@ bool Toolkit::SetOptions(const std::string &jsonOptions)
         Option *opt = m_options->GetItems()->at(iter->first);
         assert(opt);
 
-        if (json.has<jsonxx::Number>(iter->first)) {
-            opt->SetValueDbl(json.get<jsonxx::Number>(iter->first));
-            // LogInfo("Double: %f", json.get<jsonxx::Number>(iter->first));
-        }
-        else if (json.has<jsonxx::Boolean>(iter->first)) {
-            opt->SetValueBool(json.get<jsonxx::Boolean>(iter->first));
-            // LogInfo("Bool: %d", json.get<jsonxx::Boolean>(iter->first));
-        }
-        else if (json.has<jsonxx::String>(iter->first)) {
-            opt->SetValue(json.get<jsonxx::String>(iter->first));
-            // LogInfo("String: %s", json.get<jsonxx::String>(iter->first).c_str());
-        }
-        else if (json.has<jsonxx::Array>(iter->first)) {
-            jsonxx::Array values = json.get<jsonxx::Array>(iter->first);
-            std::vector<std::string> strValues;
-            for (int i = 0; i < (int)values.size(); ++i) {
-                if (values.has<jsonxx::String>(i)) strValues.push_back(values.get<jsonxx::String>(i));
-                // LogDebug("String: %s", values.get<jsonxx::String>(i).c_str());
-            }
-            opt->SetValueArray(strValues);
-        }
-        else if (json.has<jsonxx::Object>(iter->first)) {
-            const OptionJson *optJson = dynamic_cast<OptionJson *>(opt);
-            if (optJson && (optJson->GetSource() == JsonSource::String)) {
-                const jsonxx::Object value = json.get<jsonxx::Object>(iter->first);
-                opt->SetValue(value.json());
-            }
-        }
-        else {
-            LogError("Unsupported type for option '%s'", iter->first.c_str());
-        }
+        const std::string previousValue = opt->GetStrValue();
+        SetOptionValue(opt, json, iter->first);
+        if (opt->GetStrValue() != previousValue) this->ResetPageCaches();
     }
 
     m_options->Sync();
 
+    this->EnableProfiler(m_options->m_profile.GetValue());
+
     // Forcing font resource to be reset if the font is given in the options
     if (json.has<jsonxx::String>("font")) this->SetFont(m_options->m_font.GetValue());
 
@@ -1114,6 +1166,9 @@ void Toolkit::ResetOptions()
 {
     std::for_each(m_options->GetItems()->begin(), m_options->GetItems()->end(),
         [](const MapOfStrOptions::value_type &opt) { opt.second->Reset(); });
+    this->ResetPageCaches();
+
+    this->EnableProfiler(m_options->m_profile.GetValue());
 
     // Set the (default) font
     this->SetFont(m_options->m_font.GetValue());
@@ -1348,9 +1403,78 @@ std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 
 bool Toolkit::Edit(const std::string &editorAction)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "Edit");
+
     this->ResetLogBuffer();
+    this->ResetPageCaches();
+
+    const bool success = m_editorToolkit->PerformAction(editorAction);
+
+    // A transaction was rolled back and the document has to be restored
+    if (m_editorToolkit->HasRollbackData()) this->RestoreEditedData();
 
-    return m_editorToolkit->ParseEditorAction(editorAction);
+    return success;
+}
+
+void Toolkit::RestoreEditedData()
+{
+    // The load-time processing (e.g., the transposition or the expansion) is already applied in the saved MEI, so it
+    // is imported as is and only prepared and laid out again. The Humdrum buffer, the ABC tune index and the
+    // expansion map of the loaded data are kept.
+    const std::string data = m_editorToolkit->TakeRollbackData();
+    const int drawingPageIdx = (m_doc.GetDrawingPage()) ? m_doc.GetDrawingPage()->GetIdx() : -1;
+    const bool isCastOff = m_doc.IsCastOff();
+    const std::string selectionStart = m_doc.m_selectionStart;
+    const std::string selectionEnd = m_doc.m_selectionEnd;
+
+    // The header of the saved MEI has the transposition added to its revisions by the output
+    pugi::xml_document header;
+    header.reset(m_doc.m_header);
+
+    this->ResetPageCaches();
+
+    MEIInput input(&m_doc);
+    input.SetExpandExpansions(false);
+    if (!input.Import(data)) {
+        LogError("The document could not be restored after the transaction was rolled back");
+        return;
+    }
+    m_doc.m_header.reset(header);
+
+    // The generated page header and footer and measure numbers are not written in the MEI
+    this->GenerateImplicitElements();
+    // Neither are the elements converted from the preserved analytical markup, which only score-based MEI converts
+    if ((input.GetLayoutInformation() == LAYOUT_DONE) && m_options->m_preserveAnalyticalMarkup.GetValue()) {
+        m_doc.ConvertMarkupDoc(false);
+    }
+
+    m_doc.PrepareData();
+
+    // The MEI output converted the mensural segments back into pseudo-measures
+    if (m_doc.IsMensuralMusicOnly()) {
+        m_doc.ConvertToCastOffMensuralDoc(true);
+    }
+
+    if (input.GetLayoutInformation() == LAYOUT_DONE) {
+        // The pages are the ones saved from page-based MEI, without the selection
+        m_doc.SetCastOff(isCastOff);
+        if (!selectionStart.empty() && !selectionEnd.empty()) {
+            m_doc.m_selectionStart = selectionStart;
+            m_doc.m_selectionEnd = selectionEnd;
+            m_doc.ReactivateSelection(true);
+        }
+    }
+    else if (isCastOff) {
+        // The selection is applied again as when the data was loaded
+        if (!selectionStart.empty() && !selectionEnd.empty()) {
+            m_docSelection.m_isPending = true;
+            m_doc.InitSelectionDoc(m_docSelection, true);
+        }
+        this->CastOffWithBreaks();
+    }
+
+    m_view.SetDoc(&m_doc);
+    if ((drawingPageIdx >= 0) && (drawingPageIdx < this->GetPageCount())) m_doc.SetDrawingPage(drawingPageIdx);
 }
 
 std::string Toolkit::EditInfo()
@@ -1360,11 +1484,31 @@ std::string Toolkit::EditInfo()
 
 std::string Toolkit::GetLog()
 {
-    std::string str;
-    for (const std::string &logStr : logBuffer) {
-        str += logStr;
+    return LogBufferToString();
+}
+
+void Toolkit::EnableProfiler(bool enable)
+{
+    // The profiler is shared by all the toolkits and each one enables it only once
+    if (enable == m_profilerEnabled) return;
+
+    if (enable) {
+        Profiler::Enable();
     }
-    return str;
+    else {
+        Profiler::Disable();
+    }
+    m_profilerEnabled = enable;
+}
+
+std::string Toolkit::GetProfile() const
+{
+    return Profiler::GetReport();
+}
+
+void Toolkit::ResetProfile()
+{
+    Profiler::Reset();
 }
 
 std::string Toolkit::GetVersion() const
@@ -1380,11 +1524,15 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
-    logBuffer.clear();
+    ClearLogBuffer();
 }
 
 void Toolkit::RedoLayout(const std::string &jsonOptions)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RedoLayout");
+
+    this->ResetPageCaches();
+
     bool resetCache = true;
 
     jsonxx::Object json;
@@ -1413,6 +1561,11 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
         m_doc.UnCastOffDoc(resetCache);
     }
 
+    this->CastOffWithBreaks();
+}
+
+void Toolkit::CastOffWithBreaks()
+{
     if (m_options->m_breaks.GetValue() == BREAKS_line) {
         m_doc.CastOffLineDoc();
     }
@@ -1427,9 +1580,52 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
     }
 }
 
+bool Toolkit::RequiresRedoLayout(const std::string &jsonOptions) const
+{
+    jsonxx::Object json;
+
+    // Read JSON options
+    if (!json.parse(jsonOptions)) {
+        LogError("Cannot parse JSON std::string.");
+        return false;
+    }
+
+    bool scaleToPageSize = m_options->m_scaleToPageSize.GetValue();
+    if (json.has<jsonxx::Boolean>("scaleToPageSize")) scaleToPageSize = json.get<jsonxx::Boolean>("scaleToPageSize");
+
+    // Options in which the new values are set for comparing them with the current ones
+    Options newOptions;
+
+    for (const auto &[key, value] : json.kv_map()) {
+        if (m_options->GetItems()->count(key) == 0) {
+            // Base options - only the scale changes the layout and only when scaling to the page size
+            if ((key == "scale") && scaleToPageSize && json.has<jsonxx::Number>(key)) {
+                if ((int)json.get<jsonxx::Number>(key) != m_options->m_scale.GetValue()) return true;
+            }
+            continue;
+        }
+
+        // Mapped options
+        Option *opt = m_options->GetItems()->at(key);
+        assert(opt);
+        if (opt->IsRenderOnly()) continue;
+
+        Option *newOpt = newOptions.GetItems()->at(key);
+        assert(newOpt);
+        opt->CopyTo(newOpt);
+        SetOptionValue(newOpt, json, key);
+        if (newOpt->GetStrValue() != opt->GetStrValue()) return true;
+    }
+
+    return false;
+}
+
 void Toolkit::RedoPagePitchPosLayout()
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RedoPagePitchPosLayout");
+
     this->ResetLogBuffer();
+    this->ResetPageCaches();
 
     Page *page = m_doc.GetDrawingPage();
 
@@ -1443,6 +1639,8 @@ void Toolkit::RedoPagePitchPosLayout()
 
 bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToDeviceContext");
+
     if (pageNo > this->GetPageCount()) {
         LogWarning("Page %d does not exist", pageNo);
         return false;
@@ -1454,6 +1652,17 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
     // Get the current system for the SVG clipping size
     m_view.SetPage(pageNo);
 
+    this->InitDeviceContextSize(deviceContext);
+
+    // render the page
+    ProfilerScope drawScope(PROFILER_IO, "DrawCurrentPage");
+    m_view.DrawCurrentPage(deviceContext, false);
+
+    return true;
+}
+
+void Toolkit::InitDeviceContextSize(DeviceContext *deviceContext)
+{
     // Adjusting page width and height according to the options
     int width = m_options->m_pageWidth.GetUnfactoredValue();
     int height = m_options->m_pageHeight.GetUnfactoredValue();
@@ -1492,10 +1701,6 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
         deviceContext->SetHeight(m_doc.GetFacsimile()->GetMaxY());
     }
 
-    // render the page
-    m_view.DrawCurrentPage(deviceContext, false);
-
-    return true;
 }
 
 std::string Toolkit::RenderData(const std::string &data, const std::string &jsonOptions)
@@ -1508,12 +1713,70 @@ std::string Toolkit::RenderData(const std::string &data, const std::string &json
 
 std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToSVG");
+
     this->ResetLogBuffer();
 
+    std::string out_str;
+    if (m_options->m_svgPageCache.GetValue() && this->RenderCachedSVG(pageNo, xmlDeclaration, out_str)) {
+        return out_str;
+    }
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg;
+    this->InitSvgDeviceContext(svg);
+
+    // render the page
+    const bool rendered = this->RenderToDeviceContext(pageNo, &svg);
+
+    out_str = svg.GetStringSVG(xmlDeclaration);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    if (rendered && m_options->m_svgPageCache.GetValue()) {
+        // Split the page around the size attributes of the root element, which are the only ones depending on the scale
+        const std::size_t start = out_str.find("<svg ");
+        const std::size_t end = (start != std::string::npos) ? out_str.find(" version=", start) : std::string::npos;
+        if (end != std::string::npos) {
+            SvgCachedPage &cachedPage = m_svgPageCache[{ pageNo, xmlDeclaration }];
+            cachedPage.m_head = out_str.substr(0, start + 5);
+            cachedPage.m_tail = out_str.substr(end);
+            cachedPage.m_width = svg.GetWidth();
+            cachedPage.m_height = svg.GetHeight();
+            cachedPage.m_baseSize = svg.GetBaseSize();
+        }
+    }
+
+    return out_str;
+}
+
+bool Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration, std::ostream &output)
+{
+    // The pages of the cache are rescaled as strings
+    if (m_options->m_svgPageCache.GetValue()) {
+        output << this->RenderToSVG(pageNo, xmlDeclaration);
+        return !output.fail();
+    }
+
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToSVG");
+
+    this->ResetLogBuffer();
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+    SvgDeviceContext svg;
+    this->InitSvgDeviceContext(svg);
+
+    const bool rendered = this->RenderToDeviceContext(pageNo, &svg);
+
+    svg.WriteSVG(output, xmlDeclaration);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return (rendered && !output.fail());
+}
+
+void Toolkit::InitSvgDeviceContext(SvgDeviceContext &svg)
+{
     svg.SetResources(&m_doc.GetResources());
 
     int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
@@ -1546,21 +1809,87 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
     svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
     svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+}
 
-    // render the page
-    this->RenderToDeviceContext(pageNo, &svg);
+bool Toolkit::RenderCachedSVG(int pageNo, bool xmlDeclaration, std::string &output)
+{
+    const auto iter = m_svgPageCache.find({ pageNo, xmlDeclaration });
+    if (iter == m_svgPageCache.end()) return false;
 
-    std::string out_str = svg.GetStringSVG(xmlDeclaration);
+    // Set the drawing page as rendering it would do
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+    m_view.SetPage(pageNo - 1, false);
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return out_str;
+
+    const SvgCachedPage &cachedPage = iter->second;
+    const double userScale = m_view.GetPPUFactor() * m_options->m_scale.GetValue() / 100;
+    const std::pair<double, double> rootSize = SvgDeviceContext::GetRootSize(
+        cachedPage.m_width, cachedPage.m_height, userScale, m_options->m_mmOutput.GetValue(), cachedPage.m_baseSize);
+
+    output = cachedPage.m_head;
+    output += SvgDeviceContext::GetRootSizeAttributes(
+        rootSize, m_options->m_mmOutput.GetValue(), m_options->m_svgViewBox.GetValue());
+    output += cachedPage.m_tail;
+    return true;
+}
+
+void Toolkit::ResetPageCaches()
+{
+    m_svgPageCache.clear();
+    m_spatialIndexes.clear();
+}
+
+const SpatialIndex &Toolkit::GetPageSpatialIndex(int pageIdx)
+{
+    // This also lays out the page if necessary
+    m_view.SetPage(pageIdx);
+
+    SpatialIndex &spatialIndex = m_spatialIndexes[pageIdx];
+    if (!spatialIndex.IsBuilt()) {
+        ProfilerScope profilerScope(PROFILER_LAYOUT, "InitSpatialIndex");
+        spatialIndex.Reset();
+        InitSpatialIndexFunctor initSpatialIndex(&spatialIndex);
+        m_doc.GetDrawingPage()->Process(initSpatialIndex);
+        spatialIndex.Build();
+    }
+    return spatialIndex;
+}
+
+Point Toolkit::ToPageLogicalPoint(double x, double y)
+{
+    // The size and the scale are the ones used when rendering the page
+    SvgDeviceContext svg;
+    this->InitDeviceContextSize(&svg);
+    const std::pair<double, double> rootSize = SvgDeviceContext::GetRootSize(
+        svg.GetWidth(), svg.GetHeight(), svg.GetUserScaleX(), m_options->m_mmOutput.GetValue(), svg.GetBaseSize());
+
+    // The viewBox of the definition-scale graphic, with the content height as set by View::DrawCurrentPage
+    double viewBoxWidth = svg.GetWidth();
+    double viewBoxHeight = svg.GetHeight();
+    if (m_doc.GetType() != Facs) {
+        if ((m_doc.GetAdjustedDrawingPageHeight() > svg.GetHeight()) && m_options->m_shrinkToFit.GetValue()) {
+            viewBoxHeight = m_doc.GetAdjustedDrawingPageHeight();
+        }
+        viewBoxWidth *= DEFINITION_FACTOR;
+        viewBoxHeight *= DEFINITION_FACTOR;
+    }
+    if ((viewBoxWidth <= 0.0) || (viewBoxHeight <= 0.0)) return Point(VRV_UNSET, VRV_UNSET);
+
+    // The graphic is scaled uniformly and centered in the root element (default preserveAspectRatio)
+    const double scale = std::min(rootSize.first / viewBoxWidth, rootSize.second / viewBoxHeight);
+    const double viewBoxX = (x - (rootSize.first - viewBoxWidth * scale) / 2.0) / scale;
+    const double viewBoxY = (y - (rootSize.second - viewBoxHeight * scale) / 2.0) / scale;
+
+    // Remove the translation of the page margins and flip the y axis
+    const int drawingX = (int)std::round(viewBoxX) - m_doc.m_drawingPageMarginLeft;
+    const int drawingY = (int)std::round(viewBoxY) - m_doc.m_drawingPageMarginTop;
+    return Point(m_view.ToLogicalX(drawingX), m_view.ToLogicalY(drawingY));
 }
 
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
 {
     this->ResetLogBuffer();
 
-    std::string output = this->RenderToSVG(pageNo, true);
-
     std::ofstream outfile;
     outfile.open(filename.c_str());
 
@@ -1569,7 +1898,8 @@ bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
         return false;
     }
 
-    outfile << output;
+    // The page is written to the file as it is serialized
+    this->RenderToSVG(pageNo, true, outfile);
     outfile.close();
     return true;
 }
@@ -1596,28 +1926,39 @@ bool Toolkit::GetHumdrumFile(const std::string &filename)
 
 void Toolkit::GetHumdrum(std::ostream &output)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "GetHumdrum");
+
     output << this->GetHumdrumBuffer();
 }
 
 std::string Toolkit::RenderToMIDI()
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToMIDI");
+
     this->ResetLogBuffer();
 
-    smf::MidiFile outputfile;
-    outputfile.absoluteTicks();
-    m_doc.ExportMIDI(&outputfile);
-    outputfile.sortTracks();
+    std::vector<unsigned char> midiData;
+    m_doc.ExportMIDI(midiData);
+
+    return Base64Encode(midiData.data(), (unsigned int)midiData.size());
+}
 
-    std::stringstream stream;
-    outputfile.write(stream);
-    std::string outputstr = Base64Encode(
-        reinterpret_cast<const unsigned char *>(stream.str().c_str()), (unsigned int)stream.str().length());
+std::vector<unsigned char> Toolkit::RenderToMIDIData()
+{
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToMIDIData");
 
-    return outputstr;
+    this->ResetLogBuffer();
+
+    std::vector<unsigned char> midiData;
+    m_doc.ExportMIDI(midiData);
+
+    return midiData;
 }
 
 std::string Toolkit::RenderToPAE()
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToPAE");
+
     this->ResetLogBuffer();
 
     if (this->GetPageCount() == 0) {
@@ -1650,6 +1991,8 @@ bool Toolkit::RenderToPAEFile(const std::string &filename)
 
 std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToTimemap");
+
     bool includeMeasures = false;
     bool includeRests = false;
 
@@ -1676,6 +2019,8 @@ std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
 
 std::string Toolkit::RenderToExpansionMap()
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "RenderToExpansionMap");
+
     this->ResetLogBuffer();
 
     std::string output;
@@ -1685,6 +2030,8 @@ std::string Toolkit::RenderToExpansionMap()
 
 std::string Toolkit::GetElementsAtTime(int millisec)
 {
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "GetElementsAtTime");
+
     this->ResetLogBuffer();
 
     jsonxx::Object o;
@@ -1746,15 +2093,89 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     return o.json();
 }
 
+std::string Toolkit::GetElementsAtPoint(int pageNo, int x, int y)
+{
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "GetElementsAtPoint");
+
+    this->ResetLogBuffer();
+
+    jsonxx::Array ids;
+
+    if ((pageNo < 1) || (pageNo > this->GetPageCount())) {
+        LogWarning("Page %d does not exist", pageNo);
+        return ids.json();
+    }
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    const SpatialIndex &spatialIndex = this->GetPageSpatialIndex(pageNo - 1);
+    const Point point = this->ToPageLogicalPoint(x, y);
+    for (const Object *object : spatialIndex.FindAtPoint(point.x, point.y)) {
+        ids << object->GetID();
+    }
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return ids.json();
+}
+
+std::string Toolkit::GetElementsInRect(int pageNo, const std::string &jsonRect)
+{
+    ProfilerScope profilerScope(PROFILER_TOOLKIT, "GetElementsInRect");
+
+    this->ResetLogBuffer();
+
+    jsonxx::Array ids;
+
+    jsonxx::Object json;
+    if (!json.parse(jsonRect)) {
+        LogError("Cannot parse JSON std::string.");
+        return ids.json();
+    }
+    if (!json.has<jsonxx::Number>("x") || !json.has<jsonxx::Number>("y") || !json.has<jsonxx::Number>("width")
+        || !json.has<jsonxx::Number>("height")) {
+        LogError("The rectangle requires x, y, width and height values.");
+        return ids.json();
+    }
+    const double x = json.get<jsonxx::Number>("x");
+    const double y = json.get<jsonxx::Number>("y");
+    const double width = json.get<jsonxx::Number>("width");
+    const double height = json.get<jsonxx::Number>("height");
+    bool contained = false;
+    if (json.has<jsonxx::Boolean>("contained")) contained = json.get<jsonxx::Boolean>("contained");
+
+    if ((pageNo < 1) || (pageNo > this->GetPageCount())) {
+        LogWarning("Page %d does not exist", pageNo);
+        return ids.json();
+    }
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    const SpatialIndex &spatialIndex = this->GetPageSpatialIndex(pageNo - 1);
+    const Point topLeft = this->ToPageLogicalPoint(x, y);
+    const Point bottomRight = this->ToPageLogicalPoint(x + width, y + height);
+    for (const Object *object :
+        spatialIndex.FindInRect(topLeft.x, topLeft.y, bottomRight.x, bottomRight.y, contained)) {
+        ids << object->GetID();
+    }
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+    return ids.json();
+}
+
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
 {
     this->ResetLogBuffer();
 
-    smf::MidiFile outputfile;
-    outputfile.absoluteTicks();
-    m_doc.ExportMIDI(&outputfile);
-    outputfile.sortTracks();
-    outputfile.write(filename);
+    std::vector<unsigned char> midiData;
+    m_doc.ExportMIDI(midiData);
+
+    std::ofstream output(filename.c_str(), std::ios::binary);
+    if (!output.is_open()) {
+        return false;
+    }
+    output.write(reinterpret_cast<const char *>(midiData.data()), midiData.size());
 
     return true;
 }
@@ -1785,6 +2206,11 @@ bool Toolkit::RenderToExpansionMapFile(const std::string &filename)
     return true;
 }
 
+std::string Toolkit::GetABCTuneIndex() const
+{
+    return (m_abcTuneIndex.empty()) ? "[]" : m_abcTuneIndex;
+}
+
 int Toolkit::GetPageCount()
 {
     return m_doc.GetPageCount();
@@ -1988,28 +2414,17 @@ const char *Toolkit::GetHumdrumBuffer()
 
 void Toolkit::SetCString(const std::string &data)
 {
-    if (m_cString) {
-        free(m_cString);
-        m_cString = NULL;
-    }
-
-    m_cString = (char *)malloc(strlen(data.c_str()) + 1);
+    m_cString = data;
+}
 
-    // something went wrong
-    if (!m_cString) {
-        return;
-    }
-    strcpy(m_cString, data.c_str());
+void Toolkit::SetCString(std::string &&data)
+{
+    m_cString = std::move(data);
 }
 
 const char *Toolkit::GetCString()
 {
-    if (m_cString) {
-        return m_cString;
-    }
-    else {
-        return "[unspecified]";
-    }
+    return m_cString.c_str();
 }
 
 void Toolkit::ClearHumdrumBuffer()
@@ -2067,8 +2482,10 @@ std::string Toolkit::ConvertHumdrumToHumdrum(const std::string &humdrumData)
     for (int i = 0; i < infiles.getCount(); ++i) {
         if (infiles[i].hasGlobalFilters()) {
             filter.run(infiles[i]);
-            if (filter.hasHumdrumText()) {
-                infiles[i].readString(filter.getHumdrumText());
+            // Get the text once since hasHumdrumText() would copy it as well
+            const std::string text = filter.getHumdrumText();
+            if (!text.empty()) {
+                infiles[i].readString(text);
             }
             else {
                 // should have auto updated itself in the filter.
@@ -2080,8 +2497,9 @@ std::string Toolkit::ConvertHumdrumToHumdrum(const std::string &humdrumData)
     // at the universal level.
     if (infiles.hasUniversalFilters()) {
         filter.runUniversal(infiles);
-        if (filter.hasHumdrumText()) {
-            infiles.readString(filter.getHumdrumText());
+        const std::string text = filter.getHumdrumText();
+        if (!text.empty()) {
+            infiles.readString(text);
         }
     }
 
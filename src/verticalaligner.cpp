@@ -127,6 +127,19 @@ void SystemAligner::FindAllPositionerPointingTo(ArrayOfFloatingPositioners *posi
     }
 }
 
+bool SystemAligner::HasCrossSystemPositioners() const
+{
+    const StaffAlignment *alignment = NULL;
+    for (const auto child : this->GetChildren()) {
+        alignment = vrv_cast<const StaffAlignment *>(child);
+        assert(alignment);
+        for (const FloatingPositioner *positioner : alignment->GetFloatingPositioners()) {
+            if (positioner->GetSpanningType() != SPANNING_START_END) return true;
+        }
+    }
+    return false;
+}
+
 void SystemAligner::FindAllIntersectionPoints(
     SegmentedLine &line, const BoundingBox &boundingBox, const std::vector<ClassId> &classIds, int margin) const
 {
@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <locale>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <vector>
@@ -64,13 +65,16 @@ namespace vrv {
 struct timeval start;
 
 /** For controlling the log level - warning level enabled by default */
-LogLevel logLevel = LOG_WARNING;
+std::atomic<LogLevel> logLevel = LOG_WARNING;
 
 /** By default log to stderr or JS console */
-bool loggingToBuffer = false;
+std::atomic<bool> loggingToBuffer = false;
 
 std::vector<std::string> logBuffer;
 
+/** Protects the log buffer and the output when logging from worker threads */
+std::mutex logMutex;
+
 void LogElapsedTimeStart()
 {
     gettimeofday(&start, NULL);
@@ -138,6 +142,8 @@ void LogWarning(const char *fmt, ...)
 
 void LogString(std::string message, LogLevel level)
 {
+    std::lock_guard<std::mutex> lock(logMutex);
+
     if (loggingToBuffer) {
         if (LogBufferContains(message)) return;
         logBuffer.push_back(message);
@@ -185,6 +191,24 @@ bool LogBufferContains(const std::string &s)
     return false;
 }
 
+std::string LogBufferToString()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+
+    std::string str;
+    for (const std::string &logStr : logBuffer) {
+        str += logStr;
+    }
+    return str;
+}
+
+void ClearLogBuffer()
+{
+    std::lock_guard<std::mutex> lock(logMutex);
+
+    logBuffer.clear();
+}
+
 bool Check(Object *object)
 {
     assert(object);
@@ -0,0 +1,391 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench.cpp
+// Author:      Verovio contributors
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <getopt.h>
+#else
+#include "win_getopt.h"
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "options.h"
+#include "profiler.h"
+#include "resources.h"
+#include "svgdevicecontext.h"
+#include "toolkit.h"
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+// The stages in the order they are run for each file
+// The import, PrepareData, cast-off and layout stages are part of the load and are read from the profiler
+// The cast-off runs the horizontal layout and its stage has only its self time for the stages not to overlap
+const std::vector<std::string> stages
+    = { "load", "import", "prepareData", "castOff", "layout", "svg", "hitTest", "midi", "midiData", "timemap", "mei" };
+
+// The timings (in seconds) of a file by stage, one value per repetition
+typedef std::map<std::string, std::vector<double>> StageTimings;
+
+void display_usage()
+{
+    std::cerr << "Verovio benchmark " << vrv::GetVersion() << std::endl << std::endl;
+    std::cerr << "Usage:" << std::endl << std::endl;
+    std::cerr << " verovio-bench [-r resources] [-w warmups] [-n repetitions] [-o output] [--options json] corpus"
+              << std::endl
+              << std::endl;
+    std::cerr << " -r, --resources <s>   Path to the directory with Verovio resources" << std::endl;
+    std::cerr << " -w, --warmup <i>      Number of runs not measured before the repetitions (default 1)" << std::endl;
+    std::cerr << " -n, --repeat <i>      Number of measured repetitions (default 5)" << std::endl;
+    std::cerr << " -o, --outfile <s>     Output file for the JSON results (default standard output)" << std::endl;
+    std::cerr << " --options <s>         JSON options passed to the toolkit for every file" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "The files of the corpus are grouped by the name of their top directory (see doc/bench-corpus.py)"
+              << std::endl;
+}
+
+double time_function(const std::function<void()> &function)
+{
+    using namespace std::chrono;
+    const steady_clock::time_point start = steady_clock::now();
+    function();
+    return duration<double, seconds::period>(steady_clock::now() - start).count();
+}
+
+double profiled_time(const jsonxx::Object &profile, const std::string &category, const std::vector<std::string> &names,
+    const std::string &field = "time")
+{
+    if (!profile.has<jsonxx::Object>(category)) return 0.0;
+    const jsonxx::Object &timings = profile.get<jsonxx::Object>(category);
+    double seconds = 0.0;
+    for (const std::string &name : names) {
+        if (!timings.has<jsonxx::Object>(name)) continue;
+        seconds += timings.get<jsonxx::Object>(name).get<jsonxx::Number>(field);
+    }
+    return seconds;
+}
+
+// Query the elements on a grid of points and of rectangles of every page, including the building of the indexes
+void hit_test_pages(vrv::Toolkit &toolkit)
+{
+    const vrv::Options *options = toolkit.GetOptionsObj();
+    const double scale = options->m_scale.GetValue() / 100.0;
+    const int width = options->m_pageWidth.GetUnfactoredValue() * scale;
+    const int height = options->m_pageHeight.GetUnfactoredValue() * scale;
+    const int steps = 50;
+    for (int page = 1; page <= toolkit.GetPageCount(); ++page) {
+        for (int i = 0; i < steps; ++i) {
+            for (int j = 0; j < steps; ++j) {
+                toolkit.GetElementsAtPoint(page, width * i / steps, height * j / steps);
+            }
+            jsonxx::Object rect;
+            rect << "x" << width * i / steps << "y" << 0 << "width" << width / 10 << "height" << height;
+            toolkit.GetElementsInRect(page, rect.json());
+        }
+    }
+}
+
+// Run all the stages for the data and add the timings if requested
+bool run_stages(vrv::Toolkit &toolkit, const std::string &data, StageTimings *timings)
+{
+    StageTimings run;
+
+    vrv::Profiler::Reset();
+    bool loaded = true;
+    run["load"].push_back(time_function([&toolkit, &data, &loaded]() { loaded = toolkit.LoadData(data); }));
+    if (!loaded) return false;
+
+    jsonxx::Object profile;
+    profile.parse(toolkit.GetProfile());
+    run["import"].push_back(profiled_time(profile, "io", { "Import" }));
+    run["prepareData"].push_back(profiled_time(profile, "layout", { "PrepareData" }));
+    run["castOff"].push_back(profiled_time(profile, "layout", { "CastOff", "CastOffEncoding" }, "self"));
+    run["layout"].push_back(profiled_time(
+        profile, "layout", { "LayOutHorizontally", "LayOutVertically", "JustifyHorizontally", "JustifyVertically" }));
+
+    run["svg"].push_back(time_function([&toolkit]() {
+        for (int i = 1; i <= toolkit.GetPageCount(); ++i) toolkit.RenderToSVG(i);
+    }));
+    run["hitTest"].push_back(time_function([&toolkit]() { hit_test_pages(toolkit); }));
+    run["midi"].push_back(time_function([&toolkit]() { toolkit.RenderToMIDI(); }));
+    run["midiData"].push_back(time_function([&toolkit]() { toolkit.RenderToMIDIData(); }));
+    run["timemap"].push_back(time_function([&toolkit]() { toolkit.RenderToTimemap(); }));
+    run["mei"].push_back(time_function([&toolkit]() { toolkit.GetMEI(); }));
+
+    if (timings) {
+        for (auto &stage : run) {
+            (*timings)[stage.first].push_back(stage.second.front());
+        }
+    }
+    return true;
+}
+
+// A sink for the results of the micro benchmarks so that the calls are not optimized away
+volatile int micro_sink = 0;
+
+// Time the queries of the glyph metrics made for every element by the layout and the drawing
+// All the glyphs of the font are queried for two staff sizes, with and without grace size
+double time_glyph_metrics(const vrv::Doc &doc, const std::vector<char32_t> &codes)
+{
+    return time_function([&doc, &codes]() {
+        int sum = 0;
+        for (int i = 0; i < 20; ++i) {
+            for (int staffSize : { 100, 75 }) {
+                for (bool graceSize : { false, true }) {
+                    for (char32_t code : codes) {
+                        sum += doc.GetGlyphWidth(code, staffSize, graceSize);
+                        sum += doc.GetGlyphHeight(code, staffSize, graceSize);
+                        sum += doc.GetGlyphLeft(code, staffSize, graceSize);
+                        sum += doc.GetGlyphBottom(code, staffSize, graceSize);
+                        sum += doc.GetGlyphAdvX(code, staffSize, graceSize);
+                    }
+                }
+            }
+        }
+        micro_sink = sum;
+    });
+}
+
+// Time the text extent measurements made for lyrics, directions and harmonies
+// The same strings are measured repeatedly in a few text styles and sizes, as in a typical score
+double time_text_extents(const vrv::Doc &doc)
+{
+    static const std::vector<std::u32string> texts = { U"la", U"Glo", U"ri", U"a", U"in", U"ex", U"cel", U"sis",
+        U"De", U"o", U"Allegro", U"dolce", U"cresc.", U"C#m7", U"Bb7", U"F/A", U"G7sus4", U"rit." };
+    static const std::vector<std::u32string> smuflTexts = { U"\uE520", U"\uE521", U"\uE52F", U"\uE080\uE084" };
+
+    vrv::SvgDeviceContext dc;
+    dc.SetResources(&doc.GetResources());
+    return time_function([&doc, &dc]() {
+        int sum = 0;
+        vrv::TextExtend extend;
+        for (int i = 0; i < 200; ++i) {
+            for (int pointSize : { 180, 225 }) {
+                vrv::FontInfo font;
+                font.SetPointSize(pointSize);
+                dc.SetFont(&font);
+                for (vrv::data_FONTSTYLE style : { vrv::FONTSTYLE_normal, vrv::FONTSTYLE_italic }) {
+                    doc.GetResources().SelectTextFont(vrv::FONTWEIGHT_normal, style);
+                    for (const std::u32string &text : texts) {
+                        dc.GetTextExtent(text, &extend, true);
+                        sum += extend.m_width;
+                    }
+                }
+                for (const std::u32string &text : smuflTexts) {
+                    dc.GetSmuflTextExtent(text, &extend);
+                    sum += extend.m_width;
+                }
+                dc.ResetFont();
+            }
+        }
+        doc.GetResources().SelectTextFont(vrv::FONTWEIGHT_NONE, vrv::FONTSTYLE_NONE);
+        micro_sink = sum;
+    });
+}
+
+jsonxx::Object get_statistics(std::vector<double> values)
+{
+    jsonxx::Object statistics;
+    if (values.empty()) return statistics;
+
+    std::sort(values.begin(), values.end());
+    double sum = 0.0;
+    for (double value : values) sum += value;
+    const size_t middle = values.size() / 2;
+    const double median
+        = (values.size() % 2) ? values.at(middle) : (values.at(middle - 1) + values.at(middle)) / 2.0;
+
+    statistics << "min" << values.front();
+    statistics << "median" << median;
+    statistics << "mean" << sum / values.size();
+    statistics << "max" << values.back();
+    return statistics;
+}
+
+int main(int argc, char **argv)
+{
+    std::string resourcePath;
+    std::string outfile;
+    std::string jsonOptions;
+    int warmup = 1;
+    int repeat = 5;
+
+    static struct option long_options[] = {
+        { "help", no_argument, 0, 'h' }, //
+        { "options", required_argument, 0, 'p' }, //
+        { "outfile", required_argument, 0, 'o' }, //
+        { "repeat", required_argument, 0, 'n' }, //
+        { "resources", required_argument, 0, 'r' }, //
+        { "warmup", required_argument, 0, 'w' }, //
+        { 0, 0, 0, 0 } //
+    };
+
+    int c;
+    int option_index = 0;
+    while ((c = getopt_long(argc, argv, "hn:o:p:r:w:", long_options, &option_index)) != -1) {
+        switch (c) {
+            case 'n': repeat = std::max(atoi(optarg), 1); break;
+            case 'o': outfile = optarg; break;
+            case 'p': jsonOptions = optarg; break;
+            case 'r': resourcePath = optarg; break;
+            case 'w': warmup = std::max(atoi(optarg), 0); break;
+            case 'h': display_usage(); exit(0);
+            default: display_usage(); exit(1);
+        }
+    }
+
+    if (optind != argc - 1) {
+        display_usage();
+        exit(1);
+    }
+    const std::filesystem::path corpus(argv[optind]);
+    if (!std::filesystem::is_directory(corpus)) {
+        std::cerr << "The corpus directory " << corpus.string() << " could not be found." << std::endl;
+        exit(1);
+    }
+
+    vrv::EnableLog(false);
+
+    vrv::Toolkit toolkit;
+    if (!resourcePath.empty() && !toolkit.SetResourcePath(resourcePath)) {
+        std::cerr << "The resources could not be loaded from " << resourcePath << "." << std::endl;
+        exit(1);
+    }
+
+    // Collect the files sorted by path to get reproducible results
+    std::vector<std::filesystem::path> files;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(corpus)) {
+        if (entry.is_regular_file() && (entry.path().filename().string().front() != '.')) {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    // The timings of each group summed over the files for each repetition
+    std::map<std::string, StageTimings> groupTimings;
+    std::map<std::string, int> groupFiles;
+    // The size (in bytes) of the MIDI output of the files as binary data and as base64
+    std::map<std::string, std::pair<size_t, size_t>> groupMidiSizes;
+
+    for (const std::filesystem::path &file : files) {
+        const std::filesystem::path relative = std::filesystem::relative(file, corpus);
+        const std::string group = (std::distance(relative.begin(), relative.end()) > 1) ? relative.begin()->string()
+                                                                                      : std::string("default");
+
+        std::ifstream input(file, std::ios::in | std::ios::binary);
+        std::stringstream buffer;
+        buffer << input.rdbuf();
+        const std::string data = buffer.str();
+
+        toolkit.ResetOptions();
+        if (!jsonOptions.empty()) toolkit.SetOptions(jsonOptions);
+        toolkit.SetOptions("{\"profile\": true}");
+
+        std::cerr << "Running " << relative.string() << std::endl;
+
+        bool ok = true;
+        for (int i = 0; i < warmup && ok; ++i) {
+            ok = run_stages(toolkit, data, NULL);
+        }
+        StageTimings timings;
+        for (int i = 0; i < repeat && ok; ++i) {
+            ok = run_stages(toolkit, data, &timings);
+        }
+        if (!ok) {
+            std::cerr << "Loading " << relative.string() << " failed, file skipped." << std::endl;
+            continue;
+        }
+
+        StageTimings &groupTiming = groupTimings[group];
+        for (const std::string &stage : stages) {
+            std::vector<double> &values = groupTiming[stage];
+            values.resize(repeat, 0.0);
+            for (int i = 0; i < repeat; ++i) values.at(i) += timings[stage].at(i);
+        }
+        ++groupFiles[group];
+        groupMidiSizes[group].first += toolkit.RenderToMIDIData().size();
+        groupMidiSizes[group].second += toolkit.RenderToMIDI().size();
+    }
+
+    // The micro benchmarks are run on a document of their own and reported as a group
+    vrv::Doc microDoc;
+    microDoc.GetResourcesForModification().SetPath(toolkit.GetResourcePath());
+    microDoc.GetResourcesForModification().InitFonts();
+    std::vector<char32_t> codes;
+    for (char32_t code = 0xE000; code <= 0xF8FF; ++code) {
+        if (microDoc.GetResources().GetGlyph(code)) codes.push_back(code);
+    }
+    std::cerr << "Running micro benchmarks" << std::endl;
+    for (int i = 0; i < warmup; ++i) {
+        time_glyph_metrics(microDoc, codes);
+        time_text_extents(microDoc);
+    }
+    StageTimings microTimings;
+    for (int i = 0; i < repeat; ++i) {
+        microTimings["glyphMetrics"].push_back(time_glyph_metrics(microDoc, codes));
+        microTimings["textExtents"].push_back(time_text_extents(microDoc));
+    }
+
+    jsonxx::Object groups;
+    jsonxx::Object microStatistics;
+    for (const auto &microTiming : microTimings) {
+        microStatistics << microTiming.first << get_statistics(microTiming.second);
+    }
+    jsonxx::Object microGroup;
+    microGroup << "files" << 0;
+    microGroup << "stages" << microStatistics;
+    groups << "micro" << microGroup;
+    for (const auto &groupTiming : groupTimings) {
+        jsonxx::Object group;
+        group << "files" << groupFiles[groupTiming.first];
+        jsonxx::Object midiSize;
+        midiSize << "data" << groupMidiSizes[groupTiming.first].first;
+        midiSize << "base64" << groupMidiSizes[groupTiming.first].second;
+        group << "midiSize" << midiSize;
+        jsonxx::Object stageStatistics;
+        for (const std::string &stage : stages) {
+            stageStatistics << stage << get_statistics(groupTiming.second.at(stage));
+        }
+        group << "stages" << stageStatistics;
+        groups << groupTiming.first << group;
+    }
+
+    jsonxx::Object results;
+    results << "version" << vrv::GetVersion();
+    results << "warmup" << warmup;
+    results << "repeat" << repeat;
+    results << "options" << jsonOptions;
+    results << "groups" << groups;
+
+    if (outfile.empty()) {
+        std::cout << results.json() << std::endl;
+    }
+    else {
+        std::ofstream output(outfile);
+        if (!output.is_open()) {
+            std::cerr << "Unable to write the results to " << outfile << "." << std::endl;
+            exit(1);
+        }
+        output << results.json() << std::endl;
+        std::cerr << "Results written to " << outfile << "." << std::endl;
+    }
+
+    return 0;
+}
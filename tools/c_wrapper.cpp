@@ -9,9 +9,106 @@
 #include "toolkit.h"
 #include "vrv.h"
 
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <ostream>
+
 using namespace std;
 using namespace vrv;
 
+namespace {
+
+/**
+ * A stream buffer passing the output to the write callback in chunks.
+ * Large writes are passed directly without being copied to the buffer.
+ */
+class CallbackStreamBuf : public std::streambuf {
+public:
+    CallbackStreamBuf(vrvWriteCallback callback, void *userData) : m_callback(callback), m_userData(userData)
+    {
+        this->setp(m_buffer, m_buffer + sizeof(m_buffer));
+    }
+
+protected:
+    int overflow(int c) override
+    {
+        this->sync();
+        if (c != traits_type::eof()) {
+            *this->pptr() = traits_type::to_char_type(c);
+            this->pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char *data, std::streamsize length) override
+    {
+        if (length < this->epptr() - this->pptr()) {
+            memcpy(this->pptr(), data, length);
+            this->pbump((int)length);
+        }
+        else {
+            this->sync();
+            m_callback(data, (size_t)length, m_userData);
+        }
+        return length;
+    }
+
+    int sync() override
+    {
+        if (this->pptr() > this->pbase()) {
+            m_callback(this->pbase(), (size_t)(this->pptr() - this->pbase()), m_userData);
+            this->setp(m_buffer, m_buffer + sizeof(m_buffer));
+        }
+        return 0;
+    }
+
+private:
+    vrvWriteCallback m_callback;
+    void *m_userData;
+    char m_buffer[16384];
+};
+
+/**
+ * The buffer of the caller with the length of the output written so far
+ */
+struct OutputBuffer {
+    char *m_data;
+    size_t m_size;
+    size_t m_length;
+};
+
+void AppendToBuffer(const char *data, size_t length, void *userData)
+{
+    OutputBuffer *buffer = static_cast<OutputBuffer *>(userData);
+    // Keep one char for the null termination
+    if (buffer->m_length + 1 < buffer->m_size) {
+        memcpy(buffer->m_data + buffer->m_length, data, std::min(length, buffer->m_size - 1 - buffer->m_length));
+    }
+    buffer->m_length += length;
+}
+
+bool StreamOutput(vrvWriteCallback callback, void *userData, const std::function<bool(std::ostream &)> &write)
+{
+    CallbackStreamBuf streamBuf(callback, userData);
+    std::ostream output(&streamBuf);
+    const bool success = write(output);
+    output.flush();
+    return success;
+}
+
+size_t BufferOutput(char *buffer, size_t size, const std::function<bool(std::ostream &)> &write)
+{
+    OutputBuffer outputBuffer = { buffer, size, 0 };
+    StreamOutput(AppendToBuffer, &outputBuffer, write);
+    if (size > 0) buffer[std::min(outputBuffer.m_length, size - 1)] = '\0';
+    return outputBuffer.m_length;
+}
+
+} // namespace
+
 extern "C" {
 
 void enableLog(bool value)
@@ -66,6 +163,13 @@ const char *vrvToolkit_editInfo(void *tkPtr)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getABCTuneIndex(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetABCTuneIndex());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getAvailableOptions(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -94,6 +198,13 @@ const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsAtPoint(void *tkPtr, int pageNo, int x, int y)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetElementsAtPoint(pageNo, x, y));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -101,6 +212,13 @@ const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsInRect(void *tkPtr, int pageNo, const char *rect)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetElementsInRect(pageNo, rect));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -180,6 +298,13 @@ const char *vrvToolkit_getOptionUsageString(void *tkPtr)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getProfile(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetProfile());
+    return tk->GetCString();
+}
+
 int vrvToolkit_getPageCount(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -242,6 +367,12 @@ void vrvToolkit_redoPagePitchPosLayout(void *tkPtr)
     tk->RedoPagePitchPosLayout();
 }
 
+bool vrvToolkit_requiresRedoLayout(void *tkPtr, const char *c_options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->RequiresRedoLayout(c_options);
+}
+
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -263,6 +394,16 @@ const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options)
     return tk->GetCString();
 }
 
+const unsigned char *vrvToolkit_renderToMIDIData(void *tkPtr, const char *c_options, size_t *length)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    // The C string of the toolkit holds the binary data
+    const std::vector<unsigned char> midiData = tk->RenderToMIDIData();
+    tk->SetCString(std::string(midiData.begin(), midiData.end()));
+    if (length) *length = midiData.size();
+    return reinterpret_cast<const unsigned char *>(tk->GetCString());
+}
+
 const char *vrvToolkit_renderToPAE(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -290,6 +431,12 @@ void vrvToolkit_resetOptions(void *tkPtr)
     tk->ResetOptions();
 }
 
+void vrvToolkit_resetProfile(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->ResetProfile();
+}
+
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -315,4 +462,74 @@ const char *vrvToolkit_validatePAE(void *tkPtr, const char *data)
     return tk->GetCString();
 }
 
+/****************************************************************
+ * Methods writing the output without the toolkit C string
+ ****************************************************************/
+
+bool vrvToolkit_getHumdrumStream(void *tkPtr, vrvWriteCallback callback, void *userData)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return StreamOutput(callback, userData, [tk](std::ostream &output) {
+        tk->GetHumdrum(output);
+        return !output.fail();
+    });
+}
+
+size_t vrvToolkit_getHumdrumBuffer(void *tkPtr, char *buffer, size_t size)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return BufferOutput(buffer, size, [tk](std::ostream &output) {
+        tk->GetHumdrum(output);
+        return !output.fail();
+    });
+}
+
+bool vrvToolkit_getMEIStream(void *tkPtr, const char *options, vrvWriteCallback callback, void *userData)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return StreamOutput(
+        callback, userData, [tk, options](std::ostream &output) { return tk->GetMEI(options, output); });
+}
+
+size_t vrvToolkit_getMEIBuffer(void *tkPtr, const char *options, char *buffer, size_t size)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return BufferOutput(buffer, size, [tk, options](std::ostream &output) { return tk->GetMEI(options, output); });
+}
+
+bool vrvToolkit_renderToSVGStream(
+    void *tkPtr, int page_no, bool xmlDeclaration, vrvWriteCallback callback, void *userData)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return StreamOutput(callback, userData, [tk, page_no, xmlDeclaration](std::ostream &output) {
+        return tk->RenderToSVG(page_no, xmlDeclaration, output);
+    });
+}
+
+size_t vrvToolkit_renderToSVGBuffer(void *tkPtr, int page_no, bool xmlDeclaration, char *buffer, size_t size)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return BufferOutput(buffer, size, [tk, page_no, xmlDeclaration](std::ostream &output) {
+        return tk->RenderToSVG(page_no, xmlDeclaration, output);
+    });
+}
+
+bool vrvToolkit_renderToTimemapStream(void *tkPtr, const char *c_options, vrvWriteCallback callback, void *userData)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return StreamOutput(callback, userData, [tk, c_options](std::ostream &output) {
+        output << tk->RenderToTimemap(c_options);
+        return !output.fail();
+    });
+}
+
+size_t vrvToolkit_renderToTimemapBuffer(void *tkPtr, const char *c_options, char *buffer, size_t size)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return BufferOutput(buffer, size, [tk, c_options](std::ostream &output) {
+        output << tk->RenderToTimemap(c_options);
+        return !output.fail();
+    });
+}
+
 } // extern C
@@ -5,10 +5,18 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * The callback receiving the output in chunks as it is produced
+ * The data is not null-terminated and is valid only during the call
+ */
+typedef void (*vrvWriteCallback)(const char *data, size_t length, void *userData);
+
 /****************************************************************
  * Methods exported a functions to use the Toolkit class
  ****************************************************************/
@@ -21,11 +29,14 @@ void *vrvToolkit_constructorResourcePath(const char *resourcePath);
 
 void vrvToolkit_destructor(void *tkPtr);
 bool vrvToolkit_edit(void *tkPtr, const char *editorAction);
+const char *vrvToolkit_getABCTuneIndex(void *tkPtr);
 const char *vrvToolkit_getAvailableOptions(void *tkPtr);
 const char *vrvToolkit_getDefaultOptions(void *tkPtr);
 const char *vrvToolkit_getDescriptiveFeatures(void *tkPtr, const char *options);
 const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getElementsAtPoint(void *tkPtr, int pageNo, int x, int y);
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec);
+const char *vrvToolkit_getElementsInRect(void *tkPtr, int pageNo, const char *rect);
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getHumdrum(void *tkPtr);
 const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumData);
@@ -36,6 +47,7 @@ const char *vrvToolkit_getMEI(void *tkPtr, const char *options);
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getOptions(void *tkPtr);
+const char *vrvToolkit_getProfile(void *tkPtr);
 const char *vrvToolkit_getOptionUsageString(void *tkPtr);
 int vrvToolkit_getPageCount(void *tkPtr);
 int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId);
@@ -46,18 +58,41 @@ bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data);
 bool vrvToolkit_loadZipDataBuffer(void *tkPtr, const unsigned char *data, int length);
 void vrvToolkit_redoLayout(void *tkPtr, const char *c_options);
 void vrvToolkit_redoPagePitchPosLayout(void *tkPtr);
+bool vrvToolkit_requiresRedoLayout(void *tkPtr, const char *c_options);
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options);
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr);
 const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options);
+// The bytes of the MIDI file and their number, valid until the next call returning a string
+const unsigned char *vrvToolkit_renderToMIDIData(void *tkPtr, const char *c_options, size_t *length);
 const char *vrvToolkit_renderToPAE(void *tkPtr);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
 void vrvToolkit_resetOptions(void *tkPtr);
+void vrvToolkit_resetProfile(void *tkPtr);
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed);
 bool vrvToolkit_select(void *tkPtr, const char *selection);
 bool vrvToolkit_setOptions(void *tkPtr, const char *options);
 const char *vrvToolkit_validatePAE(void *tkPtr, const char *data);
 
+/****************************************************************
+ * Methods writing the output without the toolkit C string
+ *
+ * The stream methods pass the output to the callback as it is produced.
+ * The buffer methods write the output to the buffer of the caller (null-terminated)
+ * and return the length of the complete output, which can be larger than the buffer,
+ * in which case the output is truncated.
+ ****************************************************************/
+
+bool vrvToolkit_getHumdrumStream(void *tkPtr, vrvWriteCallback callback, void *userData);
+size_t vrvToolkit_getHumdrumBuffer(void *tkPtr, char *buffer, size_t size);
+bool vrvToolkit_getMEIStream(void *tkPtr, const char *options, vrvWriteCallback callback, void *userData);
+size_t vrvToolkit_getMEIBuffer(void *tkPtr, const char *options, char *buffer, size_t size);
+bool vrvToolkit_renderToSVGStream(
+    void *tkPtr, int page_no, bool xmlDeclaration, vrvWriteCallback callback, void *userData);
+size_t vrvToolkit_renderToSVGBuffer(void *tkPtr, int page_no, bool xmlDeclaration, char *buffer, size_t size);
+bool vrvToolkit_renderToTimemapStream(void *tkPtr, const char *c_options, vrvWriteCallback callback, void *userData);
+size_t vrvToolkit_renderToTimemapBuffer(void *tkPtr, const char *c_options, char *buffer, size_t size);
+
 #ifdef __cplusplus
 } // extern C
 #endif
@@ -5,16 +5,20 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
 
 #ifndef _WIN32
 #include <getopt.h>
+#include <glob.h>
 #else
 #include "win_getopt.h"
 #endif
@@ -22,6 +26,8 @@
 //----------------------------------------------------------------------------
 
 #include "options.h"
+#include "profiler.h"
+#include "threadpool.h"
 #include "toolkit.h"
 #include "vrv.h"
 
@@ -72,15 +78,287 @@ bool optionExists(const std::string &option, int argc, char **argv, std::string
     return false;
 }
 
+bool readFile(const std::string &filename, std::string &data)
+{
+    std::ifstream instream(filename.c_str(), std::ios::binary);
+    if (!instream.is_open()) {
+        return false;
+    }
+    std::ostringstream data_stream;
+    data_stream << instream.rdbuf();
+    data = data_stream.str();
+    return true;
+}
+
+// Add the files matching a pattern of the batch list
+// Glob patterns are expanded only where glob is available
+void expandBatchPattern(const std::string &pattern, std::vector<std::string> &files)
+{
+#ifndef _WIN32
+    if (pattern.find_first_of("*?[") != std::string::npos) {
+        glob_t globResult;
+        if (glob(pattern.c_str(), 0, NULL, &globResult) == 0) {
+            for (size_t i = 0; i < globResult.gl_pathc; ++i) {
+                files.push_back(globResult.gl_pathv[i]);
+            }
+        }
+        else {
+            vrv::LogWarning("No file matching '%s'", pattern.c_str());
+        }
+        globfree(&globResult);
+        return;
+    }
+#endif
+    files.push_back(pattern);
+}
+
+// Read the batch list - one path or pattern per line, empty lines and lines starting with # are skipped
+bool readBatchList(const std::string &listfile, std::vector<std::string> &files)
+{
+    std::ifstream fileStream;
+    std::istream *input = &std::cin;
+    if (listfile != "-") {
+        fileStream.open(listfile.c_str());
+        if (!fileStream.is_open()) {
+            return false;
+        }
+        input = &fileStream;
+    }
+    for (std::string line; std::getline(*input, line);) {
+        const size_t start = line.find_first_not_of(" \t\r");
+        if ((start == std::string::npos) || (line.at(start) == '#')) continue;
+        const size_t end = line.find_last_not_of(" \t\r");
+        expandBatchPattern(line.substr(start, end - start + 1), files);
+    }
+    return true;
+}
+
+// The settings shared by all the conversions of a batch
+struct BatchSettings {
+    const vrv::Options *options = NULL;
+    std::string resourcePath;
+    std::string inputFrom;
+    std::string outformat;
+    std::string outdir;
+    int page = 1;
+    bool allPages = false;
+};
+
+// The result of the conversion of one file of a batch
+struct BatchResult {
+    bool success = false;
+    std::string error;
+    int pageCount = 0;
+    double loadTime = 0.0;
+    double renderTime = 0.0;
+    std::vector<std::string> outputs;
+};
+
+double secondsSince(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Convert one file of a batch with the toolkit of the worker
+// The output file names follow the ones of the single file conversion
+bool convertBatchFile(
+    vrv::Toolkit &toolkit, const std::string &infile, const BatchSettings &settings, BatchResult &result)
+{
+    const std::string &outformat = settings.outformat;
+    std::string outfile = removeExtension(infile);
+    if (!settings.outdir.empty()) {
+        outfile = settings.outdir + "/" + basename(outfile);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Humdrum output from MEI or Humdrum is converted directly from the data
+    if (((outformat == "humdrum") || (outformat == "hum"))
+        && ((toolkit.GetInputFrom() == vrv::MEI) || (toolkit.GetInputFrom() == vrv::HUMDRUM))) {
+        std::string data;
+        if (!readFile(infile, data)) {
+            result.error = "The file could not be opened";
+            return false;
+        }
+        if (toolkit.GetInputFrom() == vrv::MEI) {
+            toolkit.ConvertMEIToHumdrum(data);
+        }
+        else {
+            toolkit.ConvertHumdrumToHumdrum(data);
+        }
+    }
+    else if (!toolkit.LoadFile(infile)) {
+        result.error = "The file could not be loaded";
+        return false;
+    }
+    result.loadTime = secondsSince(start);
+    start = std::chrono::steady_clock::now();
+
+    if (toolkit.GetOutputTo() != vrv::HUMDRUM) {
+        result.pageCount = toolkit.GetPageCount();
+        if ((settings.page < 1) || (settings.page > result.pageCount)) {
+            result.error = vrv::StringFormat("The page requested (%d) is not in the page range", settings.page);
+            return false;
+        }
+    }
+
+    bool success = true;
+    if (outformat == "svg") {
+        const int to = (settings.allPages) ? result.pageCount + 1 : settings.page + 1;
+        for (int p = settings.page; p < to; ++p) {
+            std::string cur_outfile = outfile;
+            if (settings.allPages) {
+                cur_outfile += vrv::StringFormat("_%03d", p);
+            }
+            cur_outfile += ".svg";
+            if (!toolkit.RenderToSVGFile(cur_outfile, p)) {
+                success = false;
+                break;
+            }
+            result.outputs.push_back(cur_outfile);
+        }
+    }
+    else if (outformat == "midi") {
+        outfile += ".mid";
+        success = toolkit.RenderToMIDIFile(outfile);
+    }
+    else if (outformat == "timemap") {
+        outfile += ".json";
+        success = toolkit.RenderToTimemapFile(outfile);
+    }
+    else if (outformat == "expansionmap") {
+        outfile += "-em.json";
+        success = toolkit.RenderToExpansionMapFile(outfile);
+    }
+    else if ((outformat == "humdrum") || (outformat == "hum")) {
+        outfile += ".krn";
+        success = toolkit.GetHumdrumFile(outfile);
+    }
+    else if (outformat == "pae") {
+        outfile += ".pae";
+        success = toolkit.RenderToPAEFile(outfile);
+    }
+    else {
+        const char *scoreBased = (outformat == "mei-pb") ? "false" : "true";
+        const char *basic = (outformat == "mei-basic") ? "true" : "false";
+        const char *removeIds = (settings.options->m_removeIds.GetValue()) ? "true" : "false";
+        outfile += ".mei";
+        std::string params
+            = vrv::StringFormat("{'scoreBased': %s, 'basic': %s, 'removeIds': %s}", scoreBased, basic, removeIds);
+        if (!settings.allPages) {
+            params = vrv::StringFormat("{'scoreBased': %s, 'basic': %s, 'pageNo': %d, 'removeIds': %s}", scoreBased,
+                basic, settings.page, removeIds);
+        }
+        success = toolkit.SaveFile(outfile, params);
+    }
+    result.renderTime = secondsSince(start);
+
+    if (!success) {
+        result.error = "The output could not be written";
+        return false;
+    }
+    if (outformat != "svg") {
+        result.outputs.push_back(outfile);
+    }
+    return true;
+}
+
+// Convert all the files of a batch with a pool of workers and write a JSON summary to the standard output
+// Each worker owns a toolkit that is reused for all the files it converts
+// A file that fails does not stop the conversion of the other ones
+int runBatch(const std::vector<std::string> &files, int jobs, const BatchSettings &settings)
+{
+    if (jobs <= 0) {
+        jobs = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    jobs = std::min(jobs, std::max(1, (int)files.size()));
+
+    std::vector<BatchResult> results(files.size());
+    std::atomic<int> nextFile(0);
+    const int xmlIdSeed = settings.options->m_xmlIdSeed.GetValue();
+
+    auto start = std::chrono::steady_clock::now();
+
+    vrv::ThreadPool threadPool(jobs);
+    threadPool.Run(jobs, [&](int) {
+        vrv::Toolkit toolkit(false);
+        *toolkit.GetOptionsObj() = *settings.options;
+        bool ready = toolkit.SetResourcePath(settings.resourcePath)
+            && toolkit.SetOptions(
+                vrv::StringFormat("{\"font\": \"%s\" }", settings.options->m_font.GetValue().c_str()));
+        if (!settings.inputFrom.empty()) {
+            ready = ready && toolkit.SetInputFrom(settings.inputFrom);
+        }
+        toolkit.SetOutputTo(settings.outformat);
+        if ((settings.outformat == "midi") || (settings.outformat == "timemap")
+            || (settings.outformat == "expansionmap")) {
+            toolkit.SetOptions("{'breaks': 'none'}");
+        }
+
+        for (int i = nextFile++; i < (int)files.size(); i = nextFile++) {
+            BatchResult &result = results.at(i);
+            if (!ready) {
+                result.error = "The toolkit could not be initialized";
+                continue;
+            }
+            // Seed the IDs for every file so that the output does not depend on the worker
+            if (xmlIdSeed != 0) {
+                toolkit.ResetXmlIdSeed(xmlIdSeed);
+            }
+            try {
+                result.success = convertBatchFile(toolkit, files.at(i), settings, result);
+            }
+            catch (const std::exception &e) {
+                result.success = false;
+                result.error = e.what();
+            }
+        }
+    });
+
+    jsonxx::Array fileArray;
+    int failed = 0;
+    for (int i = 0; i < (int)files.size(); ++i) {
+        const BatchResult &result = results.at(i);
+        jsonxx::Object o;
+        o << "file" << files.at(i);
+        o << "status" << std::string((result.success) ? "ok" : "error");
+        if (!result.success) {
+            o << "error" << result.error;
+            ++failed;
+        }
+        o << "pages" << result.pageCount;
+        o << "loadTime" << result.loadTime;
+        o << "renderTime" << result.renderTime;
+        jsonxx::Array outputs;
+        for (const std::string &output : result.outputs) outputs << output;
+        o << "outputs" << outputs;
+        fileArray << o;
+    }
+
+    jsonxx::Object summary;
+    summary << "jobs" << jobs;
+    summary << "files" << (int)files.size();
+    summary << "succeeded" << (int)files.size() - failed;
+    summary << "failed" << failed;
+    summary << "time" << secondsSince(start);
+    summary << "results" << fileArray;
+    std::cout << summary.json() << std::endl;
+
+    return (failed > 0) ? 1 : 0;
+}
+
 int main(int argc, char **argv)
 {
     std::string infile;
     std::string svgdir;
     std::string outfile;
     std::string outformat = "svg";
+    std::string inputFrom;
+    std::string batchfile;
     bool std_output = false;
 
     int all_pages = 0;
+    int batch_jobs = 0;
     int page = 1;
     int show_version = 0;
 
@@ -91,6 +369,8 @@ int main(int argc, char **argv)
 
     static struct option base_options[] = { //
         { "all-pages", no_argument, 0, 'a' }, //
+        { "batch", required_argument, 0, 'b' }, //
+        { "batch-jobs", required_argument, 0, 'j' }, //
         { "input-from", required_argument, 0, 'f' }, //
         { "help", required_argument, 0, 'h' }, //
         { "log-level", required_argument, 0, 'l' }, //
@@ -155,7 +435,7 @@ int main(int argc, char **argv)
     vrv::Option *opt = NULL;
     vrv::OptionBool *optBool = NULL;
     std::string resourcePath = toolkit.GetResourcePath();
-    while ((c = getopt_long(argc, argv, "ab:f:h:l:o:p:r:s:t:vx:z", long_options, &option_index)) != -1) {
+    while ((c = getopt_long(argc, argv, "ab:f:h:j:l:o:p:r:s:t:vx:z", long_options, &option_index)) != -1) {
         switch (c) {
             case 0:
                 key = long_options[option_index].name;
@@ -183,12 +463,17 @@ int main(int argc, char **argv)
 
             case 'a': all_pages = 1; break;
 
+            case 'b': batchfile = std::string(optarg); break;
+
             case 'f':
-                if (!toolkit.SetInputFrom(std::string(optarg))) {
+                inputFrom = std::string(optarg);
+                if (!toolkit.SetInputFrom(inputFrom)) {
                     exit(1);
                 };
                 break;
 
+            case 'j': batch_jobs = atoi(optarg); break;
+
             case 'l': vrv::EnableLog(vrv::StrToLogLevel(std::string(optarg))); break;
 
             case 'o': outfile = std::string(optarg); break;
@@ -248,11 +533,14 @@ int main(int argc, char **argv)
         toolkit.InitClock();
     }
 
+    // Collect the profile if desired
+    if (options->m_profile.GetValue()) vrv::Profiler::Enable();
+
     std::cerr << infile;
     if (optind <= argc - 1) {
         infile = std::string(argv[optind]);
     }
-    else if (infile != "-") {
+    else if ((infile != "-") && batchfile.empty()) {
         std::cerr << "Incorrect number of arguments: expected one input file but found none." << std::endl << std::endl;
         toolkit.PrintOptionUsage("base", std::cout);
         exit(1);
@@ -288,6 +576,40 @@ int main(int argc, char **argv)
         exit(1);
     }
 
+    // Convert the files of the batch list and the ones given as arguments
+    if (!batchfile.empty()) {
+        std::vector<std::string> files;
+        if (!readBatchList(batchfile, files)) {
+            std::cerr << "The batch list '" << batchfile << "' could not be opened." << std::endl;
+            exit(1);
+        }
+        for (int i = optind; i < argc; ++i) {
+            expandBatchPattern(argv[i], files);
+        }
+        if ((outfile == "-") || (!outfile.empty() && !dir_exists(outfile))) {
+            std::cerr << "The output in batch mode has to be an existing directory." << std::endl;
+            exit(1);
+        }
+
+        BatchSettings settings;
+        settings.options = options;
+        settings.resourcePath = resourcePath;
+        settings.inputFrom = inputFrom;
+        settings.outformat = outformat;
+        settings.outdir = outfile;
+        settings.page = page;
+        settings.allPages = all_pages;
+        int status = runBatch(files, batch_jobs, settings);
+
+        // Display the profile if desired
+        if (options->m_profile.GetValue()) {
+            std::cerr << toolkit.GetProfile() << std::endl;
+        }
+
+        free(long_options);
+        return status;
+    }
+
     // Make sure we provide a file name or output to std output with std input
     if ((infile == "-") && (outfile.empty())) {
         std::cerr << "Standard input can be used only with standard output or output filename." << std::endl;
@@ -589,6 +911,11 @@ int main(int argc, char **argv)
         toolkit.LogRuntime();
     }
 
+    // Display the profile if desired
+    if (options->m_profile.GetValue()) {
+        std::cerr << toolkit.GetProfile() << std::endl;
+    }
+
     free(long_options);
     return 0;
 }